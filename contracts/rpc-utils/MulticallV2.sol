@@ -21,6 +21,13 @@ contract Multicall2 {
         bool success;
         bytes returnData;
     }
+    struct Call3 {
+        address target;
+        bool allowFailure;
+        // 0 forwards all the remaining gas
+        uint256 gasLimit;
+        bytes callData;
+    }
 
     function aggregate(Call[] memory calls)
         public
@@ -35,6 +42,24 @@ contract Multicall2 {
         }
     }
 
+    /// @notice Aggregate calls decoded straight from calldata, each with its own failure flag and gas cap
+    /// @dev the gas cap bounds what a single call can use, so a failing call can't consume a whole eth_call batch
+    function aggregate3(Call3[] calldata calls) external returns (Result[] memory returnData) {
+        uint256 length = calls.length;
+        returnData = new Result[](length);
+        for (uint256 i = 0; i < length; i++) {
+            Call3 calldata calli = calls[i];
+            uint256 gasLimit = calli.gasLimit;
+            (bool success, bytes memory ret) = calli.target.call{
+                gas: gasLimit == 0 || gasLimit > gasleft() ? gasleft() : gasLimit
+            }(calli.callData);
+
+            require(success || calli.allowFailure, "Multicall2 aggregate: call failed");
+
+            returnData[i] = Result(success, ret);
+        }
+    }
+
     function blockAndAggregate(Call[] memory calls)
         public
         returns (
@@ -137,6 +162,13 @@ contract ArbMulticall2 {
         bool success;
         bytes returnData;
     }
+    struct Call3 {
+        address target;
+        bool allowFailure;
+        // 0 forwards all the remaining gas
+        uint256 gasLimit;
+        bytes callData;
+    }
 
     function aggregate(Call[] memory calls)
         public
@@ -151,6 +183,24 @@ contract ArbMulticall2 {
         }
     }
 
+    /// @notice Aggregate calls decoded straight from calldata, each with its own failure flag and gas cap
+    /// @dev the gas cap bounds what a single call can use, so a failing call can't consume a whole eth_call batch
+    function aggregate3(Call3[] calldata calls) external returns (Result[] memory returnData) {
+        uint256 length = calls.length;
+        returnData = new Result[](length);
+        for (uint256 i = 0; i < length; i++) {
+            Call3 calldata calli = calls[i];
+            uint256 gasLimit = calli.gasLimit;
+            (bool success, bytes memory ret) = calli.target.call{
+                gas: gasLimit == 0 || gasLimit > gasleft() ? gasleft() : gasLimit
+            }(calli.callData);
+
+            require(success || calli.allowFailure, "Multicall2 aggregate: call failed");
+
+            returnData[i] = Result(success, ret);
+        }
+    }
+
     function blockAndAggregate(Call[] memory calls)
         public
         returns (
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: Apache-2.0
+
+// solhint-disable-next-line compiler-version
+pragma solidity >=0.6.9 <0.9.0;
+
+/**
+ * @notice Receiver of a post deposit hook, called by the L2 gateway once the deposited tokens are credited to it
+ * @dev The caller is the L2 gateway of `l1Token`. Receivers should check it against the L2 router, since anyone
+ * can call this function. `from` is the L1 account which initiated the deposit, without L2 aliasing.
+ * A revert of the hook doesn't revert the deposit, tokens stay with the receiver either way.
+ */
+interface IDepositHookReceiver {
+    function onDepositFinalized(
+        address l1Token,
+        address l2Token,
+        address from,
+        uint256 amount,
+        bytes calldata data
+    ) external;
+}
@@ -8,7 +8,7 @@ import {L2WethGateway} from "./gateway/L2WethGateway.sol";
 import {StandardArbERC20} from "./StandardArbERC20.sol";
 import {IUpgradeExecutor} from "@offchainlabs/upgrade-executor/src/IUpgradeExecutor.sol";
 import {CreationCodeHelper} from "../libraries/CreationCodeHelper.sol";
-import {BeaconProxyFactory} from "../libraries/ClonableBeaconProxy.sol";
+import {MinimalBeaconProxyFactory} from "../libraries/ClonableBeaconProxy.sol";
 import {aeWETH} from "../libraries/aeWETH.sol";
 import {UpgradeableBeacon} from "@openzeppelin/contracts/proxy/beacon/UpgradeableBeacon.sol";
 import {ProxyAdmin} from "@openzeppelin/contracts/proxy/transparent/ProxyAdmin.sol";
@@ -25,6 +25,7 @@ import {Create2} from "@openzeppelin/contracts/utils/Create2.sol";
  */
 contract L2AtomicTokenBridgeFactory {
     error L2AtomicTokenBridgeFactory_AlreadyExists();
+    error L2AtomicTokenBridgeFactory_InvalidTemplate(address template);
 
     // In order to avoid having uninitialized logic contracts, `initialize` function will be called
     // on all logic contracts which don't have initializers disabled. This dummy non-zero address
@@ -43,6 +44,61 @@ contract L2AtomicTokenBridgeFactory {
         address rollupOwner,
         address aliasedL1UpgradeExecutor
     ) external {
+        _deployL2Contracts(
+            _getCreationCode(l2Code),
+            l1Router,
+            l1StandardGateway,
+            l1CustomGateway,
+            l1WethGateway,
+            l1Weth,
+            l2StandardGatewayCanonicalAddress,
+            rollupOwner,
+            aliasedL1UpgradeExecutor
+        );
+    }
+
+    /**
+     * @notice Same as `deployL2Contracts`, but the logic contracts are copied from templates already deployed on L2
+     *         instead of being sent as bytecode, which keeps the retryable's calldata small.
+     * @dev Each template's code hash must match the expected one, so the deployed logic contracts, and their
+     *      addresses, are the same as if their bytecode had been sent. WETH templates are only used if
+     *      `l1WethGateway` is set.
+     */
+    function deployL2ContractsFromTemplates(
+        L2DeployedTemplates calldata l2Templates,
+        address l1Router,
+        address l1StandardGateway,
+        address l1CustomGateway,
+        address l1WethGateway,
+        address l1Weth,
+        address l2StandardGatewayCanonicalAddress,
+        address rollupOwner,
+        address aliasedL1UpgradeExecutor
+    ) external {
+        _deployL2Contracts(
+            _getCreationCodeFromTemplates(l2Templates),
+            l1Router,
+            l1StandardGateway,
+            l1CustomGateway,
+            l1WethGateway,
+            l1Weth,
+            l2StandardGatewayCanonicalAddress,
+            rollupOwner,
+            aliasedL1UpgradeExecutor
+        );
+    }
+
+    function _deployL2Contracts(
+        L2CreationCode memory l2Code,
+        address l1Router,
+        address l1StandardGateway,
+        address l1CustomGateway,
+        address l1WethGateway,
+        address l1Weth,
+        address l2StandardGatewayCanonicalAddress,
+        address rollupOwner,
+        address aliasedL1UpgradeExecutor
+    ) internal {
         // Create proxyAdmin which will be used for all contracts. Revert if canonical deployment already exists
         {
             address proxyAdminAddress = Create2.computeAddress(
@@ -75,18 +131,14 @@ contract L2AtomicTokenBridgeFactory {
         }
 
         // deploy multicall
-        Create2.deploy(
-            0,
-            _getL2Salt(OrbitSalts.L2_MULTICALL),
-            CreationCodeHelper.getCreationCodeFor(l2Code.multicall)
-        );
+        Create2.deploy(0, _getL2Salt(OrbitSalts.L2_MULTICALL), l2Code.multicall);
 
         // transfer ownership to L2 upgradeExecutor
         ProxyAdmin(proxyAdmin).transferOwnership(upgradeExecutor);
     }
 
     function _deployUpgradeExecutor(
-        bytes calldata runtimeCode,
+        bytes memory creationCode,
         address rollupOwner,
         address proxyAdmin,
         address aliasedL1UpgradeExecutor
@@ -95,11 +147,8 @@ contract L2AtomicTokenBridgeFactory {
         address canonicalUpgradeExecutor = _deploySeedProxy(proxyAdmin, OrbitSalts.L2_EXECUTOR);
 
         // Create UpgradeExecutor logic and upgrade to it.
-        address upExecutorLogic = Create2.deploy(
-            0,
-            _getL2Salt(OrbitSalts.L2_EXECUTOR),
-            CreationCodeHelper.getCreationCodeFor(runtimeCode)
-        );
+        address upExecutorLogic =
+            Create2.deploy(0, _getL2Salt(OrbitSalts.L2_EXECUTOR), creationCode);
 
         ProxyAdmin(proxyAdmin).upgrade(
             ITransparentUpgradeableProxy(canonicalUpgradeExecutor), upExecutorLogic
@@ -119,7 +168,7 @@ contract L2AtomicTokenBridgeFactory {
     }
 
     function _deployRouter(
-        bytes calldata runtimeCode,
+        bytes memory creationCode,
         address l1Router,
         address l2StandardGatewayCanonicalAddress,
         address proxyAdmin
@@ -128,9 +177,7 @@ contract L2AtomicTokenBridgeFactory {
         address canonicalRouter = _deploySeedProxy(proxyAdmin, OrbitSalts.L2_ROUTER);
 
         // create L2 router logic and upgrade
-        address routerLogic = Create2.deploy(
-            0, _getL2Salt(OrbitSalts.L2_ROUTER), CreationCodeHelper.getCreationCodeFor(runtimeCode)
-        );
+        address routerLogic = Create2.deploy(0, _getL2Salt(OrbitSalts.L2_ROUTER), creationCode);
         ProxyAdmin(proxyAdmin).upgrade(ITransparentUpgradeableProxy(canonicalRouter), routerLogic);
 
         // init logic contract with dummy values.
@@ -143,7 +190,7 @@ contract L2AtomicTokenBridgeFactory {
     }
 
     function _deployStandardGateway(
-        bytes calldata runtimeCode,
+        bytes memory creationCode,
         address l1StandardGateway,
         address router,
         address proxyAdmin,
@@ -153,11 +200,8 @@ contract L2AtomicTokenBridgeFactory {
         address canonicalStdGateway = _deploySeedProxy(proxyAdmin, OrbitSalts.L2_STANDARD_GATEWAY);
 
         // create L2 standard gateway logic and upgrade
-        address stdGatewayLogic = Create2.deploy(
-            0,
-            _getL2Salt(OrbitSalts.L2_STANDARD_GATEWAY),
-            CreationCodeHelper.getCreationCodeFor(runtimeCode)
-        );
+        address stdGatewayLogic =
+            Create2.deploy(0, _getL2Salt(OrbitSalts.L2_STANDARD_GATEWAY), creationCode);
         ProxyAdmin(proxyAdmin).upgrade(
             ITransparentUpgradeableProxy(canonicalStdGateway), stdGatewayLogic
         );
@@ -171,8 +215,8 @@ contract L2AtomicTokenBridgeFactory {
         UpgradeableBeacon beacon = new UpgradeableBeacon{
             salt: _getL2Salt(OrbitSalts.BEACON_PROXY_FACTORY)
         }(address(standardArbERC20));
-        BeaconProxyFactory beaconProxyFactory =
-            new BeaconProxyFactory{salt: _getL2Salt(OrbitSalts.BEACON_PROXY_FACTORY)}();
+        MinimalBeaconProxyFactory beaconProxyFactory =
+            new MinimalBeaconProxyFactory{salt: _getL2Salt(OrbitSalts.BEACON_PROXY_FACTORY)}();
 
         // init contracts
         beaconProxyFactory.initialize(address(beacon));
@@ -185,7 +229,7 @@ contract L2AtomicTokenBridgeFactory {
     }
 
     function _deployCustomGateway(
-        bytes calldata runtimeCode,
+        bytes memory creationCode,
         address l1CustomGateway,
         address router,
         address proxyAdmin
@@ -194,11 +238,8 @@ contract L2AtomicTokenBridgeFactory {
         address canonicalCustomGateway = _deploySeedProxy(proxyAdmin, OrbitSalts.L2_CUSTOM_GATEWAY);
 
         // create L2 custom gateway logic and upgrade
-        address customGatewayLogicAddress = Create2.deploy(
-            0,
-            _getL2Salt(OrbitSalts.L2_CUSTOM_GATEWAY),
-            CreationCodeHelper.getCreationCodeFor(runtimeCode)
-        );
+        address customGatewayLogicAddress =
+            Create2.deploy(0, _getL2Salt(OrbitSalts.L2_CUSTOM_GATEWAY), creationCode);
         ProxyAdmin(proxyAdmin).upgrade(
             ITransparentUpgradeableProxy(canonicalCustomGateway), customGatewayLogicAddress
         );
@@ -211,8 +252,8 @@ contract L2AtomicTokenBridgeFactory {
     }
 
     function _deployWethGateway(
-        bytes calldata wethGatewayRuntimeCode,
-        bytes calldata aeWethRuntimeCode,
+        bytes memory wethGatewayCreationCode,
+        bytes memory aeWethCreationCode,
         address l1WethGateway,
         address l1Weth,
         address router,
@@ -222,22 +263,15 @@ contract L2AtomicTokenBridgeFactory {
         address canonicalL2Weth = _deploySeedProxy(proxyAdmin, OrbitSalts.L2_WETH);
 
         // Create L2WETH logic and upgrade
-        address l2WethLogic = Create2.deploy(
-            0,
-            _getL2Salt(OrbitSalts.L2_WETH),
-            CreationCodeHelper.getCreationCodeFor(aeWethRuntimeCode)
-        );
+        address l2WethLogic = Create2.deploy(0, _getL2Salt(OrbitSalts.L2_WETH), aeWethCreationCode);
         ProxyAdmin(proxyAdmin).upgrade(ITransparentUpgradeableProxy(canonicalL2Weth), l2WethLogic);
 
         // canonical L2 WETH gateway with dummy logic
         address canonicalL2WethGateway = _deploySeedProxy(proxyAdmin, OrbitSalts.L2_WETH_GATEWAY);
 
         // create L2WETH gateway logic and upgrade
-        address l2WethGatewayLogic = Create2.deploy(
-            0,
-            _getL2Salt(OrbitSalts.L2_WETH_GATEWAY),
-            CreationCodeHelper.getCreationCodeFor(wethGatewayRuntimeCode)
-        );
+        address l2WethGatewayLogic =
+            Create2.deploy(0, _getL2Salt(OrbitSalts.L2_WETH_GATEWAY), wethGatewayCreationCode);
         ProxyAdmin(proxyAdmin).upgrade(
             ITransparentUpgradeableProxy(canonicalL2WethGateway), l2WethGatewayLogic
         );
@@ -261,6 +295,56 @@ contract L2AtomicTokenBridgeFactory {
         );
     }
 
+    function _getCreationCode(L2RuntimeCode calldata l2Code)
+        internal
+        pure
+        returns (L2CreationCode memory)
+    {
+        return L2CreationCode(
+            CreationCodeHelper.getCreationCodeFor(l2Code.router),
+            CreationCodeHelper.getCreationCodeFor(l2Code.standardGateway),
+            CreationCodeHelper.getCreationCodeFor(l2Code.customGateway),
+            CreationCodeHelper.getCreationCodeFor(l2Code.wethGateway),
+            CreationCodeHelper.getCreationCodeFor(l2Code.aeWeth),
+            CreationCodeHelper.getCreationCodeFor(l2Code.upgradeExecutor),
+            CreationCodeHelper.getCreationCodeFor(l2Code.multicall)
+        );
+    }
+
+    function _getCreationCodeFromTemplates(L2DeployedTemplates calldata l2Templates)
+        internal
+        view
+        returns (L2CreationCode memory)
+    {
+        return L2CreationCode(
+            _getTemplateCreationCode(l2Templates.router),
+            _getTemplateCreationCode(l2Templates.standardGateway),
+            _getTemplateCreationCode(l2Templates.customGateway),
+            _getTemplateCreationCode(l2Templates.wethGateway),
+            _getTemplateCreationCode(l2Templates.aeWeth),
+            _getTemplateCreationCode(l2Templates.upgradeExecutor),
+            _getTemplateCreationCode(l2Templates.multicall)
+        );
+    }
+
+    /**
+     * Creation code of a contract with the same code as `template`, which has to match the expected code hash.
+     * Unused templates, ie. WETH ones in ERC20-based chains, are left unset and get an empty creation code.
+     */
+    function _getTemplateCreationCode(L2DeployedTemplate calldata template)
+        internal
+        view
+        returns (bytes memory)
+    {
+        if (template.target == address(0)) {
+            return "";
+        }
+        if (template.target.codehash != template.codeHash) {
+            revert L2AtomicTokenBridgeFactory_InvalidTemplate(template.target);
+        }
+        return CreationCodeHelper.getCreationCodeForDeployedCode(template.target);
+    }
+
     /**
      * In addition to hard-coded prefix, salt for L2 contracts depends on msg.sender and the chainId. Deploying L2 token bridge contracts is
      * permissionless. By making msg.sender part of the salt we know exactly which set of contracts is the "canonical" one for given chain,
@@ -296,6 +380,40 @@ struct L2RuntimeCode {
     bytes multicall;
 }
 
+/**
+ * Token bridge contract already deployed on L2, referenced by the retryable instead of its bytecode.
+ */
+struct L2DeployedTemplate {
+    address target;
+    bytes32 codeHash;
+}
+
+/**
+ * Placeholder for templates of token bridge contracts which already exist on L2, replacing L2RuntimeCode.
+ */
+struct L2DeployedTemplates {
+    L2DeployedTemplate router;
+    L2DeployedTemplate standardGateway;
+    L2DeployedTemplate customGateway;
+    L2DeployedTemplate wethGateway;
+    L2DeployedTemplate aeWeth;
+    L2DeployedTemplate upgradeExecutor;
+    L2DeployedTemplate multicall;
+}
+
+/**
+ * Creation code of the logic contracts, built from either L2RuntimeCode or L2DeployedTemplates.
+ */
+struct L2CreationCode {
+    bytes router;
+    bytes standardGateway;
+    bytes customGateway;
+    bytes wethGateway;
+    bytes aeWeth;
+    bytes upgradeExecutor;
+    bytes multicall;
+}
+
 /**
  * Collection of salts used in CREATE2 deployment of L2 token bridge contracts.
  * Logic contracts are deployed using the same salt as the proxy, it's fine as they have different code
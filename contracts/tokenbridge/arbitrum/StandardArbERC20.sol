@@ -20,7 +20,7 @@ pragma solidity ^0.8.0;
 
 import "../libraries/Cloneable.sol";
 import "../libraries/L2GatewayToken.sol";
-import "../libraries/BytesParser.sol";
+import "../libraries/TokenMetadataCodec.sol";
 import "./IArbToken.sol";
 
 /**
@@ -38,27 +38,24 @@ contract StandardArbERC20 is IArbToken, L2GatewayToken, Cloneable {
      * @notice initialize the token
      * @dev the L2 bridge assumes this does not fail or revert
      * @param _l1Address L1 address of ERC20
-     * @param _data encoded symbol/name/decimal data for initial deploy
+     * @param _data encoded symbol/name/decimal data for initial deploy, see TokenMetadataCodec
      */
     function bridgeInit(address _l1Address, bytes memory _data) public virtual {
-        (bytes memory name_, bytes memory symbol_, bytes memory decimals_) = abi.decode(
-            _data,
-            (bytes, bytes, bytes)
-        );
-        // what if decode reverts? shouldn't as this is encoded by L1 contract
-
         /*
          *  if parsing fails, the type's default value gets assigned
          *  the parsing can fail for different reasons:
          *      1. method not available in L1 (empty input)
          *      2. data type is encoded differently in the L1 (trying to abi decode the wrong data type)
-         *  currently (1) returns a parser fails and (2) reverts as there is no `abi.tryDecode`
-         *  https://github.com/ethereum/solidity/issues/10381
+         *  both are reported as a parser fail, the codec checks abi encoded strings instead of reverting
          */
-
-        (bool parseNameSuccess, string memory parsedName) = BytesParser.toString(name_);
-        (bool parseSymbolSuccess, string memory parsedSymbol) = BytesParser.toString(symbol_);
-        (bool parseDecimalSuccess, uint8 parsedDecimals) = BytesParser.toUint8(decimals_);
+        (
+            bool parseNameSuccess,
+            string memory parsedName,
+            bool parseSymbolSuccess,
+            string memory parsedSymbol,
+            bool parseDecimalSuccess,
+            uint8 parsedDecimals
+        ) = TokenMetadataCodec.decode(_data);
 
         L2GatewayToken._initialize(
             parsedName,
@@ -68,7 +65,7 @@ contract StandardArbERC20 is IArbToken, L2GatewayToken, Cloneable {
             _l1Address // _l1Counterpart
         );
 
-        // here we assume that (2) would have reverted, so if the parser failed its because the getter isn't available in the L1.
+        // if the parser failed we assume its because the getter isn't available in the L1.
         // instead of storing on a struct, we could instead set a magic number, at something like `type(uint8).max` or random string
         // to be more general we instead use an extra storage slot
         availableGetters = ERC20Getters({
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "../libraries/Cloneable.sol";
+import "../libraries/aeERC20.sol";
+import "../libraries/TokenMetadataCodec.sol";
+import "./IArbToken.sol";
+
+/**
+ * @title Standard L2 ERC20 deployed by L2ERC20Gateway, same interface as StandardArbERC20 with a packed storage layout
+ * @dev The gateway is packed with isMasterCopy, so the onlyGateway check of bridgeMint/bridgeBurn is a single SLOAD.
+ * Metadata is stored inline in the ShortString style, with the length in the last byte:
+ *      packedName      name (up to 31 bytes) | name length + 1
+ *      packedSymbol    symbol (up to 29 bytes) | decimals | unavailable getters | symbol length + 1
+ * so name(), symbol() and decimals() are each a single SLOAD. A zero length byte means the value was too long
+ * to be packed, and is stored in ERC20Upgradeable as in StandardArbERC20.
+ * The layout is incompatible with StandardArbERC20, so this is only meant to be the implementation of beacons which
+ * haven't deployed any token yet, ie. the beacon of a new chain, before its first deposit.
+ */
+contract StandardArbERC20V2 is IArbToken, aeERC20, Cloneable {
+    // packed with isMasterCopy of Cloneable
+    address public l2Gateway;
+    address public override l1Address;
+    bytes32 private packedName;
+    bytes32 private packedSymbol;
+
+    uint256 private constant MAX_NAME_LENGTH = 31;
+    uint256 private constant MAX_SYMBOL_LENGTH = 29;
+    uint256 private constant DECIMALS_OFFSET = 16;
+    uint256 private constant IGNORED_GETTERS_OFFSET = 8;
+
+    uint256 private constant IGNORE_NAME = 1 << 0;
+    uint256 private constant IGNORE_SYMBOL = 1 << 1;
+    uint256 private constant IGNORE_DECIMALS = 1 << 2;
+
+    modifier onlyGateway() {
+        require(msg.sender == l2Gateway, "ONLY_GATEWAY");
+        _;
+    }
+
+    /**
+     * @notice initialize the token
+     * @dev the L2 bridge assumes this does not fail or revert
+     * @param _l1Address L1 address of ERC20
+     * @param _data encoded symbol/name/decimal data for initial deploy, see TokenMetadataCodec
+     */
+    function bridgeInit(address _l1Address, bytes memory _data) public virtual {
+        require(l2Gateway == address(0), "ALREADY_INIT");
+
+        // if parsing fails the getter isn't available in the L1, and the type's default value gets assigned
+        (
+            bool parseNameSuccess,
+            string memory parsedName,
+            bool parseSymbolSuccess,
+            string memory parsedSymbol,
+            bool parseDecimalSuccess,
+            uint8 parsedDecimals
+        ) = TokenMetadataCodec.decode(_data);
+
+        l2Gateway = msg.sender;
+        l1Address = _l1Address;
+
+        uint256 ignoredGetters = (parseNameSuccess ? 0 : IGNORE_NAME) |
+            (parseSymbolSuccess ? 0 : IGNORE_SYMBOL) |
+            (parseDecimalSuccess ? 0 : IGNORE_DECIMALS);
+        bytes32 symbolSlot = bytes32(
+            (uint256(parsedDecimals) << DECIMALS_OFFSET) |
+                (ignoredGetters << IGNORED_GETTERS_OFFSET)
+        );
+        string memory longName;
+        string memory longSymbol;
+        if (bytes(parsedName).length <= MAX_NAME_LENGTH) {
+            packedName = _pack(parsedName);
+        } else {
+            longName = parsedName;
+        }
+        if (bytes(parsedSymbol).length <= MAX_SYMBOL_LENGTH) {
+            symbolSlot |= _pack(parsedSymbol);
+        } else {
+            longSymbol = parsedSymbol;
+        }
+        packedSymbol = symbolSlot;
+        aeERC20._initializePermit(parsedName, longName, longSymbol);
+    }
+
+    /**
+     * @notice Mint tokens on L2. Callable path is L1Gateway depositToken (which handles L1 escrow), which triggers L2Gateway, which calls this
+     * @param account recipient of tokens
+     * @param amount amount of tokens minted
+     */
+    function bridgeMint(address account, uint256 amount) external virtual override onlyGateway {
+        _mint(account, amount);
+    }
+
+    /**
+     * @notice Burn tokens on L2.
+     * @dev only the token bridge can call this
+     * @param account owner of tokens
+     * @param amount amount of tokens burnt
+     */
+    function bridgeBurn(address account, uint256 amount) external virtual override onlyGateway {
+        _burn(account, amount);
+    }
+
+    function decimals() public view override returns (uint8) {
+        uint256 symbolSlot = uint256(packedSymbol);
+        // no revert message just as in the L1 if you called and the function is not implemented
+        if ((symbolSlot >> IGNORED_GETTERS_OFFSET) & IGNORE_DECIMALS != 0) revert();
+        return uint8(symbolSlot >> DECIMALS_OFFSET);
+    }
+
+    function name() public view override returns (string memory) {
+        bytes32 nameSlot = packedName;
+        if (uint8(uint256(nameSlot)) == 0) {
+            return super.name();
+        }
+        // unavailable getters are stored empty
+        if (
+            uint8(uint256(nameSlot)) == 1 &&
+            (uint256(packedSymbol) >> IGNORED_GETTERS_OFFSET) & IGNORE_NAME != 0
+        ) revert();
+        return _unpack(nameSlot);
+    }
+
+    function symbol() public view override returns (string memory) {
+        bytes32 symbolSlot = packedSymbol;
+        if ((uint256(symbolSlot) >> IGNORED_GETTERS_OFFSET) & IGNORE_SYMBOL != 0) revert();
+        if (uint8(uint256(symbolSlot)) == 0) {
+            return super.symbol();
+        }
+        return _unpack(symbolSlot);
+    }
+
+    /// @dev `_str` left aligned, with its length plus one in the last byte
+    function _pack(string memory _str) private pure returns (bytes32) {
+        return bytes32(bytes(_str)) | bytes32(bytes(_str).length + 1);
+    }
+
+    function _unpack(bytes32 _packed) private pure returns (string memory str) {
+        uint256 length = uint8(uint256(_packed)) - 1;
+        str = new string(length);
+        if (length != 0) {
+            // only keep the string, not the other fields of the slot
+            bytes32 data = _packed & ~bytes32(type(uint256).max >> (length * 8));
+            assembly {
+                mstore(add(str, 0x20), data)
+            }
+        }
+    }
+}
@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "../../libraries/gateway/ITokenGateway.sol";
+
+/**
+ * @title Common interface for gateways on Arbitrum receiving messages from L1.
+ * @dev Lets L1 contracts encode calls to L2 gateways without depending on their implementation
+ */
+interface IL2ArbitrumGateway is ITokenGateway {
+    /**
+     * @notice Mint on L2 upon a batched L1 deposit, each token is handled as in finalizeInboundTransfer.
+     * @param _tokens L1 addresses of ERC20s
+     * @param _from account that initiated the deposit in the L1
+     * @param _to accounts to be credited with the tokens in the L2 (can be user L2 accounts or contracts)
+     * @param _amounts token amounts to be minted to the users
+     * @param _data per token encoded symbol/name/decimal data for deploy, in addition to any additional callhook data
+     */
+    function finalizeInboundTransferBatch(
+        address[] calldata _tokens,
+        address _from,
+        address[] calldata _to,
+        uint256[] calldata _amounts,
+        bytes[] calldata _data
+    ) external payable;
+}
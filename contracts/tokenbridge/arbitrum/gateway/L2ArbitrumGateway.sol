@@ -24,19 +24,30 @@ import "../../libraries/BytesLib.sol";
 import "../../libraries/ProxyUtil.sol";
 
 import "../IArbToken.sol";
+import "../IDepositHookReceiver.sol";
 
 import "../L2ArbitrumMessenger.sol";
 import "../../libraries/gateway/GatewayMessageHandler.sol";
 import "../../libraries/gateway/TokenGateway.sol";
+import "../../libraries/ERC165.sol";
+import "./IL2ArbitrumGateway.sol";
 
 /**
  * @title Common interface for gatways on Arbitrum messaging to L1.
  */
-abstract contract L2ArbitrumGateway is L2ArbitrumMessenger, TokenGateway {
+abstract contract L2ArbitrumGateway is
+    L2ArbitrumMessenger,
+    TokenGateway,
+    ERC165,
+    IL2ArbitrumGateway
+{
     using Address for address;
 
     uint256 public exitNum;
 
+    /// @dev gas left to the deposit after the post deposit hook returns
+    uint256 internal constant DEPOSIT_HOOK_RESERVED_GAS = 30_000;
+
     event DepositFinalized(
         address indexed l1Token,
         address indexed _from,
@@ -44,6 +55,22 @@ abstract contract L2ArbitrumGateway is L2ArbitrumMessenger, TokenGateway {
         uint256 _amount
     );
 
+    /**
+     * @notice Emitted along with DepositFinalized. The message hash is keccak256 of the retryable's calldata, same as
+     * emitted by the L1 gateway in DepositMessageSent, so deposits can be matched on both sides from logs only.
+     */
+    event DepositMessageFinalized(
+        address indexed l1Token,
+        bytes32 indexed _messageHash,
+        address _l2Token
+    );
+
+    /**
+     * @notice Emitted after DepositFinalized if the deposit came with a post deposit hook, `_success` is false if the
+     * hook reverted or `_to` has no code. Deposited tokens are credited to `_to` in both cases.
+     */
+    event DepositHookExecuted(address indexed l1Token, address indexed _to, bool _success);
+
     event WithdrawalInitiated(
         address l1Token,
         address indexed _from,
@@ -149,11 +176,18 @@ abstract contract L2ArbitrumGateway is L2ArbitrumMessenger, TokenGateway {
         address _from;
         bytes memory _extraData;
         {
-            if (isRouter(msg.sender)) {
-                (_from, _extraData) = GatewayMessageHandler.parseFromRouterToGateway(_data);
-            } else {
+            if (!isRouter(msg.sender)) {
                 _from = msg.sender;
                 _extraData = _data;
+            } else {
+                (_from, _extraData) = GatewayMessageHandler.parseFromRouter(
+                    _data,
+                    isRouter(msg.sender)
+                );
+                if (GatewayMessageHandler.isPackedUserData(_extraData)) {
+                    // packed user data only holds the call hook data after its version
+                    _extraData = BytesLib.slice(_extraData, 1, _extraData.length - 1);
+                }
             }
         }
         // the inboundEscrowAndCall functionality has been disabled, so no data is allowed
@@ -231,43 +265,131 @@ abstract contract L2ArbitrumGateway is L2ArbitrumMessenger, TokenGateway {
         uint256 _amount,
         bytes calldata _data
     ) external payable override onlyCounterpartGateway {
-        (bytes memory gatewayData, bytes memory callHookData) = GatewayMessageHandler
-            .parseFromL1GatewayMsg(_data);
+        _finalizeInboundTransfer(_token, _from, _to, _amount, _data, keccak256(msg.data));
+    }
 
-        if (callHookData.length != 0) {
-            // callHookData should always be 0 since inboundEscrowAndCall is disabled
-            callHookData = bytes("");
+    /**
+     * @notice Mint on L2 upon a batched L1 deposit, each token is handled as in finalizeInboundTransfer.
+     * @dev Callable only by the L1 gateway's outboundTransferBatchCustomRefund method. The L2 call value of the
+     * retryable is expected to cover the sum of all amounts for gateways that escrow ether (ie weth)
+     * @param _tokens L1 addresses of ERC20s
+     * @param _from account that initiated the deposit in the L1
+     * @param _to accounts to be credited with the tokens in the L2 (can be user L2 accounts or contracts)
+     * @param _amounts token amounts to be minted to the users
+     * @param _data per token encoded symbol/name/decimal data for deploy, in addition to any additional callhook data
+     */
+    function finalizeInboundTransferBatch(
+        address[] calldata _tokens,
+        address _from,
+        address[] calldata _to,
+        uint256[] calldata _amounts,
+        bytes[] calldata _data
+    ) external payable override onlyCounterpartGateway {
+        require(
+            _tokens.length == _to.length &&
+                _tokens.length == _amounts.length &&
+                _tokens.length == _data.length,
+            "WRONG_LENGTH"
+        );
+        // all tokens of the batch were sent in the same message
+        bytes32 messageHash = keccak256(msg.data);
+        for (uint256 i = 0; i < _tokens.length; i++) {
+            _finalizeInboundTransfer(_tokens[i], _from, _to[i], _amounts[i], _data[i], messageHash);
         }
+    }
 
-        address expectedAddress = calculateL2TokenAddress(_token);
+    function _finalizeInboundTransfer(
+        address _token,
+        address _from,
+        address _to,
+        uint256 _amount,
+        bytes calldata _data,
+        bytes32 _messageHash
+    ) internal {
+        (bytes memory gatewayData, bytes memory callHookData) = GatewayMessageHandler
+            .parseFromL1GatewayMsg(_data);
 
-        if (!expectedAddress.isContract()) {
-            bool shouldHalt = handleNoContract(
-                _token,
-                expectedAddress,
-                _from,
-                _to,
-                _amount,
-                gatewayData
-            );
-            if (shouldHalt) return;
-        }
+        // tokens which already passed the checks below don't need to be checked again
+        address expectedAddress = _getValidatedL2Token(_token);
+
+        if (expectedAddress == address(0)) {
+            expectedAddress = calculateL2TokenAddress(_token);
+
+            if (!expectedAddress.isContract()) {
+                bool shouldHalt = handleNoContract(
+                    _token,
+                    expectedAddress,
+                    _from,
+                    _to,
+                    _amount,
+                    gatewayData
+                );
+                if (shouldHalt) return;
+            }
+
+            // validate if L1 address supplied matches that of the expected L2 address
+            bool shouldWithdraw = !_isValidTokenAddress(_token, expectedAddress);
+            if (shouldWithdraw) {
+                // we don't need the return value from triggerWithdrawal since this is forcing
+                // a withdrawal back to the L1 instead of composing with a L2 dapp
+                triggerWithdrawal(_token, address(this), _from, _amount, "");
+                return;
+            }
 
-        // validate if L1 address supplied matches that of the expected L2 address
-        bool shouldWithdraw = !_isValidTokenAddress(_token, expectedAddress);
-        if (shouldWithdraw) {
-            // we don't need the return value from triggerWithdrawal since this is forcing
-            // a withdrawal back to the L1 instead of composing with a L2 dapp
-            triggerWithdrawal(_token, address(this), _from, _amount, "");
-            return;
+            _setValidatedL2Token(_token, expectedAddress);
         }
 
         inboundEscrowTransfer(expectedAddress, _to, _amount);
         emit DepositFinalized(_token, _from, _to, _amount);
+        emit DepositMessageFinalized(_token, _messageHash, expectedAddress);
 
+        // the inboundEscrowAndCall functionality has been disabled, only post deposit hooks are called
+        if (GatewayMessageHandler.isDepositHook(callHookData)) {
+            _executeDepositHook(_token, expectedAddress, _from, _to, _amount, callHookData);
+        }
         return;
     }
 
+    /**
+     * @notice Call the post deposit hook on `_to`, which already holds the deposited tokens
+     * @dev Reverts if the hook can't get its whole gas limit, so the retryable can be redeemed again with more gas.
+     * A revert of the hook is ignored and its return data is not copied, so the hook can't make the deposit fail.
+     */
+    function _executeDepositHook(
+        address _l1Token,
+        address _l2Token,
+        address _from,
+        address _to,
+        uint256 _amount,
+        bytes memory _callHookData
+    ) internal {
+        bool success;
+        if (_to.isContract()) {
+            (uint256 gasLimit, bytes memory hookData) = GatewayMessageHandler.parseDepositHook(
+                _callHookData
+            );
+            bytes memory hookCall = abi.encodeWithSelector(
+                IDepositHookReceiver.onDepositFinalized.selector,
+                _l1Token,
+                _l2Token,
+                _from,
+                _amount,
+                hookData
+            );
+
+            // only 63/64 of the gas left is forwarded to the call
+            require(
+                gasleft() >= (gasLimit * 64) / 63 + DEPOSIT_HOOK_RESERVED_GAS,
+                "INSUFFICIENT_HOOK_GAS"
+            );
+            // solhint-disable-next-line no-inline-assembly
+            assembly {
+                success := call(gasLimit, _to, 0, add(hookCall, 0x20), mload(hookCall), 0, 0)
+            }
+        }
+        emit DepositHookExecuted(_l1Token, _to, success);
+    }
+
     // returns if function should halt after
     function handleNoContract(
         address _l1Token,
@@ -278,6 +400,21 @@ abstract contract L2ArbitrumGateway is L2ArbitrumMessenger, TokenGateway {
         bytes memory gatewayData
     ) internal virtual returns (bool shouldHalt);
 
+    /**
+     * @notice Get the L2 token already validated for `_l1Token` in a deposit, or address(0) if none
+     * @dev only gateways whose L2 token address can't change for a given L1 token should record them
+     */
+    function _getValidatedL2Token(
+        address /* _l1Token */
+    ) internal view virtual returns (address) {
+        return address(0);
+    }
+
+    function _setValidatedL2Token(
+        address, /* _l1Token */
+        address /* _l2Token */
+    ) internal virtual {}
+
     /**
      * @notice Check if expected token address matches the provided one
      * @param _l1Address provided address of L1 token
@@ -307,4 +444,11 @@ abstract contract L2ArbitrumGateway is L2ArbitrumMessenger, TokenGateway {
 
         return true;
     }
+
+    function supportsInterface(bytes4 interfaceId) public view virtual override returns (bool) {
+        // the router appends the sender to withdrawals with packed user data, see GatewayMessageHandler
+        return
+            interfaceId == GatewayMessageHandler.APPENDED_SENDER_INTERFACE_ID ||
+            super.supportsInterface(interfaceId);
+    }
 }
\ No newline at end of file
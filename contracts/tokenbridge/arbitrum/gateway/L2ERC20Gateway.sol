@@ -23,10 +23,40 @@ import "@openzeppelin/contracts/utils/Create2.sol";
 import "./L2ArbitrumGateway.sol";
 import "../StandardArbERC20.sol";
 import "../../libraries/ClonableBeaconProxy.sol";
+import { L1ERC20Gateway } from "../../ethereum/gateway/L1ERC20Gateway.sol";
 
 contract L2ERC20Gateway is L2ArbitrumGateway {
+    using Address for address;
+
     address public beaconProxyFactory;
 
+    struct QueuedWithdrawal {
+        address from;
+        // exit numbers are sequential, so they fit in the rest of the slot used by `from`
+        uint96 exitNum;
+        address to;
+        uint256 amount;
+    }
+
+    // withdrawals waiting to be sent to L1 in a single message, by L1 token. Entries before
+    // withdrawalQueueHead were sent and are cleared, the queue starts over once all of them are sent
+    mapping(address => QueuedWithdrawal[]) public withdrawalQueue;
+
+    // L2 tokens already validated in a deposit, by L1 token. These addresses are determined by the
+    // beacon proxy factory, so they can't change and later deposits skip the validation
+    mapping(address => address) public validatedL2Token;
+
+    // index in withdrawalQueue of the oldest withdrawal not sent to L1 yet, by L1 token
+    mapping(address => uint256) public withdrawalQueueHead;
+
+    event WithdrawalQueued(
+        address l1Token,
+        address indexed _from,
+        address indexed _to,
+        uint256 indexed _exitNum,
+        uint256 _amount
+    );
+
     function initialize(
         address _l1Counterpart,
         address _router,
@@ -59,12 +89,145 @@ contract L2ERC20Gateway is L2ArbitrumGateway {
             );
     }
 
+    function _getValidatedL2Token(address _l1Token) internal view override returns (address) {
+        return validatedL2Token[_l1Token];
+    }
+
+    function _setValidatedL2Token(address _l1Token, address _l2Token) internal override {
+        validatedL2Token[_l1Token] = _l2Token;
+    }
+
     function cloneableProxyHash() public view returns (bytes32) {
         return BeaconProxyFactory(beaconProxyFactory).cloneableProxyHash();
     }
 
     function getUserSalt(address l1ERC20) public pure returns (bytes32) {
-        return keccak256(abi.encode(l1ERC20));
+        return L2TokenAddress.getUserSalt(l1ERC20);
+    }
+
+    /**
+     * @notice Reports to the L1 gateway that the L2 tokens of `_l1Tokens` are deployed, so later deposits can skip the deploy data
+     * @dev permissionless as every token is checked to be deployed by this gateway. The report is executed on L1
+     * through the outbox like a withdrawal, so it is worth batching many tokens in one call.
+     * @param _l1Tokens L1 addresses of ERC20s
+     * @return id unique identifier of the L2 to L1 message
+     */
+    function reportDeployedTokens(address[] calldata _l1Tokens) external returns (uint256) {
+        for (uint256 i = 0; i < _l1Tokens.length; i++) {
+            address l2Token = calculateL2TokenAddress(_l1Tokens[i]);
+            require(l2Token.isContract(), "TOKEN_NOT_DEPLOYED");
+            require(_isValidTokenAddress(_l1Tokens[i], l2Token), "NOT_EXPECTED_L1_TOKEN");
+        }
+
+        return
+            sendTxToL1(
+                0,
+                msg.sender,
+                counterpartGateway,
+                abi.encodeWithSelector(
+                    L1ERC20Gateway.confirmL2TokenDeployments.selector,
+                    _l1Tokens
+                )
+            );
+    }
+
+    /**
+     * @notice Burns the L2 tokens and queues the withdrawal, to be sent to L1 together with other withdrawals of the same token
+     * @dev the exit number is assigned now, so the withdrawal can be redirected on L1 as usual. Nothing is sent
+     * to L1 until flushWithdrawals is called for the token, which is worth it for accounts making many small withdrawals.
+     * @param _l1Token l1 address of token
+     * @param _to destination address
+     * @param _amount amount of tokens withdrawn
+     * @return exit number of the queued withdrawal
+     */
+    function queueWithdrawal(
+        address _l1Token,
+        address _to,
+        uint256 _amount
+    ) external returns (uint256) {
+        address l2Token = calculateL2TokenAddress(_l1Token);
+        require(l2Token.isContract(), "TOKEN_NOT_DEPLOYED");
+        require(_isValidTokenAddress(_l1Token, l2Token), "NOT_EXPECTED_L1_TOKEN");
+
+        _amount = outboundEscrowTransfer(l2Token, msg.sender, _amount);
+
+        uint256 currExitNum = exitNum++;
+        withdrawalQueue[_l1Token].push(
+            QueuedWithdrawal(msg.sender, uint96(currExitNum), _to, _amount)
+        );
+        emit WithdrawalQueued(_l1Token, msg.sender, _to, currExitNum, _amount);
+        return currExitNum;
+    }
+
+    /**
+     * @notice Sends up to `_maxCount` queued withdrawals of `_l1Token` to L1 in a single message
+     * @dev permissionless. The L1 gateway settles the whole batch in one finalizeWithdrawalBatch call,
+     * so a single outbox execution pays out every withdrawal. Withdrawals are sent in the order they were
+     * queued, so the oldest ones always go first whatever the `_maxCount` and later withdrawals.
+     * @param _l1Token l1 address of token
+     * @param _maxCount maximum number of withdrawals to send, bounds the L1 execution cost
+     * @return id unique identifier of the L2 to L1 message
+     */
+    function flushWithdrawals(address _l1Token, uint256 _maxCount) external returns (uint256 id) {
+        address[] memory from;
+        address[] memory to;
+        uint256[] memory amounts;
+        uint256[] memory exitNums;
+        {
+            QueuedWithdrawal[] storage queue = withdrawalQueue[_l1Token];
+            uint256 head = withdrawalQueueHead[_l1Token];
+            if (queue.length - head < _maxCount) _maxCount = queue.length - head;
+            require(_maxCount != 0, "NO_QUEUED_WITHDRAWALS");
+
+            from = new address[](_maxCount);
+            to = new address[](_maxCount);
+            amounts = new uint256[](_maxCount);
+            exitNums = new uint256[](_maxCount);
+            for (uint256 i = 0; i < _maxCount; i++) {
+                QueuedWithdrawal memory withdrawal = queue[head + i];
+                // sent entries are cleared for the refund
+                delete queue[head + i];
+                from[i] = withdrawal.from;
+                to[i] = withdrawal.to;
+                amounts[i] = withdrawal.amount;
+                exitNums[i] = withdrawal.exitNum;
+            }
+            if (head + _maxCount == queue.length) {
+                // every entry is already cleared, so only the length and the head are reset
+                assembly {
+                    sstore(queue.slot, 0)
+                }
+                delete withdrawalQueueHead[_l1Token];
+            } else {
+                withdrawalQueueHead[_l1Token] = head + _maxCount;
+            }
+        }
+
+        id = sendTxToL1(
+            0,
+            msg.sender,
+            counterpartGateway,
+            abi.encodeWithSelector(
+                L1ERC20Gateway.finalizeWithdrawalBatch.selector,
+                _l1Token,
+                from,
+                to,
+                amounts,
+                exitNums
+            )
+        );
+
+        for (uint256 i = 0; i < _maxCount; i++) {
+            emit WithdrawalInitiated(_l1Token, from[i], to[i], id, exitNums[i], amounts[i]);
+        }
+    }
+
+    /**
+     * @notice number of queued withdrawals of `_l1Token` not sent to L1 yet
+     * @dev counted from withdrawalQueueHead, withdrawalQueue also holds the cleared entries before it
+     */
+    function queuedWithdrawalsCount(address _l1Token) external view returns (uint256) {
+        return withdrawalQueue[_l1Token].length - withdrawalQueueHead[_l1Token];
     }
 
     /**
@@ -48,7 +48,7 @@ contract L2GatewayRouter is GatewayRouter, L2ArbitrumMessenger {
         assert(_l1Token.length == _gateway.length);
 
         for (uint256 i = 0; i < _l1Token.length; i++) {
-            l1TokenToGateway[_l1Token[i]] = _gateway[i];
+            _setGatewayEntry(_l1Token[i], _gateway[i]);
             emit GatewaySet(_l1Token[i], _gateway[i]);
         }
     }
@@ -63,7 +63,7 @@ contract L2GatewayRouter is GatewayRouter, L2ArbitrumMessenger {
     }
 
     function setDefaultGateway(address newL2DefaultGateway) external onlyCounterpartGateway {
-        defaultGateway = newL2DefaultGateway;
+        _setDefaultGatewayEntry(newL2DefaultGateway);
         emit DefaultGatewayUpdated(newL2DefaultGateway);
     }
 }
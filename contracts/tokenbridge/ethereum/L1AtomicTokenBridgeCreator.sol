@@ -19,13 +19,17 @@ import {L1WethGateway} from "./gateway/L1WethGateway.sol";
 import {L1OrbitGatewayRouter} from "./gateway/L1OrbitGatewayRouter.sol";
 import {L1OrbitERC20Gateway} from "./gateway/L1OrbitERC20Gateway.sol";
 import {L1OrbitCustomGateway} from "./gateway/L1OrbitCustomGateway.sol";
+import {IL1ImmutableGatewayDeployer} from "./L1ImmutableGatewayDeployer.sol";
 import {
     L2AtomicTokenBridgeFactory,
     OrbitSalts,
     L2RuntimeCode,
+    L2DeployedTemplate,
+    L2DeployedTemplates,
     ProxyAdmin
 } from "../arbitrum/L2AtomicTokenBridgeFactory.sol";
 import {CreationCodeHelper} from "../libraries/CreationCodeHelper.sol";
+import {FeeTokenScaling} from "../libraries/FeeTokenScaling.sol";
 import {
     IUpgradeExecutor,
     UpgradeExecutor
@@ -33,7 +37,10 @@ import {
 import {AddressAliasHelper} from "../libraries/AddressAliasHelper.sol";
 import {IInbox, IBridge, IOwnable} from "@arbitrum/nitro-contracts/src/bridge/IInbox.sol";
 import {ArbMulticall2} from "../../rpc-utils/MulticallV2.sol";
-import {BeaconProxyFactory, ClonableBeaconProxy} from "../libraries/ClonableBeaconProxy.sol";
+import {
+    MinimalBeaconProxyFactory,
+    MinimalBeaconProxy
+} from "../libraries/ClonableBeaconProxy.sol";
 import {Create2} from "@openzeppelin/contracts/utils/Create2.sol";
 import {
     Initializable,
@@ -57,6 +64,7 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
     error L1AtomicTokenBridgeCreator_RollupOwnershipMisconfig();
     error L1AtomicTokenBridgeCreator_ProxyAdminNotFound();
     error L1AtomicTokenBridgeCreator_L2FactoryCannotBeChanged();
+    error L1AtomicTokenBridgeCreator_L2DeployedTemplatesNotSet();
 
     event OrbitTokenBridgeCreated(
         address indexed inbox,
@@ -67,6 +75,11 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
         address upgradeExecutor
     );
     event OrbitTokenBridgeTemplatesUpdated();
+    event OrbitTokenBridgeGatewayDeployersUpdated();
+    event OrbitTokenBridgeL2DeployedTemplatesUpdated();
+    event OrbitTokenBridgeL2DeployedTemplatesUsed(
+        address indexed inbox, bool useL2DeployedTemplates
+    );
     event OrbitTokenBridgeDeploymentSet(
         address indexed inbox, L1DeploymentAddresses l1, L2DeploymentAddresses l2
     );
@@ -117,6 +130,16 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
     // other canonical addresses (dependent on L2 template implementations) can be fetched through `_predictL2***Address` functions
     address public canonicalL2FactoryAddress;
 
+    // if set, every token bridge gets its own L1 standard gateway logic, with the chain's config in immutables,
+    // instead of sharing the standard gateway templates
+    IL1ImmutableGatewayDeployer public standardGatewayDeployer;
+    IL1ImmutableGatewayDeployer public feeTokenBasedStandardGatewayDeployer;
+
+    // L2 templates already deployed on child chains, at the same addresses on all of them. Token bridges of chains
+    // which opted in are deployed from those, so the retryable doesn't carry the templates' bytecode
+    L2TemplateAddresses public l2DeployedTemplates;
+    mapping(address => bool) public inboxToUseL2DeployedTemplates;
+
     constructor() {
         _disableInitializers();
     }
@@ -174,6 +197,53 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
         emit OrbitTokenBridgeTemplatesUpdated();
     }
 
+    /**
+     * @notice Set deployers of the L1 standard gateway logic contracts dedicated to a single chain.
+     * @dev Those save the storage reads of the counterpart gateway, router and inbox on every deposit and
+     *      withdrawal. Setting a deployer to address(0) makes new token bridges use the shared template again.
+     */
+    function setGatewayDeployers(
+        IL1ImmutableGatewayDeployer _standardGatewayDeployer,
+        IL1ImmutableGatewayDeployer _feeTokenBasedStandardGatewayDeployer
+    ) external onlyOwner {
+        standardGatewayDeployer = _standardGatewayDeployer;
+        feeTokenBasedStandardGatewayDeployer = _feeTokenBasedStandardGatewayDeployer;
+
+        emit OrbitTokenBridgeGatewayDeployersUpdated();
+    }
+
+    /**
+     * @notice Set addresses of the L2 templates already deployed on child chains.
+     * @dev Templates must have the same code as the L2 templates deployed on L1, which is checked on L2 against
+     *      their code hashes. They are expected to be deployed at the same addresses on every child chain, ie.
+     *      through a deterministic deployment proxy. WETH templates are only needed by ETH-based chains.
+     */
+    function setL2DeployedTemplates(L2TemplateAddresses calldata _l2DeployedTemplates)
+        external
+        onlyOwner
+    {
+        l2DeployedTemplates = _l2DeployedTemplates;
+
+        emit OrbitTokenBridgeL2DeployedTemplatesUpdated();
+    }
+
+    /**
+     * @notice Rollup owner can choose to deploy the L2 side of token bridge from the L2 deployed templates
+     * @dev Templates have to exist on the child chain when the retryable is executed, otherwise it reverts and can be
+     *      redeemed once they are deployed.
+     */
+    function setUseL2DeployedTemplates(address inbox, bool useL2DeployedTemplates) external {
+        if (msg.sender != IInbox(inbox).bridge().rollup().owner()) {
+            revert L1AtomicTokenBridgeCreator_OnlyRollupOwner();
+        }
+        if (useL2DeployedTemplates && l2DeployedTemplates.routerTemplate == address(0)) {
+            revert L1AtomicTokenBridgeCreator_L2DeployedTemplatesNotSet();
+        }
+
+        inboxToUseL2DeployedTemplates[inbox] = useL2DeployedTemplates;
+        emit OrbitTokenBridgeL2DeployedTemplatesUsed(inbox, useL2DeployedTemplates);
+    }
+
     /**
      * @notice Deploy and initialize token bridge, both L1 and L2 sides, as part of a single TX.
      * @dev This is a single entrypoint of L1 token bridge creator. Function deploys L1 side of token bridge and then uses
@@ -267,9 +337,13 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
 
             // l1 standard gateway deployment block
             {
-                address template = feeToken != address(0)
-                    ? address(l1Templates.feeTokenBasedStandardGatewayTemplate)
-                    : address(l1Templates.standardGatewayTemplate);
+                address template = _getStandardGatewayLogic(
+                    inbox,
+                    feeToken,
+                    l1Deployment.router,
+                    l2Deployment.standardGateway,
+                    l2Deployment.beaconProxyFactory
+                );
 
                 L1ERC20Gateway standardGateway = L1ERC20Gateway(
                     _deployProxyWithSalt(
@@ -281,7 +355,7 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
                     l2Deployment.standardGateway,
                     l1Deployment.router,
                     inbox,
-                    keccak256(type(ClonableBeaconProxy).creationCode),
+                    keccak256(type(MinimalBeaconProxy).creationCode),
                     l2Deployment.beaconProxyFactory
                 );
 
@@ -337,10 +411,6 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
             );
         }
 
-        // deploy factory and then L2 contracts through L2 factory, using 2 retryables calls
-        // we do not care if it is a resend or not, if the L2 deployment already exists it will simply fail on L2
-        _deployL2Factory(inbox, gasPriceBid, feeToken);
-
         RetryableParams memory retryableParams = RetryableParams(
             inbox,
             canonicalL2FactoryAddress,
@@ -351,13 +421,28 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
             0
         );
 
+        // deploy factory and then L2 contracts through L2 factory, using 2 retryables calls
+        // we do not care if it is a resend or not, if the L2 deployment already exists it will simply fail on L2
         if (feeToken != address(0)) {
+            // fee token decimals are read once to scale the fees of both retryables
+            uint8 feeTokenDecimals = ERC20(feeToken).decimals();
+            _deployL2Factory(
+                inbox,
+                gasPriceBid,
+                feeToken,
+                FeeTokenScaling.scaleAmount(
+                    gasLimitForL2FactoryDeployment * gasPriceBid, feeTokenDecimals
+                )
+            );
+
             // transfer fee tokens to inbox to pay for 2nd retryable
             retryableParams.feeTokenTotalFeeAmount =
-                _getScaledAmount(feeToken, maxGasForContracts * gasPriceBid);
+                FeeTokenScaling.scaleAmount(maxGasForContracts * gasPriceBid, feeTokenDecimals);
             IERC20(feeToken).safeTransferFrom(
                 msg.sender, inbox, retryableParams.feeTokenTotalFeeAmount
             );
+        } else {
+            _deployL2Factory(inbox, gasPriceBid, address(0), 0);
         }
 
         L2TemplateAddresses memory l2TemplateAddress = L2TemplateAddresses(
@@ -405,6 +490,21 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
         address l2RollupOwner,
         address upgradeExecutor
     ) internal {
+        if (inboxToUseL2DeployedTemplates[retryableParams.inbox]) {
+            retryableSender.sendRetryableUsingL2Templates{
+                value: retryableParams.feeTokenTotalFeeAmount > 0 ? 0 : address(this).balance
+            }(
+                retryableParams,
+                _getL2DeployedTemplates(l2TemplateAddress),
+                l1Deployment,
+                l2Deployment.standardGateway,
+                l2RollupOwner,
+                msg.sender,
+                upgradeExecutor
+            );
+            return;
+        }
+
         retryableSender.sendRetryable{
             value: retryableParams.feeTokenTotalFeeAmount > 0 ? 0 : address(this).balance
         }(
@@ -418,6 +518,44 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
         );
     }
 
+    /**
+     * @notice L2 deployed templates matching the L2 templates deployed on L1 which are used by the token bridge
+     */
+    function _getL2DeployedTemplates(L2TemplateAddresses memory l1Copies)
+        internal
+        view
+        returns (L2DeployedTemplates memory l2Templates)
+    {
+        L2TemplateAddresses memory l2 = l2DeployedTemplates;
+        l2Templates.router = _getL2DeployedTemplate(l2.routerTemplate, l1Copies.routerTemplate);
+        l2Templates.standardGateway =
+            _getL2DeployedTemplate(l2.standardGatewayTemplate, l1Copies.standardGatewayTemplate);
+        l2Templates.customGateway =
+            _getL2DeployedTemplate(l2.customGatewayTemplate, l1Copies.customGatewayTemplate);
+        l2Templates.wethGateway =
+            _getL2DeployedTemplate(l2.wethGatewayTemplate, l1Copies.wethGatewayTemplate);
+        l2Templates.aeWeth = _getL2DeployedTemplate(l2.wethTemplate, l1Copies.wethTemplate);
+        l2Templates.upgradeExecutor =
+            _getL2DeployedTemplate(l2.upgradeExecutorTemplate, l1Copies.upgradeExecutorTemplate);
+        l2Templates.multicall =
+            _getL2DeployedTemplate(l2.multicallTemplate, l1Copies.multicallTemplate);
+    }
+
+    function _getL2DeployedTemplate(address l2Template, address l1Copy)
+        internal
+        view
+        returns (L2DeployedTemplate memory)
+    {
+        // templates not used by the token bridge, ie. WETH ones of ERC20-based chains, are left unset
+        if (l1Copy == address(0)) {
+            return L2DeployedTemplate(address(0), bytes32(0));
+        }
+        if (l2Template == address(0)) {
+            revert L1AtomicTokenBridgeCreator_L2DeployedTemplatesNotSet();
+        }
+        return L2DeployedTemplate(l2Template, l1Copy.codehash);
+    }
+
     /**
      * @notice Rollup owner can override deployment
      */
@@ -444,15 +582,21 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
         return inboxToL1Deployment[inbox].router;
     }
 
-    function _deployL2Factory(address inbox, uint256 gasPriceBid, address feeToken) internal {
+    /**
+     * @param scaledRetryableFee fee of the retryable in fee token's decimals, unused if the chain uses ETH
+     */
+    function _deployL2Factory(
+        address inbox,
+        uint256 gasPriceBid,
+        address feeToken,
+        uint256 scaledRetryableFee
+    ) internal {
         // encode L2 factory bytecode
         bytes memory deploymentData =
             CreationCodeHelper.getCreationCodeFor(l2TokenBridgeFactoryTemplate.code);
 
         if (feeToken != address(0)) {
             // transfer fee tokens to inbox to pay for 1st retryable
-            uint256 retryableFee = gasLimitForL2FactoryDeployment * gasPriceBid;
-            uint256 scaledRetryableFee = _getScaledAmount(feeToken, retryableFee);
             IERC20(feeToken).safeTransferFrom(msg.sender, inbox, scaledRetryableFee);
 
             IERC20Inbox(inbox).createRetryableTicket(
@@ -495,7 +639,7 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
     function _predictL2BeaconProxyFactoryAddress(uint256 chainId) internal view returns (address) {
         return Create2.computeAddress(
             _getL2Salt(OrbitSalts.BEACON_PROXY_FACTORY, chainId),
-            keccak256(type(BeaconProxyFactory).creationCode),
+            keccak256(type(MinimalBeaconProxyFactory).creationCode),
             canonicalL2FactoryAddress
         );
     }
@@ -565,6 +709,35 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
         );
     }
 
+    /**
+     * @notice Deploy the L1 standard gateway logic dedicated to the chain if a deployer is set, otherwise
+     *         return the shared template.
+     */
+    function _getStandardGatewayLogic(
+        address inbox,
+        address feeToken,
+        address router,
+        address l2StandardGateway,
+        address l2BeaconProxyFactory
+    ) internal returns (address) {
+        IL1ImmutableGatewayDeployer deployer = feeToken != address(0)
+            ? feeTokenBasedStandardGatewayDeployer
+            : standardGatewayDeployer;
+        if (address(deployer) != address(0)) {
+            return deployer.deployStandardGateway(
+                l2StandardGateway,
+                router,
+                inbox,
+                keccak256(type(MinimalBeaconProxy).creationCode),
+                l2BeaconProxyFactory
+            );
+        }
+
+        return feeToken != address(0)
+            ? address(l1Templates.feeTokenBasedStandardGatewayTemplate)
+            : address(l1Templates.standardGatewayTemplate);
+    }
+
     /**
      * @notice We want to have exactly one set of canonical token bridge contracts for every rollup. For that
      *         reason we make rollup's inbox address part of the salt. It prevents deploying more than one
@@ -597,25 +770,6 @@ contract L1AtomicTokenBridgeCreator is Initializable, OwnableUpgradeable {
     {
         return address(new TransparentUpgradeableProxy{salt: salt}(logic, admin, bytes("")));
     }
-
-    /**
-     * @notice Scale amount to the fee token's decimals. Ie. amount of 1e18 will be scaled to 1e6 if fee token has 6 decimals like USDC.
-     */
-    function _getScaledAmount(address feeToken, uint256 amount) internal view returns (uint256) {
-        uint8 decimals = ERC20(feeToken).decimals();
-        if (decimals == 18) {
-            return amount;
-        }
-        if (decimals < 18) {
-            uint256 scaledAmount = amount / (10 ** (18 - decimals));
-            // round up if necessary
-            if (scaledAmount * (10 ** (18 - decimals)) < amount) {
-                scaledAmount++;
-            }
-            return scaledAmount;
-        }
-        return amount * (10 ** (decimals - 18));
-    }
 }
 
 interface IERC20Bridge {
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: Apache-2.0
+pragma solidity ^0.8.4;
+
+import {L1ImmutableERC20Gateway} from "./gateway/L1ImmutableERC20Gateway.sol";
+import {L1ImmutableOrbitERC20Gateway} from "./gateway/L1ImmutableOrbitERC20Gateway.sol";
+
+/**
+ * @title Deployer of standard gateway logic contracts dedicated to a single chain
+ * @notice Used by L1AtomicTokenBridgeCreator, which cannot hold the gateways' creation code itself
+ *         due to the contract size limit.
+ */
+interface IL1ImmutableGatewayDeployer {
+    function deployStandardGateway(
+        address l2Counterpart,
+        address router,
+        address inbox,
+        bytes32 cloneableProxyHash,
+        address l2BeaconProxyFactory
+    ) external returns (address);
+}
+
+contract L1ImmutableERC20GatewayDeployer is IL1ImmutableGatewayDeployer {
+    function deployStandardGateway(
+        address l2Counterpart,
+        address router,
+        address inbox,
+        bytes32 cloneableProxyHash,
+        address l2BeaconProxyFactory
+    ) external returns (address) {
+        return address(
+            new L1ImmutableERC20Gateway(
+                l2Counterpart, router, inbox, cloneableProxyHash, l2BeaconProxyFactory
+            )
+        );
+    }
+}
+
+contract L1ImmutableOrbitERC20GatewayDeployer is IL1ImmutableGatewayDeployer {
+    function deployStandardGateway(
+        address l2Counterpart,
+        address router,
+        address inbox,
+        bytes32 cloneableProxyHash,
+        address l2BeaconProxyFactory
+    ) external returns (address) {
+        return address(
+            new L1ImmutableOrbitERC20Gateway(
+                l2Counterpart, router, inbox, cloneableProxyHash, l2BeaconProxyFactory
+            )
+        );
+    }
+}
@@ -5,6 +5,7 @@ import {IInbox} from "@arbitrum/nitro-contracts/src/bridge/IInbox.sol";
 import {
     L2AtomicTokenBridgeFactory,
     L2RuntimeCode,
+    L2DeployedTemplates,
     ProxyAdmin
 } from "../arbitrum/L2AtomicTokenBridgeFactory.sol";
 import {AddressAliasHelper} from "../libraries/AddressAliasHelper.sol";
@@ -74,6 +75,52 @@ contract L1TokenBridgeRetryableSender is Initializable, OwnableUpgradeable {
         }
     }
 
+    /**
+     * @notice Creates retryable which deploys L2 side of the token bridge from templates already deployed on L2.
+     * @dev Same as `sendRetryable`, but the retryable only references the templates instead of carrying their
+     *      bytecode, see `L2AtomicTokenBridgeFactory.deployL2ContractsFromTemplates`.
+     */
+    function sendRetryableUsingL2Templates(
+        RetryableParams calldata retryableParams,
+        L2DeployedTemplates calldata l2,
+        L1DeploymentAddresses calldata l1,
+        address l2StandardGatewayAddress,
+        address rollupOwner,
+        address deployer,
+        address l1UpgradeExecutor
+    ) external payable onlyOwner {
+        bool isUsingFeeToken = retryableParams.feeTokenTotalFeeAmount > 0;
+        bytes memory data = abi.encodeCall(
+            L2AtomicTokenBridgeFactory.deployL2ContractsFromTemplates,
+            (
+                l2,
+                l1.router,
+                l1.standardGateway,
+                l1.customGateway,
+                isUsingFeeToken ? address(0) : l1.wethGateway,
+                isUsingFeeToken ? address(0) : l1.weth,
+                l2StandardGatewayAddress,
+                rollupOwner,
+                AddressAliasHelper.applyL1ToL2Alias(l1UpgradeExecutor)
+            )
+        );
+
+        if (!isUsingFeeToken) {
+            uint256 maxSubmissionCost =
+                IInbox(retryableParams.inbox).calculateRetryableSubmissionFee(data.length, 0);
+            uint256 retryableValue =
+                maxSubmissionCost + retryableParams.maxGas * retryableParams.gasPriceBid;
+            _createRetryableUsingEth(retryableParams, maxSubmissionCost, retryableValue, data);
+
+            // refund excess value to the deployer
+            (bool success,) = deployer.call{value: address(this).balance}("");
+            if (!success) revert L1TokenBridgeRetryableSender_RefundFailed();
+        } else {
+            if (msg.value > 0) revert L1TokenBridgeRetryableSender_EthReceivedForFeeToken();
+            _createRetryableUsingFeeToken(retryableParams, data);
+        }
+    }
+
     function _sendRetryableUsingEth(
         RetryableParams calldata retryableParams,
         L2TemplateAddresses calldata l2,
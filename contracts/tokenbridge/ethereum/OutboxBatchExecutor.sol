@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "@arbitrum/nitro-contracts/src/bridge/IOutbox.sol";
+import "@openzeppelin/contracts/utils/Address.sol";
+
+/**
+ * @title Executes multiple L2 to L1 messages, such as gateway withdrawals, in a single transaction
+ * @notice Anyone can relay messages through this contract, each one is executed with Outbox.executeTransaction
+ * and succeeds or fails on its own, without reverting the batch.
+ * @dev Messages keep their L2 sender and destination, the destination sees the outbox and bridge as the caller,
+ * same as when executing them directly. A failed message is not spent by the outbox, so it can be executed again.
+ * Each message is executed with the gas limit given for it, so a message can't consume the gas of the next ones,
+ * and the batch reverts if a message failed with less gas than its limit. Proofs can be fetched with
+ * lookupOutboxMessages in scripts/outboxProofs.ts.
+ */
+contract OutboxBatchExecutor {
+    /// @dev same fields, in the same order, as the parameters of IOutbox.executeTransaction
+    struct OutboxMessage {
+        bytes32[] proof;
+        uint256 index;
+        address l2Sender;
+        address to;
+        uint256 l2Block;
+        uint256 l1Block;
+        uint256 l2Timestamp;
+        uint256 value;
+        bytes data;
+    }
+
+    event TransactionFailed(address indexed outbox, uint256 indexed index);
+
+    /**
+     * @notice Execute messages of the outbox, a failed message doesn't revert the others
+     * @param outbox outbox of the messages' chain
+     * @param messages messages and their proofs, see IOutbox.executeTransaction
+     * @param gasLimits gas forwarded to the outbox for each message, including the proof verification
+     * @return success whether each message was executed
+     */
+    function executeTransactions(
+        IOutbox outbox,
+        OutboxMessage[] calldata messages,
+        uint256[] calldata gasLimits
+    ) external returns (bool[] memory success) {
+        // calls to an account without code would succeed
+        require(Address.isContract(address(outbox)), "NOT_CONTRACT");
+        require(messages.length == gasLimits.length, "INVALID_INPUT");
+
+        success = new bool[](messages.length);
+        for (uint256 i = 0; i < messages.length; i++) {
+            success[i] = _executeTransaction(address(outbox), messages[i], gasLimits[i]);
+            if (!success[i]) {
+                emit TransactionFailed(address(outbox), messages[i].index);
+            }
+        }
+    }
+
+    function _executeTransaction(
+        address outbox,
+        OutboxMessage calldata message,
+        uint256 gasLimit
+    ) internal returns (bool success) {
+        // the fields are abi encoded as the parameters of the call, behind the offset of the struct,
+        // this avoids pushing all of them on the stack to encode the call
+        bytes memory callData = abi.encode(message);
+        bytes4 selector = IOutbox.executeTransaction.selector;
+        assembly {
+            // the selector takes the place of the last 4 bytes of the struct's offset
+            mstore(add(callData, 0x20), shr(224, selector))
+            // return data isn't copied, the outbox bubbles up reverts of the destination
+            let size := sub(mload(callData), 0x1c)
+            success := call(gasLimit, outbox, 0, add(callData, 0x3c), size, 0, 0)
+        }
+        // the call gets at most 63/64 of the gas left, if that was below gasLimit the gas left is at most
+        // gasLimit / 63. Revert the batch so a relayer can't make a message fail by sending too little gas
+        require(success || gasleft() > gasLimit / 63, "INSUFFICIENT_GAS");
+    }
+}
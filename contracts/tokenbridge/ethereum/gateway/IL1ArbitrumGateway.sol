@@ -56,3 +56,21 @@ interface IL1ArbitrumGateway is ITokenGateway, IERC165 {
         bytes calldata _data
     ) external payable returns (bytes memory);
 }
+
+/**
+ * @title Batched deposits of gateways on L1, called by the L1 router
+ */
+interface IL1ArbitrumBatchGateway {
+    /**
+     * @notice Deposit multiple ERC20 tokens from Ethereum into Arbitrum using a single retryable ticket, see L1ArbitrumGateway
+     */
+    function outboundTransferBatchCustomRefund(
+        address[] calldata _l1Tokens,
+        address _refundTo,
+        address[] calldata _to,
+        uint256[] calldata _amounts,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        bytes calldata _data
+    ) external payable returns (bytes memory);
+}
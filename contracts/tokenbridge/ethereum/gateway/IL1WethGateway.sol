@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: Apache-2.0
+
+// solhint-disable-next-line compiler-version
+pragma solidity >=0.6.9 <0.9.0;
+
+/**
+ * @title Native ether deposits of the L1 WETH gateway, called by the L1 router
+ */
+interface IL1WethGateway {
+    /**
+     * @notice Deposit ether as WETH, see L1WethGateway
+     * @param _l1Token L1 address of WETH
+     * @param _refundTo Account, or its L2 alias if it have code in L1, to be credited with excess gas refund in L2
+     * @param _to Account to be credited with the tokens in the L2 (can be an EOA or a contract), not subject to L2 aliasing
+     * @param _amount Ether amount, msg.value needs to cover it on top of the retryable cost
+     * @param _maxGas Max gas deducted from user's L2 balance to cover L2 execution
+     * @param _gasPriceBid Gas price for L2 execution
+     * @param _data encoded data from router and user
+     * @return res abi encoded inbox sequence number
+     */
+    function outboundTransferETHCustomRefund(
+        address _l1Token,
+        address _refundTo,
+        address _to,
+        uint256 _amount,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        bytes calldata _data
+    ) external payable returns (bytes memory res);
+}
@@ -68,16 +68,47 @@ abstract contract L1ArbitrumExtendedGateway is L1ArbitrumGateway {
         bytes calldata _newData,
         bytes calldata _data
     ) external {
+        // the inboundEscrowAndCall functionality has been disabled, so no data is allowed
+        require(_newData.length == 0, "NO_DATA_ALLOWED");
+        _transferExit(_exitNum, _initialDestination, _newDestination, _data);
+    }
+
+    /**
+     * @notice Redirects multiple exits to `_newDestination`, each is handled as in transferExitAndCall
+     * @dev The sender must be the current destination of every exit. If `_data` is set, the transfer hook
+     * of `_newDestination` is called once per exit. Queued withdrawals redirected this way are then settled
+     * together by finalizeWithdrawalBatch.
+     * @param _exitNums Exit counters determined by the L2 bridge
+     * @param _initialDestinations addresses the L2 withdrawal calls initially set as destinations
+     * @param _newDestination address the L1 will now call instead of the previously set destinations
+     * @param _data optional data for external calls upon transfering the exits
+     */
+    function transferExitAndCallBatch(
+        uint256[] calldata _exitNums,
+        address[] calldata _initialDestinations,
+        address _newDestination,
+        bytes calldata _data
+    ) external {
+        require(_exitNums.length == _initialDestinations.length, "WRONG_LENGTH");
+        for (uint256 i = 0; i < _exitNums.length; i++) {
+            _transferExit(_exitNums[i], _initialDestinations[i], _newDestination, _data);
+        }
+    }
+
+    function _transferExit(
+        uint256 _exitNum,
+        address _initialDestination,
+        address _newDestination,
+        bytes calldata _data
+    ) internal {
         // the initial data doesn't make a difference when transfering you exit
         // since the L2 bridge gives a unique exit ID to each exit
-        (address expectedSender, ) = getExternalCall(_exitNum, _initialDestination, "");
+        address expectedSender = _getExitDestination(_exitNum, _initialDestination);
 
         // if you want to transfer your exit, you must be the current destination
         require(msg.sender == expectedSender, "NOT_EXPECTED_SENDER");
-        // the inboundEscrowAndCall functionality has been disabled, so no data is allowed
-        require(_newData.length == 0, "NO_DATA_ALLOWED");
 
-        setRedirectedExit(_exitNum, _initialDestination, _newDestination, _newData);
+        setRedirectedExit(_exitNum, _initialDestination, _newDestination, "");
 
         if (_data.length > 0) {
             require(_newDestination.isContract(), "TO_NOT_CONTRACT");
@@ -93,7 +124,7 @@ abstract contract L1ArbitrumExtendedGateway is L1ArbitrumGateway {
             expectedSender,
             _newDestination,
             _exitNum,
-            _newData,
+            "",
             _data,
             _data.length > 0
         );
@@ -119,6 +150,18 @@ abstract contract L1ArbitrumExtendedGateway is L1ArbitrumGateway {
         }
     }
 
+    /// @dev only reads the slot holding isExit and _newTo, the target is the same as in getExternalCall
+    function _getExitDestination(uint256 _exitNum, address _initialDestination)
+        internal
+        view
+        virtual
+        override
+        returns (address)
+    {
+        ExitData storage exit = redirectedExits[encodeWithdrawal(_exitNum, _initialDestination)];
+        return exit.isExit ? exit._newTo : _initialDestination;
+    }
+
     function setRedirectedExit(
         uint256 _exitNum,
         address _initialDestination,
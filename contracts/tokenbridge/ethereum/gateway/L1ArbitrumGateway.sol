@@ -24,11 +24,14 @@ import "@openzeppelin/contracts/utils/Create2.sol";
 import "@openzeppelin/contracts/utils/Address.sol";
 import "../L1ArbitrumMessenger.sol";
 import "./IL1ArbitrumGateway.sol";
+import "./IL1GatewayRouter.sol";
 import "../../libraries/ProxyUtil.sol";
+import "../../libraries/BytesLib.sol";
 import "../../libraries/gateway/GatewayMessageHandler.sol";
 import "../../libraries/gateway/TokenGateway.sol";
 import "../../libraries/ITransferAndCall.sol";
 import "../../libraries/ERC165.sol";
+import "../../arbitrum/gateway/IL2ArbitrumGateway.sol";
 
 /**
  * @title Common interface for gatways on L1 messaging to Arbitrum.
@@ -37,13 +40,22 @@ abstract contract L1ArbitrumGateway is
     L1ArbitrumMessenger,
     TokenGateway,
     ERC165,
-    IL1ArbitrumGateway
+    IL1ArbitrumGateway,
+    IL1ArbitrumBatchGateway
 {
     using SafeERC20 for IERC20;
     using Address for address;
 
     address public override inbox;
 
+    /// @dev gas limit of post deposit hooks is capped, so they can't make their retryable too expensive to redeem
+    uint256 internal constant MAX_DEPOSIT_HOOK_GAS = 2_000_000;
+
+    /// @dev slot of the packedL2MsgEnabled flag, kept out of the sequential layout so the storage of
+    /// the gateways inheriting this contract doesn't move
+    bytes32 internal constant PACKED_L2_MSG_ENABLED_SLOT =
+        bytes32(uint256(keccak256("arbitrum.l1gateway.packedL2MsgEnabled")) - 1);
+
     event DepositInitiated(
         address l1Token,
         address indexed _from,
@@ -52,6 +64,20 @@ abstract contract L1ArbitrumGateway is
         uint256 _amount
     );
 
+    /**
+     * @notice Emitted along with DepositInitiated, so a deposit can be matched with its retryable and DepositFinalized
+     * on L2 from logs only. The message hash is keccak256 of the retryable's L2 calldata, which the L2 gateway emits
+     * in DepositMessageFinalized. Withdrawals are matched with WithdrawalInitiated on L2 by their exit number.
+     */
+    event DepositMessageSent(
+        address indexed l1Token,
+        uint256 indexed _sequenceNumber,
+        bytes32 indexed _messageHash,
+        address _l2Token
+    );
+
+    event PackedL2MsgEnabledSet(bool enabled);
+
     event WithdrawalFinalized(
         address l1Token,
         address indexed _from,
@@ -61,7 +87,7 @@ abstract contract L1ArbitrumGateway is
     );
 
     modifier onlyCounterpartGateway() override {
-        address _inbox = inbox;
+        address _inbox = _getInbox();
 
         // a message coming from the counterpart gateway was executed by the bridge
         address bridge = address(super.getBridge(_inbox));
@@ -69,11 +95,11 @@ abstract contract L1ArbitrumGateway is
 
         // and the outbox reports that the L2 address of the sender is the counterpart gateway
         address l2ToL1Sender = super.getL2ToL1Sender(_inbox);
-        require(l2ToL1Sender == counterpartGateway, "ONLY_COUNTERPART_GATEWAY");
+        require(l2ToL1Sender == _getCounterpartGateway(), "ONLY_COUNTERPART_GATEWAY");
         _;
     }
 
-    function postUpgradeInit() external {
+    function postUpgradeInit() public virtual {
         // it is assumed the L1 Arbitrum Gateway contract is behind a Proxy controlled by a proxy admin
         // this function can only be called by the proxy admin contract
         address proxyAdmin = ProxyUtil.getProxyAdmin();
@@ -93,6 +119,43 @@ abstract contract L1ArbitrumGateway is
         inbox = _inbox;
     }
 
+    /**
+     * @dev The configuration set in _initialize is read through these getters in the deposit and withdrawal paths,
+     * so implementations deployed for a single chain can return immutables instead of loading storage.
+     */
+    function _getCounterpartGateway() internal view virtual returns (address) {
+        return counterpartGateway;
+    }
+
+    function _getInbox() internal view virtual returns (address) {
+        return inbox;
+    }
+
+    /**
+     * @notice Whether deposits with packed user data are sent to the L2 gateway as packed messages
+     * @dev Until the owner of the router enables it, once the L2 counterpart is upgraded to parse them,
+     * the L2 message of every deposit is abi encoded, whatever the encoding of the user's data
+     */
+    function packedL2MsgEnabled() public view returns (bool enabled) {
+        bytes32 slot = PACKED_L2_MSG_ENABLED_SLOT;
+        assembly {
+            enabled := sload(slot)
+        }
+    }
+
+    /**
+     * @notice Enable or disable packed messages to the L2 gateway, see packedL2MsgEnabled
+     * @param _enabled whether the L2 counterpart parses packed messages
+     */
+    function setPackedL2MsgEnabled(bool _enabled) external {
+        require(msg.sender == IL1GatewayRouter(router).owner(), "ONLY_ROUTER_OWNER");
+        bytes32 slot = PACKED_L2_MSG_ENABLED_SLOT;
+        assembly {
+            sstore(slot, _enabled)
+        }
+        emit PackedL2MsgEnabledSet(_enabled);
+    }
+
     /**
      * @notice Finalizes a withdrawal via Outbox message; callable only by L2Gateway.outboundTransfer
      * @param _token L1 address of token being withdrawn from
@@ -109,17 +172,10 @@ abstract contract L1ArbitrumGateway is
         bytes calldata _data
     ) public payable virtual override onlyCounterpartGateway {
         // this function is marked as virtual so superclasses can override it to add modifiers
-        (uint256 exitNum, bytes memory callHookData) = GatewayMessageHandler.parseToL1GatewayMsg(
-            _data
-        );
-
-        if (callHookData.length != 0) {
-            // callHookData should always be 0 since inboundEscrowAndCall is disabled
-            callHookData = bytes("");
-        }
+        // callHookData is ignored since inboundEscrowAndCall is disabled
+        (uint256 exitNum, ) = GatewayMessageHandler.parseToL1GatewayMsg(_data);
 
-        // we ignore the returned data since the callHook feature is now disabled
-        (_to, ) = getExternalCall(exitNum, _to, callHookData);
+        _to = _getExitDestination(exitNum, _to);
         inboundEscrowTransfer(_token, _to, _amount);
 
         emit WithdrawalFinalized(_token, _from, _to, exitNum, _amount);
@@ -136,6 +192,19 @@ abstract contract L1ArbitrumGateway is
         data = _initialData;
     }
 
+    /**
+     * @dev target of getExternalCall for an exit, without its data, which is unused since the callHook feature
+     *      is disabled. Subclasses can override it with a cheaper lookup, consistent with getExternalCall.
+     */
+    function _getExitDestination(uint256 _exitNum, address _initialDestination)
+        internal
+        view
+        virtual
+        returns (address target)
+    {
+        (target, ) = getExternalCall(_exitNum, _initialDestination, "");
+    }
+
     function inboundEscrowTransfer(
         address _l1Token,
         address _dest,
@@ -164,8 +233,8 @@ abstract contract L1ArbitrumGateway is
         // the eth sent is used to pay for the tx's gas
         return
             sendTxToL2CustomRefund(
-                inbox,
-                counterpartGateway,
+                _getInbox(),
+                _getCounterpartGateway(),
                 _refundTo,
                 _from,
                 msg.value, // we forward the L1 call value to the inbox
@@ -250,13 +319,16 @@ abstract contract L1ArbitrumGateway is
         // it and add custom validation for callers (ie only whitelisted users)
         address _from;
         uint256 seqNum;
-        bytes memory extraData;
         {
             uint256 _maxSubmissionCost;
             uint256 tokenTotalFeeAmount;
-            if (super.isRouter(msg.sender)) {
+            bytes memory extraData;
+            if (isRouter(msg.sender)) {
                 // router encoded
-                (_from, extraData) = GatewayMessageHandler.parseFromRouterToGateway(_data);
+                (_from, extraData) = GatewayMessageHandler.parseFromRouter(
+                    _data,
+                    isRouter(msg.sender)
+                );
             } else {
                 _from = msg.sender;
                 extraData = _data;
@@ -264,17 +336,19 @@ abstract contract L1ArbitrumGateway is
             // unpack user encoded data
             (_maxSubmissionCost, extraData, tokenTotalFeeAmount) = _parseUserEncodedData(extraData);
 
-            // the inboundEscrowAndCall functionality has been disabled, so no data is allowed
-            require(extraData.length == 0, "EXTRA_DATA_DISABLED");
+            _validateCallHookData(extraData, _maxGas);
 
             require(_l1Token.isContract(), "L1_NOT_CONTRACT");
-            address l2Token = calculateL2TokenAddress(_l1Token);
-            require(l2Token != address(0), "NO_L2_TOKEN_SET");
+            require(calculateL2TokenAddress(_l1Token) != address(0), "NO_L2_TOKEN_SET");
 
             _amount = outboundEscrowTransfer(_l1Token, _from, _amount);
 
             // we override the res field to save on the stack
-            res = getOutboundCalldata(_l1Token, _from, _to, _amount, extraData);
+            // deposits that opted into the packed encoding also get a packed message to the L2,
+            // once the L2 counterpart is known to parse it
+            res = GatewayMessageHandler.isPackedMsg(_data) && packedL2MsgEnabled()
+                ? getOutboundCalldataPacked(_l1Token, _from, _to, _amount, extraData)
+                : getOutboundCalldata(_l1Token, _from, _to, _amount, extraData);
 
             seqNum = _initiateDeposit(
                 _refundTo,
@@ -288,9 +362,128 @@ abstract contract L1ArbitrumGateway is
             );
         }
         emit DepositInitiated(_l1Token, _from, _to, seqNum, _amount);
+        _emitDepositMessageSent(_l1Token, seqNum, res);
         return abi.encode(seqNum);
     }
 
+    /**
+     * @notice Deposit multiple ERC20 tokens from Ethereum into Arbitrum using a single retryable ticket. Initiated by GatewayRouter.
+     * @dev All tokens share the same sender, refund address and L2 gas parameters. DepositInitiated is emitted once per token
+     *      with the sequence number of the shared retryable, so indexers see the same events as for individual deposits.
+     * @param _l1Tokens L1 addresses of ERC20s
+     * @param _refundTo Account, or its L2 alias if it have code in L1, to be credited with excess gas refund in L2
+     * @param _to Accounts to be credited with the tokens in the L2 (can be EOAs or contracts), not subject to L2 aliasing
+     * @param _amounts Token Amounts
+     * @param _maxGas Max gas deducted from user's L2 balance to cover L2 execution
+     * @param _gasPriceBid Gas price for L2 execution
+     * @param _data encoded data from router and user
+     * @return res abi encoded inbox sequence number
+     */
+    function outboundTransferBatchCustomRefund(
+        address[] memory _l1Tokens,
+        address _refundTo,
+        address[] memory _to,
+        uint256[] memory _amounts,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        bytes calldata _data
+    ) public payable virtual override returns (bytes memory res) {
+        // batches are only supported through the router, so _data is always router encoded
+        require(isRouter(msg.sender), "NOT_FROM_ROUTER");
+        require(
+            _l1Tokens.length == _to.length && _l1Tokens.length == _amounts.length,
+            "WRONG_LENGTH"
+        );
+
+        address _from;
+        uint256 seqNum;
+        {
+            uint256 _maxSubmissionCost;
+            uint256 tokenTotalFeeAmount;
+            {
+                bytes memory extraData;
+                (_from, extraData) = GatewayMessageHandler.parseFromRouter(
+                    _data,
+                    isRouter(msg.sender)
+                );
+                (_maxSubmissionCost, extraData, tokenTotalFeeAmount) = _parseUserEncodedData(
+                    extraData
+                );
+
+                // post deposit hooks are not supported for batches, so no data is allowed
+                require(extraData.length == 0, "EXTRA_DATA_DISABLED");
+            }
+
+            // _amounts is overwritten with the amounts actually received
+            uint256 totalAmount = _outboundEscrowBatch(_l1Tokens, _from, _amounts);
+
+            // we override the res field to save on the stack
+            res = getOutboundBatchCalldata(_l1Tokens, _from, _to, _amounts, "");
+
+            seqNum = _initiateDeposit(
+                _refundTo,
+                _from,
+                totalAmount,
+                _maxGas,
+                _gasPriceBid,
+                _maxSubmissionCost,
+                tokenTotalFeeAmount,
+                res
+            );
+        }
+
+        for (uint256 i = 0; i < _l1Tokens.length; i++) {
+            emit DepositInitiated(_l1Tokens[i], _from, _to[i], seqNum, _amounts[i]);
+            _emitDepositMessageSent(_l1Tokens[i], seqNum, res);
+        }
+        return abi.encode(seqNum);
+    }
+
+    /**
+     * @notice Check the call hook data of a deposit, which can only be a post deposit hook
+     * @dev See GatewayMessageHandler.encodeDepositHook. The hook is called on `_to` by the L2 gateway,
+     * with a gas limit which has to fit in the retryable's `_maxGas`
+     */
+    function _validateCallHookData(bytes memory _callHookData, uint256 _maxGas) internal pure {
+        if (_callHookData.length == 0) {
+            return;
+        }
+        // the inboundEscrowAndCall functionality has been disabled, so no other data is allowed
+        require(GatewayMessageHandler.isDepositHook(_callHookData), "EXTRA_DATA_DISABLED");
+
+        uint256 hookGasLimit = BytesLib.toUint(_callHookData, 1);
+        require(hookGasLimit <= MAX_DEPOSIT_HOOK_GAS, "HOOK_GAS_TOO_HIGH");
+        require(hookGasLimit < _maxGas, "HOOK_GAS_EXCEEDS_MAX_GAS");
+    }
+
+    function _emitDepositMessageSent(
+        address _l1Token,
+        uint256 _seqNum,
+        bytes memory _outboundCalldata
+    ) internal {
+        emit DepositMessageSent(
+            _l1Token,
+            _seqNum,
+            keccak256(_outboundCalldata),
+            calculateL2TokenAddress(_l1Token)
+        );
+    }
+
+    function _outboundEscrowBatch(
+        address[] memory _l1Tokens,
+        address _from,
+        uint256[] memory _amounts
+    ) internal returns (uint256 totalAmount) {
+        for (uint256 i = 0; i < _l1Tokens.length; i++) {
+            address _l1Token = _l1Tokens[i];
+            require(_l1Token.isContract(), "L1_NOT_CONTRACT");
+            require(calculateL2TokenAddress(_l1Token) != address(0), "NO_L2_TOKEN_SET");
+
+            _amounts[i] = outboundEscrowTransfer(_l1Token, _from, _amounts[i]);
+            totalAmount += _amounts[i];
+        }
+    }
+
     function outboundEscrowTransfer(
         address _l1Token,
         address _from,
@@ -315,20 +508,97 @@ abstract contract L1ArbitrumGateway is
         // before execution
         // it is virtual since different gateway subclasses can build this calldata differently
         // ( ie the standard ERC20 gateway queries for a tokens name/symbol/decimals )
-        bytes memory emptyBytes = "";
+        outboundCalldata = abi.encodeWithSelector(
+            ITokenGateway.finalizeInboundTransfer.selector,
+            _l1Token,
+            _from,
+            _to,
+            _amount,
+            GatewayMessageHandler.encodeToL2GatewayMsg(_getOutboundGatewayData(_l1Token), _data)
+        );
 
+        return outboundCalldata;
+    }
+
+    /**
+     * @notice Same as getOutboundCalldata, but the message to the L2 gateway uses the packed encoding
+     * @dev used for deposits whose data was packed by the user, the L2 gateway parses both encodings
+     */
+    function getOutboundCalldataPacked(
+        address _l1Token,
+        address _from,
+        address _to,
+        uint256 _amount,
+        bytes memory _data
+    ) public view virtual returns (bytes memory outboundCalldata) {
         outboundCalldata = abi.encodeWithSelector(
             ITokenGateway.finalizeInboundTransfer.selector,
             _l1Token,
             _from,
             _to,
             _amount,
-            GatewayMessageHandler.encodeToL2GatewayMsg(emptyBytes, _data)
+            GatewayMessageHandler.encodeToL2GatewayMsgPacked(
+                _getOutboundGatewayDataPacked(_l1Token),
+                _data
+            )
+        );
+
+        return outboundCalldata;
+    }
+
+    function getOutboundBatchCalldata(
+        address[] memory _l1Tokens,
+        address _from,
+        address[] memory _to,
+        uint256[] memory _amounts,
+        bytes memory _data
+    ) public view virtual returns (bytes memory outboundCalldata) {
+        // each token gets its own gateway message so the L2 side can handle it
+        // exactly as it would handle an individual finalizeInboundTransfer
+        bytes[] memory tokenData = new bytes[](_l1Tokens.length);
+        for (uint256 i = 0; i < _l1Tokens.length; i++) {
+            tokenData[i] = GatewayMessageHandler.encodeToL2GatewayMsg(
+                _getOutboundGatewayData(_l1Tokens[i]),
+                _data
+            );
+        }
+
+        outboundCalldata = abi.encodeWithSelector(
+            IL2ArbitrumGateway.finalizeInboundTransferBatch.selector,
+            _l1Tokens,
+            _from,
+            _to,
+            _amounts,
+            tokenData
         );
 
         return outboundCalldata;
     }
 
+    /**
+     * @notice Gateway specific data sent to the L2 gateway along with a deposit of `_l1Token`
+     * @dev Empty by default, the standard ERC20 gateway overrides it to include the token's name/symbol/decimals
+     */
+    function _getOutboundGatewayData(
+        address /* _l1Token */
+    ) internal view virtual returns (bytes memory) {
+        return "";
+    }
+
+    /**
+     * @notice Gateway specific data sent along with a deposit using the packed encoding
+     * @dev Same as _getOutboundGatewayData by default, gateways can use a more compact encoding here since
+     * their L2 counterpart is expected to support it for deposits which opted into the packed encoding
+     */
+    function _getOutboundGatewayDataPacked(address _l1Token)
+        internal
+        view
+        virtual
+        returns (bytes memory)
+    {
+        return _getOutboundGatewayData(_l1Token);
+    }
+
     function supportsInterface(bytes4 interfaceId)
         public
         view
@@ -340,6 +610,8 @@ abstract contract L1ArbitrumGateway is
         // using function selector instead of single function interfaces to reduce bloat
         return
             interfaceId == this.outboundTransferCustomRefund.selector ||
+            interfaceId == this.outboundTransferBatchCustomRefund.selector ||
+            interfaceId == GatewayMessageHandler.APPENDED_SENDER_INTERFACE_ID ||
             super.supportsInterface(interfaceId);
     }
 
@@ -352,6 +624,8 @@ abstract contract L1ArbitrumGateway is
      *      - maxSubmissionCost (uint256)
      *      - tokenTotalFeeAmount (uint256)
      *      - callHookData (bytes)
+     *      The data is either abi encoded, or packed behind GatewayMessageHandler.PACKED_MSG_VERSION
+     *      with the uint256 fields first and callHookData taking the rest of the data
      * @param data data encoded by user
      * @return maxSubmissionCost Max gas deducted from user's L2 balance to cover base submission fee
      * @return callHookData Calldata for extra call in inboundEscrowAndCall on L2
@@ -367,7 +641,13 @@ abstract contract L1ArbitrumGateway is
             uint256 tokenTotalFeeAmount
         )
     {
-        (maxSubmissionCost, callHookData) = abi.decode(data, (uint256, bytes));
+        if (GatewayMessageHandler.isPackedUserData(data)) {
+            require(data.length >= 33, "INVALID_PACKED_MSG");
+            maxSubmissionCost = BytesLib.toUint(data, 1);
+            callHookData = BytesLib.slice(data, 33, data.length - 33);
+        } else {
+            (maxSubmissionCost, callHookData) = abi.decode(data, (uint256, bytes));
+        }
     }
 
     /**
@@ -23,6 +23,7 @@ import "./L1ArbitrumExtendedGateway.sol";
 import "../../arbitrum/gateway/L2CustomGateway.sol";
 import "../../libraries/gateway/ICustomGateway.sol";
 import "@openzeppelin/contracts/utils/Address.sol";
+import "@openzeppelin/contracts/utils/cryptography/SignatureChecker.sol";
 
 import "../../libraries/Whitelist.sol";
 
@@ -55,6 +56,11 @@ contract L1CustomGateway is L1ArbitrumExtendedGateway, ICustomGateway {
         _status = _NOT_ENTERED;
     }
 
+    // registrations of each L1 token through registerTokensToL2, part of the signed hash so that a signature
+    // can't be replayed. Kept in an unstructured slot so the layout of the gateways inheriting this one doesn't change.
+    bytes32 internal constant REGISTRATION_NONCES_SLOT =
+        bytes32(uint256(keccak256("arbitrum.l1customgateway.registrationNonces")) - 1);
+
     modifier onlyOwner() {
         require(msg.sender == owner, "ONLY_OWNER");
         _;
@@ -81,6 +87,27 @@ contract L1CustomGateway is L1ArbitrumExtendedGateway, ICustomGateway {
             );
     }
 
+    function outboundTransferBatchCustomRefund(
+        address[] memory _l1Tokens,
+        address _refundTo,
+        address[] memory _to,
+        uint256[] memory _amounts,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        bytes calldata _data
+    ) public payable override nonReentrant returns (bytes memory res) {
+        return
+            super.outboundTransferBatchCustomRefund(
+                _l1Tokens,
+                _refundTo,
+                _to,
+                _amounts,
+                _maxGas,
+                _gasPriceBid,
+                _data
+            );
+    }
+
     function finalizeInboundTransfer(
         address _token,
         address _from,
@@ -97,7 +124,7 @@ contract L1CustomGateway is L1ArbitrumExtendedGateway, ICustomGateway {
         address _l1Router,
         address _inbox,
         address _owner
-    ) public {
+    ) public virtual {
         L1ArbitrumGateway._initialize(_l1Counterpart, _l1Router, _inbox);
         owner = _owner;
         // disable whitelist by default
@@ -216,6 +243,120 @@ contract L1CustomGateway is L1ArbitrumExtendedGateway, ICustomGateway {
             );
     }
 
+    /**
+     * @notice Register custom L2 counterparts of multiple L1 tokens in a single retryable ticket.
+     * @dev Can be called by anyone, each L1 token authorizes its pair with an ERC-1271 signature of
+     * `getRegistrationHash`. Tokens deployed by a factory can attest their pairs by checking the factory
+     * in `isValidSignature`. As with registerTokenToL2, a registered token can't change its L2 address.
+     * The hash includes the token's registration nonce and a deadline, so each signature can be used once
+     * and only until the deadline.
+     * @param _l1Addresses array of L1 addresses
+     * @param _l2Addresses array of L2 addresses
+     * @param _signatures ERC-1271 signature of each L1 token for its pair
+     * @param _deadline timestamp after which the signatures expire
+     * @param _maxGas max gas for L2 retryable exrecution
+     * @param _gasPriceBid gas price for L2 retryable ticket
+     * @param  _maxSubmissionCost base submission cost  L2 retryable tick3et
+     * @return Retryable ticket ID
+     */
+    function registerTokensToL2(
+        address[] calldata _l1Addresses,
+        address[] calldata _l2Addresses,
+        bytes[] calldata _signatures,
+        uint256 _deadline,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        uint256 _maxSubmissionCost
+    ) external payable virtual returns (uint256) {
+        _checkTokenRegistrations(_l1Addresses, _l2Addresses, _signatures, _deadline);
+        return
+            _forceRegisterTokenToL2(
+                _l1Addresses,
+                _l2Addresses,
+                _maxGas,
+                _gasPriceBid,
+                _maxSubmissionCost,
+                msg.value
+            );
+    }
+
+    /**
+     * @notice Hash signed by an L1 token to authorize the registration of its L2 counterpart in this gateway
+     * @param _l1Address L1 address of the token
+     * @param _l2Address counterpart address of the L1 token
+     * @param _deadline timestamp after which the signature expires
+     */
+    function getRegistrationHash(
+        address _l1Address,
+        address _l2Address,
+        uint256 _deadline
+    ) public view returns (bytes32) {
+        return
+            keccak256(
+                abi.encode(
+                    block.chainid,
+                    address(this),
+                    _l1Address,
+                    _l2Address,
+                    registrationNonce(_l1Address),
+                    _deadline
+                )
+            );
+    }
+
+    /**
+     * @notice Nonce of the next registration of an L1 token through registerTokensToL2
+     * @param _l1Address L1 address of the token
+     */
+    function registrationNonce(address _l1Address) public view returns (uint256 nonce) {
+        bytes32 slot = _registrationNonceSlot(_l1Address);
+        assembly {
+            nonce := sload(slot)
+        }
+    }
+
+    function _registrationNonceSlot(address _l1Address) internal pure returns (bytes32) {
+        // same derivation as a mapping(address => uint256) at the base slot
+        return keccak256(abi.encode(_l1Address, REGISTRATION_NONCES_SLOT));
+    }
+
+    function _checkTokenRegistrations(
+        address[] calldata _l1Addresses,
+        address[] calldata _l2Addresses,
+        bytes[] calldata _signatures,
+        uint256 _deadline
+    ) internal {
+        require(
+            _l1Addresses.length == _l2Addresses.length &&
+                _l1Addresses.length == _signatures.length,
+            "INVALID_LENGTHS"
+        );
+        require(block.timestamp <= _deadline, "EXPIRED_SIGNATURE");
+
+        for (uint256 i = 0; i < _l1Addresses.length; i++) {
+            address currL2Addr = l1ToL2Token[_l1Addresses[i]];
+            if (currL2Addr != address(0)) {
+                // if token is already set, don't allow it to set a different L2 address
+                require(currL2Addr == _l2Addresses[i], "NO_UPDATE_TO_DIFFERENT_ADDR");
+            }
+            // isArbitrumEnabled is only expected to succeed while the token calls the gateway,
+            // so the signature replaces it as proof that the token opted in
+            require(
+                SignatureChecker.isValidERC1271SignatureNow(
+                    _l1Addresses[i],
+                    getRegistrationHash(_l1Addresses[i], _l2Addresses[i], _deadline),
+                    _signatures[i]
+                ),
+                "INVALID_SIGNATURE"
+            );
+            // invalidates the signature, and any other one signed for the same nonce
+            bytes32 nonceSlot = _registrationNonceSlot(_l1Addresses[i]);
+            assembly {
+                sstore(nonceSlot, add(sload(nonceSlot), 1))
+            }
+        }
+    }
+
     function setOwner(address newOwner) external onlyOwner {
         require(newOwner != address(0), "INVALID_OWNER");
         owner = newOwner;
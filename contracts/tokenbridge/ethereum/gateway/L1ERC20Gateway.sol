@@ -20,6 +20,8 @@ pragma solidity ^0.8.0;
 
 import "./L1ArbitrumExtendedGateway.sol";
 import "@openzeppelin/contracts/utils/Create2.sol";
+import "../../libraries/L2TokenAddress.sol";
+import "../../libraries/TokenMetadataCodec.sol";
 import "../../libraries/Whitelist.sol";
 
 /**
@@ -54,6 +56,35 @@ contract L1ERC20Gateway is L1ArbitrumExtendedGateway {
 
     // end of inline reentrancy guard
 
+    // tokens whose L2 counterpart was confirmed by the L2 gateway, deposits for them don't include deploy data
+    mapping(address => bool) public isL2TokenDeployed;
+
+    // withdrawals of a batch whose transfer failed are credited to their destination, by token and account.
+    // Kept in an unstructured slot so the layout of the gateways inheriting this one doesn't change.
+    bytes32 internal constant CLAIMABLE_WITHDRAWALS_SLOT =
+        bytes32(uint256(keccak256("arbitrum.l1erc20gateway.claimableWithdrawals")) - 1);
+
+    // gas given to the transfer of each withdrawal of a batch, withdrawals of tokens which need more are
+    // credited, and claimWithdrawal forwards all the gas left
+    uint256 internal constant BATCH_TRANSFER_GAS = 100_000;
+
+    event L2TokenDeployed(address indexed l1Token);
+
+    event WithdrawalCredited(
+        address l1Token,
+        address indexed _from,
+        address indexed _to,
+        uint256 indexed _exitNum,
+        uint256 _amount
+    );
+
+    event WithdrawalClaimed(
+        address indexed l1Token,
+        address indexed _account,
+        address indexed _to,
+        uint256 _amount
+    );
+
     function outboundTransferCustomRefund(
         address _l1Token,
         address _refundTo,
@@ -75,6 +106,27 @@ contract L1ERC20Gateway is L1ArbitrumExtendedGateway {
             );
     }
 
+    function outboundTransferBatchCustomRefund(
+        address[] memory _l1Tokens,
+        address _refundTo,
+        address[] memory _to,
+        uint256[] memory _amounts,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        bytes calldata _data
+    ) public payable virtual override nonReentrant returns (bytes memory res) {
+        return
+            super.outboundTransferBatchCustomRefund(
+                _l1Tokens,
+                _refundTo,
+                _to,
+                _amounts,
+                _maxGas,
+                _gasPriceBid,
+                _data
+            );
+    }
+
     function finalizeInboundTransfer(
         address _token,
         address _from,
@@ -86,13 +138,136 @@ contract L1ERC20Gateway is L1ArbitrumExtendedGateway {
         super.finalizeInboundTransfer(_token, _from, _to, _amount, _data);
     }
 
+    /**
+     * @notice Finalizes a batch of withdrawals queued on L2, each is handled as in finalizeInboundTransfer
+     * @dev callable only through L2ERC20Gateway.flushWithdrawals. Every withdrawal keeps the exit number it got
+     * when queued, so it can still be redirected with transferExitAndCall before the batch is executed.
+     * A withdrawal whose transfer reverts (ie. the destination is blacklisted by the token) doesn't revert the
+     * batch, its amount is credited to the destination instead and can be pulled with claimWithdrawal.
+     * Each transfer gets BATCH_TRANSFER_GAS, the batch reverts with INSUFFICIENT_GAS if it couldn't.
+     * @param _token L1 address of ERC20
+     * @param _from accounts that initiated the withdrawals in the L2
+     * @param _to accounts to be credited with the tokens in the L1
+     * @param _amounts token amounts to be released
+     * @param _exitNums exit numbers given by the L2 gateway to each withdrawal
+     */
+    function finalizeWithdrawalBatch(
+        address _token,
+        address[] memory _from,
+        address[] memory _to,
+        uint256[] memory _amounts,
+        uint256[] memory _exitNums
+    ) external onlyCounterpartGateway nonReentrant {
+        require(
+            _from.length == _to.length &&
+                _from.length == _amounts.length &&
+                _from.length == _exitNums.length,
+            "WRONG_LENGTH"
+        );
+        for (uint256 i = 0; i < _to.length; i++) {
+            address to = _getExitDestination(_exitNums[i], _to[i]);
+            try
+                this.inboundEscrowTransferFromBatch{ gas: BATCH_TRANSFER_GAS }(
+                    _token,
+                    to,
+                    _amounts[i]
+                )
+            {
+                emit WithdrawalFinalized(_token, _from[i], to, _exitNums[i], _amounts[i]);
+            } catch {
+                // the call gets at most 63/64 of the gas left, if that was below BATCH_TRANSFER_GAS the gas left
+                // is at most BATCH_TRANSFER_GAS / 63. Revert the batch so a relayer can't make transfers fail,
+                // and force the receivers to claim them, by executing the message with too little gas
+                require(gasleft() > BATCH_TRANSFER_GAS / 63, "INSUFFICIENT_GAS");
+                _setClaimableWithdrawal(_token, to, claimableWithdrawal(_token, to) + _amounts[i]);
+                emit WithdrawalCredited(_token, _from[i], to, _exitNums[i], _amounts[i]);
+            }
+        }
+    }
+
+    /**
+     * @notice Releases one withdrawal of a batch, only callable by the gateway itself
+     * @dev external so finalizeWithdrawalBatch can catch a reverting transfer without reverting the batch
+     */
+    function inboundEscrowTransferFromBatch(
+        address _token,
+        address _dest,
+        uint256 _amount
+    ) external {
+        require(msg.sender == address(this), "ONLY_SELF");
+        inboundEscrowTransfer(_token, _dest, _amount);
+    }
+
+    /**
+     * @notice Pulls the withdrawals of `_token` credited to the caller by finalizeWithdrawalBatch
+     * @param _token L1 address of ERC20
+     * @param _to account that receives the tokens, can differ from the caller if it can't hold them
+     */
+    function claimWithdrawal(address _token, address _to) external nonReentrant {
+        uint256 amount = claimableWithdrawal(_token, msg.sender);
+        require(amount != 0, "NOTHING_TO_CLAIM");
+        _setClaimableWithdrawal(_token, msg.sender, 0);
+        inboundEscrowTransfer(_token, _to, amount);
+        emit WithdrawalClaimed(_token, msg.sender, _to, amount);
+    }
+
+    /// @notice amount of `_token` credited to `_account` by finalizeWithdrawalBatch and not claimed yet
+    function claimableWithdrawal(address _token, address _account)
+        public
+        view
+        returns (uint256 amount)
+    {
+        bytes32 slot = _claimableWithdrawalSlot(_token, _account);
+        assembly {
+            amount := sload(slot)
+        }
+    }
+
+    function _setClaimableWithdrawal(
+        address _token,
+        address _account,
+        uint256 _amount
+    ) internal {
+        bytes32 slot = _claimableWithdrawalSlot(_token, _account);
+        assembly {
+            sstore(slot, _amount)
+        }
+    }
+
+    function _claimableWithdrawalSlot(address _token, address _account)
+        internal
+        pure
+        returns (bytes32)
+    {
+        // same derivation as a mapping(address => mapping(address => uint256)) at the base slot
+        return
+            keccak256(
+                abi.encode(_account, keccak256(abi.encode(_token, CLAIMABLE_WITHDRAWALS_SLOT)))
+            );
+    }
+
+    /**
+     * @notice Records that the L2 tokens of `_l1Tokens` are deployed; callable only by L2ERC20Gateway.reportDeployedTokens
+     * @dev once recorded, deposits for these tokens stop sending name/symbol/decimals to the L2
+     * @param _l1Tokens L1 addresses of ERC20s
+     */
+    function confirmL2TokenDeployments(address[] calldata _l1Tokens)
+        external
+        onlyCounterpartGateway
+    {
+        for (uint256 i = 0; i < _l1Tokens.length; i++) {
+            isL2TokenDeployed[_l1Tokens[i]] = true;
+            emit L2TokenDeployed(_l1Tokens[i]);
+        }
+    }
+
     function initialize(
         address _l2Counterpart,
         address _router,
         address _inbox,
         bytes32 _cloneableProxyHash,
         address _l2BeaconProxyFactory
-    ) public {
+    ) public virtual {
         L1ArbitrumGateway._initialize(_l2Counterpart, _router, _inbox);
         require(_cloneableProxyHash != bytes32(0), "INVALID_PROXYHASH");
         require(_l2BeaconProxyFactory != address(0), "INVALID_BEACON");
@@ -123,30 +298,36 @@ contract L1ERC20Gateway is L1ArbitrumExtendedGateway {
         return res;
     }
 
-    function getOutboundCalldata(
-        address _token,
-        address _from,
-        address _to,
-        uint256 _amount,
-        bytes memory _data
-    ) public view override returns (bytes memory outboundCalldata) {
-        // TODO: cheaper to make static calls or save isDeployed to storage?
-        bytes memory deployData = abi.encode(
-            callStatic(_token, ERC20.name.selector),
-            callStatic(_token, ERC20.symbol.selector),
-            callStatic(_token, ERC20.decimals.selector)
-        );
-
-        outboundCalldata = abi.encodeWithSelector(
-            ITokenGateway.finalizeInboundTransfer.selector,
-            _token,
-            _from,
-            _to,
-            _amount,
-            GatewayMessageHandler.encodeToL2GatewayMsg(deployData, _data)
-        );
+    function _getOutboundGatewayData(address _token) internal view override returns (bytes memory) {
+        // the deploy data is only needed until the L2 gateway confirms the token was deployed,
+        // after which the L2 token is used as is and the static calls and extra calldata are skipped
+        if (isL2TokenDeployed[_token]) {
+            return "";
+        }
+        return
+            abi.encode(
+                callStatic(_token, ERC20.name.selector),
+                callStatic(_token, ERC20.symbol.selector),
+                callStatic(_token, ERC20.decimals.selector)
+            );
+    }
 
-        return outboundCalldata;
+    function _getOutboundGatewayDataPacked(address _token)
+        internal
+        view
+        override
+        returns (bytes memory)
+    {
+        if (isL2TokenDeployed[_token]) {
+            return "";
+        }
+        // metadata is normalized here, so the L2 token doesn't have to parse the raw results
+        return
+            TokenMetadataCodec.encode(
+                callStatic(_token, ERC20.name.selector),
+                callStatic(_token, ERC20.symbol.selector),
+                callStatic(_token, ERC20.decimals.selector)
+            );
     }
 
     function calculateL2TokenAddress(address l1ERC20)
@@ -155,12 +336,43 @@ contract L1ERC20Gateway is L1ArbitrumExtendedGateway {
         override(ITokenGateway, TokenGateway)
         returns (address)
     {
-        bytes32 salt = getSalt(l1ERC20);
-        return Create2.computeAddress(salt, cloneableProxyHash, l2BeaconProxyFactory);
+        return
+            L2TokenAddress.calculateL2TokenAddress(
+                _getL2BeaconProxyFactory(),
+                _getCloneableProxyHash(),
+                _getCounterpartGateway(),
+                l1ERC20
+            );
+    }
+
+    function calculateL2TokenAddresses(address[] calldata l1ERC20s)
+        public
+        view
+        override
+        returns (address[] memory l2Tokens)
+    {
+        // the deployment parameters are only loaded once for all the tokens
+        address factory = _getL2BeaconProxyFactory();
+        bytes32 proxyHash = _getCloneableProxyHash();
+        address counterpart = _getCounterpartGateway();
+
+        l2Tokens = new address[](l1ERC20s.length);
+        for (uint256 i = 0; i < l1ERC20s.length; i++) {
+            l2Tokens[i] = L2TokenAddress.calculateL2TokenAddress(
+                factory,
+                proxyHash,
+                counterpart,
+                l1ERC20s[i]
+            );
+        }
+    }
+
+    /// @dev see _getCounterpartGateway, the L2 token address is derived from these on every deposit
+    function _getCloneableProxyHash() internal view virtual returns (bytes32) {
+        return cloneableProxyHash;
     }
 
-    function getSalt(address l1ERC20) internal view returns (bytes32) {
-        // TODO: use a library
-        return keccak256(abi.encode(counterpartGateway, keccak256(abi.encode(l1ERC20))));
+    function _getL2BeaconProxyFactory() internal view virtual returns (address) {
+        return l2BeaconProxyFactory;
     }
 }
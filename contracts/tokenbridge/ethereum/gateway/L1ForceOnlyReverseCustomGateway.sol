@@ -33,4 +33,16 @@ contract L1ForceOnlyReverseCustomGateway is L1ReverseCustomGateway {
     ) public payable virtual override returns (uint256) {
         revert("REGISTER_TOKEN_ON_L2_DISABLED");
     }
+
+    function registerTokensToL2(
+        address[] calldata,
+        address[] calldata,
+        bytes[] calldata,
+        uint256,
+        uint256,
+        uint256,
+        uint256
+    ) external payable virtual override returns (uint256) {
+        revert("REGISTER_TOKEN_ON_L2_DISABLED");
+    }
 }
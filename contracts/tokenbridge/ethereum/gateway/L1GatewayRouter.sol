@@ -27,6 +27,7 @@ import "../../arbitrum/gateway/L2GatewayRouter.sol";
 import "../../libraries/ERC165.sol";
 import "./IL1GatewayRouter.sol";
 import "./IL1ArbitrumGateway.sol";
+import "./IL1WethGateway.sol";
 
 /**
  * @title Handles deposits from Erhereum into Arbitrum. Tokens are routered to their appropriate L1 gateway (Router itself also conforms to the Gateway itnerface).
@@ -44,6 +45,24 @@ contract L1GatewayRouter is
     address public override owner;
     address public override inbox;
 
+    /// @dev tokens of a batched deposit that resolve to the same gateway
+    struct GatewayBatch {
+        address gateway;
+        bool readsAppendedSender;
+        address[] tokens;
+        address[] to;
+        uint256[] amounts;
+    }
+
+    /// @dev costs of a deposit, see quoteDeposit
+    struct DepositQuote {
+        address gateway;
+        uint256 calldataLength;
+        uint256 submissionFee;
+        uint256 retryableValue;
+        uint256 tokenTotalFeeAmount;
+    }
+
     modifier onlyOwner() {
         require(msg.sender == owner, "ONLY_OWNER");
         _;
@@ -55,7 +74,7 @@ contract L1GatewayRouter is
         address, // was _whitelist, now unused
         address _counterpartGateway,
         address _inbox
-    ) public {
+    ) public virtual {
         GatewayRouter._initialize(_counterpartGateway, address(0), _defaultGateway);
         owner = _owner;
         WhitelistConsumer.whitelist = address(0);
@@ -85,7 +104,7 @@ contract L1GatewayRouter is
         uint256 _maxSubmissionCost,
         uint256 feeAmount
     ) internal returns (uint256) {
-        defaultGateway = newL1DefaultGateway;
+        _setDefaultGatewayEntry(newL1DefaultGateway);
 
         emit DefaultGatewayUpdated(newL1DefaultGateway);
 
@@ -238,7 +257,7 @@ contract L1GatewayRouter is
         require(_token.length == _gateway.length, "WRONG_LENGTH");
 
         for (uint256 i = 0; i < _token.length; i++) {
-            l1TokenToGateway[_token[i]] = _gateway[i];
+            _setGatewayEntry(_token[i], _gateway[i]);
             emit GatewaySet(_token[i], _gateway[i]);
             // overwrite memory so the L2 router receives the L2 address of each gateway
             if (_gateway[i] != address(0) && _gateway[i] != DISABLED) {
@@ -275,6 +294,121 @@ contract L1GatewayRouter is
             );
     }
 
+    /**
+     * @notice Allows owner to register gateways for a large number of tokens, sending one retryable ticket per chunk
+     * @dev Registers the tokens in `[_start, _end)`, in chunks of `_chunkSize` tokens. Each chunk is a separate
+     *      retryable that can be redeemed on its own, so a long registration can be sent over multiple transactions
+     *      by resuming from the `_end` of the previous one. msg.value must cover the fees of every chunk.
+     * @param _token list of L1 token addresses
+     * @param _gateway list of L1 gateway addresses
+     * @param _start index of the first token to register
+     * @param _end index after the last token to register
+     * @param _chunkSize max number of tokens registered by each retryable ticket
+     * @param _l2GasParams gas params of each retryable ticket
+     * @return Retryable ticket ID of each chunk
+     */
+    function setGatewaysInChunks(
+        address[] calldata _token,
+        address[] calldata _gateway,
+        uint256 _start,
+        uint256 _end,
+        uint256 _chunkSize,
+        L2GasParams calldata _l2GasParams
+    ) external payable virtual onlyOwner returns (uint256[] memory) {
+        uint256 feeAmount = _l2GasParams._maxSubmissionCost +
+            _l2GasParams._maxGas *
+            _l2GasParams._gasPriceBid;
+        require(msg.value == feeAmount * _numChunks(_start, _end, _chunkSize), "WRONG_VALUE");
+        return
+            _setGatewaysInChunks(
+                _token,
+                _gateway,
+                _start,
+                _end,
+                _chunkSize,
+                _l2GasParams,
+                feeAmount
+            );
+    }
+
+    function _setGatewaysInChunks(
+        address[] calldata _token,
+        address[] calldata _gateway,
+        uint256 _start,
+        uint256 _end,
+        uint256 _chunkSize,
+        L2GasParams calldata _l2GasParams,
+        uint256 feeAmount
+    ) internal returns (uint256[] memory seqNums) {
+        require(_token.length == _gateway.length, "WRONG_LENGTH");
+        require(_end <= _token.length, "INVALID_END");
+
+        seqNums = new uint256[](_numChunks(_start, _end, _chunkSize));
+        for (uint256 i = 0; i < seqNums.length; i++) {
+            uint256 chunkEnd = _start + _chunkSize < _end ? _start + _chunkSize : _end;
+            seqNums[i] = _setGatewaysChunk(
+                _token[_start:chunkEnd],
+                _gateway[_start:chunkEnd],
+                _l2GasParams,
+                feeAmount
+            );
+            _start = chunkEnd;
+        }
+    }
+
+    function _setGatewaysChunk(
+        address[] calldata _token,
+        address[] calldata _gateway,
+        L2GasParams calldata _l2GasParams,
+        uint256 feeAmount
+    ) internal returns (uint256) {
+        address[] memory l2Gateway = new address[](_gateway.length);
+        // tokens are usually registered in runs sharing the same gateway,
+        // so its counterpart is only queried when the gateway changes
+        address lastGateway;
+        address lastCounterpart;
+        for (uint256 i = 0; i < _token.length; i++) {
+            address gateway = _gateway[i];
+            _setGatewayEntry(_token[i], gateway);
+            emit GatewaySet(_token[i], gateway);
+            if (gateway == address(0) || gateway == DISABLED) {
+                l2Gateway[i] = gateway;
+                continue;
+            }
+            // same check as _setGateways, the gateway must be able to handle the token
+            require(
+                TokenGateway(gateway).calculateL2TokenAddress(_token[i]) != address(0),
+                "TOKEN_NOT_HANDLED_BY_GATEWAY"
+            );
+            if (gateway != lastGateway) {
+                lastGateway = gateway;
+                lastCounterpart = TokenGateway(gateway).counterpartGateway();
+            }
+            l2Gateway[i] = lastCounterpart;
+        }
+
+        return
+            sendTxToL2(
+                inbox,
+                counterpartGateway,
+                msg.sender,
+                feeAmount,
+                0,
+                _l2GasParams,
+                abi.encodeWithSelector(L2GatewayRouter.setGateway.selector, _token, l2Gateway)
+            );
+    }
+
+    function _numChunks(
+        uint256 _start,
+        uint256 _end,
+        uint256 _chunkSize
+    ) internal pure returns (uint256) {
+        require(_chunkSize != 0, "INVALID_CHUNK_SIZE");
+        require(_start < _end, "INVALID_START");
+        return (_end - _start - 1) / _chunkSize + 1;
+    }
+
     function outboundTransfer(
         address _token,
         address _to,
@@ -315,12 +449,31 @@ contract L1GatewayRouter is
         bytes calldata _data
     ) public payable override returns (bytes memory) {
         address gateway = getGateway(_token);
+        emit TransferRouted(_token, msg.sender, _to, gateway);
+
+        if (GatewayMessageHandler.isPackedMsg(_data) && _readsAppendedSender(_token)) {
+            // packed user data is forwarded as is, the gateway reads the sender from the calldata
+            return
+                _callGatewayWithSender(
+                    gateway,
+                    msg.value,
+                    abi.encodeWithSelector(
+                        IL1ArbitrumGateway.outboundTransferCustomRefund.selector,
+                        _token,
+                        _refundTo,
+                        _to,
+                        _amount,
+                        _maxGas,
+                        _gasPriceBid,
+                        _data
+                    )
+                );
+        }
+
         bytes memory gatewayData = GatewayMessageHandler.encodeFromRouterToGateway(
             msg.sender,
             _data
         );
-
-        emit TransferRouted(_token, msg.sender, _to, gateway);
         // here we use `IL1ArbitrumGateway` since we don't assume all ITokenGateway implements `outboundTransferCustomRefund`
         return
             IL1ArbitrumGateway(gateway).outboundTransferCustomRefund{ value: msg.value }(
@@ -334,6 +487,285 @@ contract L1GatewayRouter is
             );
     }
 
+    /**
+     * @notice Deposit ERC20 token from Ethereum into Arbitrum, approving the gateway with an EIP-2612 permit
+     *         in the same transaction.
+     * @dev The permit must be signed by the sender for the gateway returned by `getGateway`. Only the token is
+     *      permitted, gateways of chains with a custom fee token still need an approval of the fees.
+     * @param _token L1 address of ERC20
+     * @param _refundTo Account, or its L2 alias if it have code in L1, to be credited with excess gas refund in L2
+     * @param _to Account to be credited with the tokens in the L2 (can be the user's L2 account or a contract), not subject to L2 aliasing
+     * @param _amount Token Amount, also the permitted value
+     * @param _maxGas Max gas deducted from user's L2 balance to cover L2 execution
+     * @param _gasPriceBid Gas price for L2 execution
+     * @param _data encoded data from router and user
+     * @param _permitData permit of `_amount` signed by the sender for the gateway
+     * @return res abi encoded inbox sequence number
+     */
+    function outboundTransferCustomRefundWithPermit(
+        address _token,
+        address _refundTo,
+        address _to,
+        uint256 _amount,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        bytes calldata _data,
+        PermitData calldata _permitData
+    ) external payable returns (bytes memory) {
+        _permit(_token, getGateway(_token), _amount, _permitData);
+        return
+            outboundTransferCustomRefund(
+                _token,
+                _refundTo,
+                _to,
+                _amount,
+                _maxGas,
+                _gasPriceBid,
+                _data
+            );
+    }
+
+    /**
+     * @notice Deposit ether from Ethereum into Arbitrum through the WETH gateway, credited as WETH in the L2
+     * @dev `_token` has to be L1 WETH, and its gateway has to implement IL1WethGateway. msg.value is the deposited
+     *      `_amount` plus the retryable cost.
+     * @param _token L1 address of WETH
+     * @param _refundTo Account, or its L2 alias if it have code in L1, to be credited with excess gas refund in L2
+     * @param _to Account to be credited with the tokens in the L2 (can be an EOA or a contract), not subject to L2 aliasing.
+     * @param _amount Ether amount
+     * @param _maxGas Max gas deducted from user's L2 balance to cover L2 execution
+     * @param _gasPriceBid Gas price for L2 execution
+     * @param _data encoded data from router and user
+     * @return res abi encoded inbox sequence number
+     */
+    function outboundTransferETHCustomRefund(
+        address _token,
+        address _refundTo,
+        address _to,
+        uint256 _amount,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        bytes calldata _data
+    ) external payable virtual returns (bytes memory) {
+        address gateway = getGateway(_token);
+        emit TransferRouted(_token, msg.sender, _to, gateway);
+
+        if (GatewayMessageHandler.isPackedMsg(_data) && _readsAppendedSender(_token)) {
+            // packed user data is forwarded as is, the gateway reads the sender from the calldata
+            return
+                _callGatewayWithSender(
+                    gateway,
+                    msg.value,
+                    abi.encodeWithSelector(
+                        IL1WethGateway.outboundTransferETHCustomRefund.selector,
+                        _token,
+                        _refundTo,
+                        _to,
+                        _amount,
+                        _maxGas,
+                        _gasPriceBid,
+                        _data
+                    )
+                );
+        }
+
+        bytes memory gatewayData = GatewayMessageHandler.encodeFromRouterToGateway(
+            msg.sender,
+            _data
+        );
+        return
+            IL1WethGateway(gateway).outboundTransferETHCustomRefund{ value: msg.value }(
+                _token,
+                _refundTo,
+                _to,
+                _amount,
+                _maxGas,
+                _gasPriceBid,
+                gatewayData
+            );
+    }
+
+    /**
+     * @notice Quote the retryable ticket of a deposit through outboundTransferCustomRefund, in a single call
+     * @dev The L2 gas limit is not estimated here, it still needs to be queried from the L2 (ie with
+     *      NodeInterface.estimateRetryableTicket). The submission fee is computed for `_l1BaseFee` instead of
+     *      block.basefee, which is 0 or stale in most eth_call contexts. The caller picks the base fee the deposit
+     *      is expected to be included at, ie the latest one with a margin in case it increases.
+     * @param _token L1 address of ERC20
+     * @param _from account depositing the tokens
+     * @param _to Account to be credited with the tokens in the L2
+     * @param _amount Token Amount
+     * @param _data callhook data of the deposit, without the max submission cost
+     * @param _maxGas Max gas deducted from user's L2 balance to cover L2 execution
+     * @param _gasPriceBid Gas price for L2 execution
+     * @param _l1BaseFee L1 base fee used to compute the submission fee
+     * @return quote resolved gateway, length of the L2 calldata, submission fee and msg.value of the deposit.
+     *         tokenTotalFeeAmount is only used by chains with a custom fee token
+     */
+    function quoteDeposit(
+        address _token,
+        address _from,
+        address _to,
+        uint256 _amount,
+        bytes calldata _data,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        uint256 _l1BaseFee
+    ) public view virtual returns (DepositQuote memory quote) {
+        quote.gateway = getGateway(_token);
+        quote.calldataLength = getOutboundCalldata(_token, _from, _to, _amount, _data).length;
+        quote.submissionFee = IInbox(inbox).calculateRetryableSubmissionFee(
+            quote.calldataLength,
+            _l1BaseFee
+        );
+        quote.retryableValue = quote.submissionFee + _maxGas * _gasPriceBid;
+    }
+
+    /**
+     * @notice Deposit multiple ERC20 tokens from Ethereum into Arbitrum, creating a single retryable ticket per resolved gateway
+     * @dev Tokens are grouped by their registered or otherwise default gateway, in order of first appearance.
+     *      `_maxGas`, `_data` and `_value` hold one entry per group, so the caller should resolve gateways in advance
+     *      using `getGateway`. TransferRouted is emitted for every token, reverts if a token has no gateway.
+     * @param _token L1 addresses of ERC20s
+     * @param _refundTo Account, or its L2 alias if it have code in L1, to be credited with excess gas refund in L2
+     * @param _to Accounts to be credited with the tokens in the L2 (can be EOAs or contracts), not subject to L2 aliasing.
+     * @param _amount Token Amounts
+     * @param _maxGas Max gas deducted from user's L2 balance to cover L2 execution, per gateway group
+     * @param _gasPriceBid Gas price for L2 execution
+     * @param _data encoded data from the user, per gateway group
+     * @param _value call value forwarded to each gateway group, must add up to msg.value
+     * @return res abi encoded inbox sequence number of each gateway group
+     */
+    function outboundTransferBatchCustomRefund(
+        address[] memory _token,
+        address _refundTo,
+        address[] memory _to,
+        uint256[] memory _amount,
+        uint256[] memory _maxGas,
+        uint256 _gasPriceBid,
+        bytes[] calldata _data,
+        uint256[] memory _value
+    ) public payable returns (bytes[] memory res) {
+        GatewayBatch[] memory batches = _batchByGateway(_token, _to, _amount);
+        require(
+            batches.length == _maxGas.length &&
+                batches.length == _data.length &&
+                batches.length == _value.length,
+            "WRONG_LENGTH"
+        );
+
+        uint256 totalValue;
+        for (uint256 i = 0; i < _value.length; i++) {
+            totalValue += _value[i];
+        }
+        require(totalValue == msg.value, "WRONG_VALUE");
+
+        res = new bytes[](batches.length);
+        for (uint256 i = 0; i < batches.length; i++) {
+            res[i] = _outboundTransferBatch(
+                batches[i],
+                _refundTo,
+                _maxGas[i],
+                _gasPriceBid,
+                _data[i],
+                _value[i]
+            );
+        }
+    }
+
+    function _batchByGateway(
+        address[] memory _token,
+        address[] memory _to,
+        uint256[] memory _amount
+    ) internal returns (GatewayBatch[] memory batches) {
+        require(_token.length == _to.length && _token.length == _amount.length, "WRONG_LENGTH");
+
+        uint256[] memory tokenGroups;
+        address[] memory groupGateways;
+        uint256[] memory groupSizes;
+        uint256 numGroups;
+        {
+            address[] memory gateways = new address[](_token.length);
+            for (uint256 i = 0; i < _token.length; i++) {
+                gateways[i] = getGateway(_token[i]);
+                require(gateways[i] != ZERO_ADDR, "NO_GATEWAY");
+                emit TransferRouted(_token[i], msg.sender, _to[i], gateways[i]);
+            }
+            (tokenGroups, groupGateways, groupSizes, numGroups) = _groupByGateway(gateways);
+        }
+
+        batches = new GatewayBatch[](numGroups);
+        for (uint256 g = 0; g < numGroups; g++) {
+            batches[g] = GatewayBatch({
+                gateway: groupGateways[g],
+                readsAppendedSender: false,
+                tokens: new address[](groupSizes[g]),
+                to: new address[](groupSizes[g]),
+                amounts: new uint256[](groupSizes[g])
+            });
+            // refilled below as the position of the next token of the group
+            groupSizes[g] = 0;
+        }
+
+        // gather the tokens of each group, keeping their order
+        for (uint256 i = 0; i < _token.length; i++) {
+            GatewayBatch memory batch = batches[tokenGroups[i] - 1];
+            uint256 k = groupSizes[tokenGroups[i] - 1]++;
+            if (k == 0) {
+                // every token of the group resolves to the same gateway
+                (, batch.readsAppendedSender) = _resolveGateway(_token[i]);
+            }
+            batch.tokens[k] = _token[i];
+            batch.to[k] = _to[i];
+            batch.amounts[k] = _amount[i];
+        }
+    }
+
+    function _outboundTransferBatch(
+        GatewayBatch memory _batch,
+        address _refundTo,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        bytes calldata _data,
+        uint256 _value
+    ) internal returns (bytes memory) {
+        if (GatewayMessageHandler.isPackedMsg(_data) && _batch.readsAppendedSender) {
+            // packed user data is forwarded as is, the gateway reads the sender from the calldata
+            return
+                _callGatewayWithSender(
+                    _batch.gateway,
+                    _value,
+                    abi.encodeWithSelector(
+                        IL1ArbitrumBatchGateway.outboundTransferBatchCustomRefund.selector,
+                        _batch.tokens,
+                        _refundTo,
+                        _batch.to,
+                        _batch.amounts,
+                        _maxGas,
+                        _gasPriceBid,
+                        _data
+                    )
+                );
+        }
+
+        bytes memory gatewayData = GatewayMessageHandler.encodeFromRouterToGateway(
+            msg.sender,
+            _data
+        );
+        return
+            IL1ArbitrumBatchGateway(_batch.gateway).outboundTransferBatchCustomRefund{
+                value: _value
+            }(
+                _batch.tokens,
+                _refundTo,
+                _batch.to,
+                _batch.amounts,
+                _maxGas,
+                _gasPriceBid,
+                gatewayData
+            );
+    }
+
     modifier onlyCounterpartGateway() override {
         // don't expect messages from L2 router
         revert("ONLY_COUNTERPART_GATEWAY");
@@ -350,6 +782,7 @@ contract L1GatewayRouter is
         // using function selector instead of single function interfaces to reduce bloat
         return
             interfaceId == this.outboundTransferCustomRefund.selector ||
+            interfaceId == this.outboundTransferBatchCustomRefund.selector ||
             super.supportsInterface(interfaceId);
     }
 }
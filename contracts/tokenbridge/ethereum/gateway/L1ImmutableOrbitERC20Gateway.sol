@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "./L1OrbitERC20Gateway.sol";
+
+/**
+ * @title Layer 1 standard gateway implementation dedicated to a single ERC20-based rollup
+ * @notice Behaves as L1OrbitERC20Gateway, but its configuration is set in the constructor so deposits and withdrawals
+ * don't load it from storage. It only overrides the config getters of the base gateway, and keeps its storage layout.
+ * @dev Deployed by L1AtomicTokenBridgeCreator as the logic of a single chain's standard gateway proxy.
+ * initialize must still be called with the same values, so the public getters stay consistent.
+ */
+contract L1ImmutableOrbitERC20Gateway is L1OrbitERC20Gateway {
+    address internal immutable immutableCounterpartGateway;
+    address internal immutable immutableRouter;
+    address internal immutable immutableInbox;
+    bytes32 internal immutable immutableCloneableProxyHash;
+    address internal immutable immutableL2BeaconProxyFactory;
+
+    constructor(
+        address _l2Counterpart,
+        address _router,
+        address _inbox,
+        bytes32 _cloneableProxyHash,
+        address _l2BeaconProxyFactory
+    ) {
+        immutableCounterpartGateway = _l2Counterpart;
+        immutableRouter = _router;
+        immutableInbox = _inbox;
+        immutableCloneableProxyHash = _cloneableProxyHash;
+        immutableL2BeaconProxyFactory = _l2BeaconProxyFactory;
+    }
+
+    function initialize(
+        address _l2Counterpart,
+        address _router,
+        address _inbox,
+        bytes32 _cloneableProxyHash,
+        address _l2BeaconProxyFactory
+    ) public override {
+        require(
+            _l2Counterpart == immutableCounterpartGateway &&
+                _router == immutableRouter &&
+                _inbox == immutableInbox &&
+                _cloneableProxyHash == immutableCloneableProxyHash &&
+                _l2BeaconProxyFactory == immutableL2BeaconProxyFactory,
+            "IMMUTABLE_CONFIG_MISMATCH"
+        );
+        super.initialize(_l2Counterpart, _router, _inbox, _cloneableProxyHash, _l2BeaconProxyFactory);
+    }
+
+    function isRouter(address _target) internal view override returns (bool isTargetRouter) {
+        return _target == immutableRouter;
+    }
+
+    function _getCounterpartGateway() internal view override returns (address) {
+        return immutableCounterpartGateway;
+    }
+
+    function _getInbox() internal view override returns (address) {
+        return immutableInbox;
+    }
+
+    function _getCloneableProxyHash() internal view override returns (bytes32) {
+        return immutableCloneableProxyHash;
+    }
+
+    function _getL2BeaconProxyFactory() internal view override returns (address) {
+        return immutableL2BeaconProxyFactory;
+    }
+}
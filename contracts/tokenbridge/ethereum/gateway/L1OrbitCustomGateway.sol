@@ -5,6 +5,8 @@ pragma solidity ^0.8.0;
 import { L1CustomGateway } from "./L1CustomGateway.sol";
 import { IERC20Inbox } from "../L1ArbitrumMessenger.sol";
 import { IERC20Bridge } from "../../libraries/IERC20Bridge.sol";
+import { GatewayMessageHandler } from "../../libraries/gateway/GatewayMessageHandler.sol";
+import { BytesLib } from "../../libraries/BytesLib.sol";
 import { IERC20 } from "@openzeppelin/contracts/token/ERC20/ERC20.sol";
 import { SafeERC20 } from "@openzeppelin/contracts/token/ERC20/utils/SafeERC20.sol";
 
@@ -15,6 +17,27 @@ import { SafeERC20 } from "@openzeppelin/contracts/token/ERC20/utils/SafeERC20.s
 contract L1OrbitCustomGateway is L1CustomGateway {
     using SafeERC20 for IERC20;
 
+    /// @notice rollup's native token used to pay for fees, cached so deposits don't query the bridge for it
+    address public nativeFeeToken;
+
+    function initialize(
+        address _l1Counterpart,
+        address _l1Router,
+        address _inbox,
+        address _owner
+    ) public override {
+        super.initialize(_l1Counterpart, _l1Router, _inbox, _owner);
+        _cacheNativeFeeToken();
+    }
+
+    /**
+     * @notice Cache the native token of gateways initialized before it was stored
+     */
+    function postUpgradeInit() public override {
+        super.postUpgradeInit();
+        _cacheNativeFeeToken();
+    }
+
     /**
      * @notice Allows L1 Token contract to trustlessly register its custom L2 counterpart, in an ERC20-based rollup. Retryable costs are paid in native token.
      * @param _l2Address counterpart address of L1 token
@@ -101,6 +124,41 @@ contract L1OrbitCustomGateway is L1CustomGateway {
             );
     }
 
+    /**
+     * @notice Register custom L2 counterparts of multiple L1 tokens in a single retryable ticket.
+     * @dev See L1CustomGateway.registerTokensToL2, fees will be transferred from the caller to the bridge.
+     * @param _l1Addresses array of L1 addresses
+     * @param _l2Addresses array of L2 addresses
+     * @param _signatures ERC-1271 signature of each L1 token for its pair
+     * @param _deadline timestamp after which the signatures expire
+     * @param _maxGas max gas for L2 retryable execution
+     * @param _gasPriceBid gas price for L2 retryable ticket
+     * @param _maxSubmissionCost base submission cost for L2 retryable ticket
+     * @param _feeAmount total amount of fees in native token to cover for retryable ticket costs. This amount will be transferred from user to bridge.
+     * @return Retryable ticket ID
+     */
+    function registerTokensToL2(
+        address[] calldata _l1Addresses,
+        address[] calldata _l2Addresses,
+        bytes[] calldata _signatures,
+        uint256 _deadline,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        uint256 _maxSubmissionCost,
+        uint256 _feeAmount
+    ) external returns (uint256) {
+        _checkTokenRegistrations(_l1Addresses, _l2Addresses, _signatures, _deadline);
+        return
+            _forceRegisterTokenToL2(
+                _l1Addresses,
+                _l2Addresses,
+                _maxGas,
+                _gasPriceBid,
+                _maxSubmissionCost,
+                _feeAmount
+            );
+    }
+
     /**
      * @notice Revert 'registerTokenToL2' entrypoint which doesn't have total amount of token fees as an argument.
      */
@@ -139,6 +197,21 @@ contract L1OrbitCustomGateway is L1CustomGateway {
         revert("NOT_SUPPORTED_IN_ORBIT");
     }
 
+    /**
+     * @notice Revert 'registerTokensToL2' entrypoint which doesn't have total amount of token fees as an argument.
+     */
+    function registerTokensToL2(
+        address[] calldata,
+        address[] calldata,
+        bytes[] calldata,
+        uint256,
+        uint256,
+        uint256,
+        uint256
+    ) external payable override returns (uint256) {
+        revert("NOT_SUPPORTED_IN_ORBIT");
+    }
+
     function _parseUserEncodedData(bytes memory data)
         internal
         pure
@@ -149,10 +222,17 @@ contract L1OrbitCustomGateway is L1CustomGateway {
             uint256 tokenTotalFeeAmount
         )
     {
-        (maxSubmissionCost, callHookData, tokenTotalFeeAmount) = abi.decode(
-            data,
-            (uint256, bytes, uint256)
-        );
+        if (GatewayMessageHandler.isPackedUserData(data)) {
+            require(data.length >= 65, "INVALID_PACKED_MSG");
+            maxSubmissionCost = BytesLib.toUint(data, 1);
+            tokenTotalFeeAmount = BytesLib.toUint(data, 33);
+            callHookData = BytesLib.slice(data, 65, data.length - 65);
+        } else {
+            (maxSubmissionCost, callHookData, tokenTotalFeeAmount) = abi.decode(
+                data,
+                (uint256, bytes, uint256)
+            );
+        }
     }
 
     function _initiateDeposit(
@@ -198,11 +278,11 @@ contract L1OrbitCustomGateway is L1CustomGateway {
             // Transfer native token amount needed to pay for retryable fees to the inbox.
             // Fee tokens will be transferred from user who initiated the action - that's `_user` account in
             // case call was routed by router, or msg.sender in case gateway's entrypoint was called directly.
-            address nativeFeeToken = IERC20Bridge(address(getBridge(_inbox))).nativeToken();
-            uint256 inboxNativeTokenBalance = IERC20(nativeFeeToken).balanceOf(_inbox);
+            address feeToken = _getNativeFeeToken(_inbox);
+            uint256 inboxNativeTokenBalance = IERC20(feeToken).balanceOf(_inbox);
             if (inboxNativeTokenBalance < _totalFeeAmount) {
                 address transferFrom = isRouter(msg.sender) ? _user : msg.sender;
-                IERC20(nativeFeeToken).safeTransferFrom(
+                IERC20(feeToken).safeTransferFrom(
                     transferFrom,
                     _inbox,
                     _totalFeeAmount - inboxNativeTokenBalance
@@ -223,4 +303,21 @@ contract L1OrbitCustomGateway is L1CustomGateway {
                 _data
             );
     }
+
+    /**
+     * @notice get rollup's native token that's used to pay for fees
+     * @dev falls back to querying the bridge until the cache is set by postUpgradeInit
+     */
+    function _getNativeFeeToken(address _inbox) internal view returns (address feeToken) {
+        feeToken = nativeFeeToken;
+        if (feeToken == address(0)) {
+            feeToken = IERC20Bridge(address(getBridge(_inbox))).nativeToken();
+        }
+    }
+
+    function _cacheNativeFeeToken() internal {
+        // templates are initialized with a placeholder inbox, their cache is left empty
+        if (inbox.code.length == 0) return;
+        nativeFeeToken = IERC20Bridge(address(getBridge(inbox))).nativeToken();
+    }
 }
@@ -6,6 +6,8 @@ import { L1ERC20Gateway, IERC20 } from "./L1ERC20Gateway.sol";
 import { IERC20Inbox } from "../L1ArbitrumMessenger.sol";
 import { SafeERC20 } from "@openzeppelin/contracts/token/ERC20/utils/SafeERC20.sol";
 import { IERC20Bridge } from "../../libraries/IERC20Bridge.sol";
+import { GatewayMessageHandler } from "../../libraries/gateway/GatewayMessageHandler.sol";
+import { BytesLib } from "../../libraries/BytesLib.sol";
 
 /**
  * @title Layer 1 Gateway contract for bridging standard ERC20s in ERC20-based rollup
@@ -16,6 +18,28 @@ import { IERC20Bridge } from "../../libraries/IERC20Bridge.sol";
 contract L1OrbitERC20Gateway is L1ERC20Gateway {
     using SafeERC20 for IERC20;
 
+    /// @notice rollup's native token used to pay for fees, cached so deposits don't query the bridge for it
+    address public nativeFeeToken;
+
+    function initialize(
+        address _l2Counterpart,
+        address _router,
+        address _inbox,
+        bytes32 _cloneableProxyHash,
+        address _l2BeaconProxyFactory
+    ) public virtual override {
+        super.initialize(_l2Counterpart, _router, _inbox, _cloneableProxyHash, _l2BeaconProxyFactory);
+        _cacheNativeFeeToken();
+    }
+
+    /**
+     * @notice Cache the native token of gateways initialized before it was stored
+     */
+    function postUpgradeInit() public override {
+        super.postUpgradeInit();
+        _cacheNativeFeeToken();
+    }
+
     function outboundTransferCustomRefund(
         address _l1Token,
         address _refundTo,
@@ -44,6 +68,35 @@ contract L1OrbitERC20Gateway is L1ERC20Gateway {
             );
     }
 
+    function outboundTransferBatchCustomRefund(
+        address[] memory _l1Tokens,
+        address _refundTo,
+        address[] memory _to,
+        uint256[] memory _amounts,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        bytes calldata _data
+    ) public payable override returns (bytes memory res) {
+        // fees are paid in native token, so there is no use for ether
+        require(msg.value == 0, "NO_VALUE");
+
+        address feeToken = _getNativeFeeToken();
+        for (uint256 i = 0; i < _l1Tokens.length; i++) {
+            require(_l1Tokens[i] != feeToken, "NOT_ALLOWED_TO_BRIDGE_FEE_TOKEN");
+        }
+
+        return
+            super.outboundTransferBatchCustomRefund(
+                _l1Tokens,
+                _refundTo,
+                _to,
+                _amounts,
+                _maxGas,
+                _gasPriceBid,
+                _data
+            );
+    }
+
     function _parseUserEncodedData(bytes memory data)
         internal
         pure
@@ -54,10 +107,17 @@ contract L1OrbitERC20Gateway is L1ERC20Gateway {
             uint256 tokenTotalFeeAmount
         )
     {
-        (maxSubmissionCost, callHookData, tokenTotalFeeAmount) = abi.decode(
-            data,
-            (uint256, bytes, uint256)
-        );
+        if (GatewayMessageHandler.isPackedUserData(data)) {
+            require(data.length >= 65, "INVALID_PACKED_MSG");
+            maxSubmissionCost = BytesLib.toUint(data, 1);
+            tokenTotalFeeAmount = BytesLib.toUint(data, 33);
+            callHookData = BytesLib.slice(data, 65, data.length - 65);
+        } else {
+            (maxSubmissionCost, callHookData, tokenTotalFeeAmount) = abi.decode(
+                data,
+                (uint256, bytes, uint256)
+            );
+        }
     }
 
     function _initiateDeposit(
@@ -72,8 +132,8 @@ contract L1OrbitERC20Gateway is L1ERC20Gateway {
     ) internal override returns (uint256) {
         return
             sendTxToL2CustomRefund(
-                inbox,
-                counterpartGateway,
+                _getInbox(),
+                _getCounterpartGateway(),
                 _refundTo,
                 _from,
                 tokenTotalFeeAmount,
@@ -103,11 +163,11 @@ contract L1OrbitERC20Gateway is L1ERC20Gateway {
             // Transfer native token amount needed to pay for retryable fees to the inbox.
             // Fee tokens will be transferred from user who initiated the action - that's `_user` account in
             // case call was routed by router, or msg.sender in case gateway's entrypoint was called directly.
-            address nativeFeeToken = _getNativeFeeToken();
-            uint256 inboxNativeTokenBalance = IERC20(nativeFeeToken).balanceOf(_inbox);
+            address feeToken = _getNativeFeeToken();
+            uint256 inboxNativeTokenBalance = IERC20(feeToken).balanceOf(_inbox);
             if (inboxNativeTokenBalance < _totalFeeAmount) {
                 address transferFrom = isRouter(msg.sender) ? _user : msg.sender;
-                IERC20(nativeFeeToken).safeTransferFrom(
+                IERC20(feeToken).safeTransferFrom(
                     transferFrom,
                     _inbox,
                     _totalFeeAmount - inboxNativeTokenBalance
@@ -131,9 +191,21 @@ contract L1OrbitERC20Gateway is L1ERC20Gateway {
 
     /**
      * @notice get rollup's native token that's used to pay for fees
+     * @dev falls back to querying the bridge until the cache is set by postUpgradeInit
      */
-    function _getNativeFeeToken() internal view returns (address) {
-        address bridge = address(getBridge(inbox));
-        return IERC20Bridge(bridge).nativeToken();
+    function _getNativeFeeToken() internal view returns (address feeToken) {
+        feeToken = nativeFeeToken;
+        if (feeToken == address(0)) {
+            address bridge = address(getBridge(_getInbox()));
+            feeToken = IERC20Bridge(bridge).nativeToken();
+        }
+    }
+
+    function _cacheNativeFeeToken() internal {
+        address _inbox = _getInbox();
+        // templates are initialized with a placeholder inbox, their cache is left empty
+        if (_inbox.code.length == 0) return;
+        address bridge = address(getBridge(_inbox));
+        nativeFeeToken = IERC20Bridge(bridge).nativeToken();
     }
 }
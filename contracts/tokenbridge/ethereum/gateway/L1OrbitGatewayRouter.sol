@@ -7,6 +7,8 @@ import { IERC20Inbox } from "../L1ArbitrumMessenger.sol";
 import { IERC20 } from "@openzeppelin/contracts/token/ERC20/ERC20.sol";
 import { SafeERC20 } from "@openzeppelin/contracts/token/ERC20/utils/SafeERC20.sol";
 import { IERC20Bridge } from "../../libraries/IERC20Bridge.sol";
+import { FeeTokenScaling } from "../../libraries/FeeTokenScaling.sol";
+import { IERC20Metadata } from "@openzeppelin/contracts/token/ERC20/extensions/IERC20Metadata.sol";
 
 /**
  * @title Handles deposits from L1 into L2 in ERC20-based rollups where custom token is used to pay for fees. Tokens are routed to their appropriate L1 gateway.
@@ -15,6 +17,29 @@ import { IERC20Bridge } from "../../libraries/IERC20Bridge.sol";
 contract L1OrbitGatewayRouter is L1GatewayRouter {
     using SafeERC20 for IERC20;
 
+    /// @notice rollup's native token used to pay for fees, cached with its decimals in a single slot
+    address public nativeFeeToken;
+    uint8 public nativeFeeTokenDecimals;
+
+    function initialize(
+        address _owner,
+        address _defaultGateway,
+        address _whitelist,
+        address _counterpartGateway,
+        address _inbox
+    ) public override {
+        super.initialize(_owner, _defaultGateway, _whitelist, _counterpartGateway, _inbox);
+        _cacheNativeFeeToken();
+    }
+
+    /**
+     * @notice Cache the native token of routers initialized before it was stored
+     */
+    function postUpgradeInit() public override {
+        super.postUpgradeInit();
+        _cacheNativeFeeToken();
+    }
+
     /**
      * @notice Allows owner to register the default gateway.
      * @param newL1DefaultGateway default gateway address
@@ -122,6 +147,70 @@ contract L1OrbitGatewayRouter is L1GatewayRouter {
             );
     }
 
+    /**
+     * @notice Allows owner to register gateways for a large number of tokens, sending one retryable ticket per chunk
+     * @dev See L1GatewayRouter.setGatewaysInChunks, fees of each chunk will be transferred from the owner to the bridge.
+     * @param _token list of L1 token addresses
+     * @param _gateway list of L1 gateway addresses
+     * @param _start index of the first token to register
+     * @param _end index after the last token to register
+     * @param _chunkSize max number of tokens registered by each retryable ticket
+     * @param _l2GasParams gas params of each retryable ticket
+     * @param _feeAmount amount of fees in native token to cover for the costs of each retryable ticket
+     * @return Retryable ticket ID of each chunk
+     */
+    function setGatewaysInChunks(
+        address[] calldata _token,
+        address[] calldata _gateway,
+        uint256 _start,
+        uint256 _end,
+        uint256 _chunkSize,
+        L2GasParams calldata _l2GasParams,
+        uint256 _feeAmount
+    ) external onlyOwner returns (uint256[] memory) {
+        return
+            _setGatewaysInChunks(
+                _token,
+                _gateway,
+                _start,
+                _end,
+                _chunkSize,
+                _l2GasParams,
+                _feeAmount
+            );
+    }
+
+    /**
+     * @notice Quote the retryable ticket of a deposit through outboundTransferCustomRefund, in a single call
+     * @dev See L1GatewayRouter.quoteDeposit. Fees are paid in the native token, so retryableValue is 0 and
+     *      tokenTotalFeeAmount is the fee amount scaled to the decimals of the native token.
+     */
+    function quoteDeposit(
+        address _token,
+        address _from,
+        address _to,
+        uint256 _amount,
+        bytes calldata _data,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        uint256 _l1BaseFee
+    ) public view override returns (DepositQuote memory quote) {
+        quote = super.quoteDeposit(
+            _token,
+            _from,
+            _to,
+            _amount,
+            _data,
+            _maxGas,
+            _gasPriceBid,
+            _l1BaseFee
+        );
+
+        (, uint8 decimals) = _getNativeFeeToken(inbox);
+        quote.tokenTotalFeeAmount = FeeTokenScaling.scaleAmount(quote.retryableValue, decimals);
+        quote.retryableValue = 0;
+    }
+
     function _createRetryable(
         address _inbox,
         address _to,
@@ -137,11 +226,11 @@ contract L1OrbitGatewayRouter is L1GatewayRouter {
         {
             // Transfer native token amount needed to pay for retryable fees to the inbox.
             // Fee tokens will be transferred from msg.sender
-            address nativeFeeToken = IERC20Bridge(address(getBridge(_inbox))).nativeToken();
-            uint256 inboxNativeTokenBalance = IERC20(nativeFeeToken).balanceOf(_inbox);
+            (address feeToken, ) = _getNativeFeeToken(_inbox);
+            uint256 inboxNativeTokenBalance = IERC20(feeToken).balanceOf(_inbox);
             if (inboxNativeTokenBalance < _totalFeeAmount) {
                 uint256 diff = _totalFeeAmount - inboxNativeTokenBalance;
-                IERC20(nativeFeeToken).safeTransferFrom(msg.sender, _inbox, diff);
+                IERC20(feeToken).safeTransferFrom(msg.sender, _inbox, diff);
             }
         }
 
@@ -159,6 +248,31 @@ contract L1OrbitGatewayRouter is L1GatewayRouter {
             );
     }
 
+    /**
+     * @notice get rollup's native token that's used to pay for fees, and its decimals
+     * @dev falls back to querying the bridge until the cache is set by postUpgradeInit
+     */
+    function _getNativeFeeToken(address _inbox)
+        internal
+        view
+        returns (address feeToken, uint8 decimals)
+    {
+        feeToken = nativeFeeToken;
+        if (feeToken == address(0)) {
+            feeToken = IERC20Bridge(address(getBridge(_inbox))).nativeToken();
+            return (feeToken, IERC20Metadata(feeToken).decimals());
+        }
+        decimals = nativeFeeTokenDecimals;
+    }
+
+    function _cacheNativeFeeToken() internal {
+        // templates are initialized with a placeholder inbox, their cache is left empty
+        if (inbox.code.length == 0) return;
+        address feeToken = IERC20Bridge(address(getBridge(inbox))).nativeToken();
+        nativeFeeToken = feeToken;
+        nativeFeeTokenDecimals = IERC20Metadata(feeToken).decimals();
+    }
+
     /**
      * @notice Revert 'setGateway' entrypoint which doesn't have total amount of token fees as an argument.
      */
@@ -208,4 +322,33 @@ contract L1OrbitGatewayRouter is L1GatewayRouter {
     ) external payable override onlyOwner returns (uint256) {
         revert("NOT_SUPPORTED_IN_ORBIT");
     }
+
+    /**
+     * @notice Revert 'setGatewaysInChunks' entrypoint which doesn't have amount of token fees as an argument.
+     */
+    function setGatewaysInChunks(
+        address[] calldata,
+        address[] calldata,
+        uint256,
+        uint256,
+        uint256,
+        L2GasParams calldata
+    ) external payable override onlyOwner returns (uint256[] memory) {
+        revert("NOT_SUPPORTED_IN_ORBIT");
+    }
+
+    /**
+     * @notice Revert 'outboundTransferETHCustomRefund' entrypoint, ether isn't the native fee token of the chain.
+     */
+    function outboundTransferETHCustomRefund(
+        address,
+        address,
+        address,
+        uint256,
+        uint256,
+        uint256,
+        bytes calldata
+    ) external payable override returns (bytes memory) {
+        revert("NOT_SUPPORTED_IN_ORBIT");
+    }
 }
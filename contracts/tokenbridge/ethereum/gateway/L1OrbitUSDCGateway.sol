@@ -5,6 +5,8 @@ pragma solidity ^0.8.0;
 import {L1USDCGateway} from "./L1USDCGateway.sol";
 import {IERC20Inbox} from "../L1ArbitrumMessenger.sol";
 import {IERC20Bridge} from "../../libraries/IERC20Bridge.sol";
+import {GatewayMessageHandler} from "../../libraries/gateway/GatewayMessageHandler.sol";
+import {BytesLib} from "../../libraries/BytesLib.sol";
 import {IERC20} from "@openzeppelin/contracts/token/ERC20/ERC20.sol";
 import {SafeERC20} from "@openzeppelin/contracts/token/ERC20/utils/SafeERC20.sol";
 
@@ -32,14 +34,44 @@ import {SafeERC20} from "@openzeppelin/contracts/token/ERC20/utils/SafeERC20.sol
 contract L1OrbitUSDCGateway is L1USDCGateway {
     using SafeERC20 for IERC20;
 
+    /// @notice rollup's native token used to pay for fees, cached so deposits don't query the bridge for it
+    address public nativeFeeToken;
+
+    function initialize(
+        address _l2Counterpart,
+        address _l1Router,
+        address _inbox,
+        address _l1USDC,
+        address _l2USDC,
+        address _owner
+    ) public override {
+        super.initialize(_l2Counterpart, _l1Router, _inbox, _l1USDC, _l2USDC, _owner);
+        _cacheNativeFeeToken();
+    }
+
+    /**
+     * @notice Cache the native token of gateways initialized before it was stored
+     */
+    function postUpgradeInit() public override {
+        super.postUpgradeInit();
+        _cacheNativeFeeToken();
+    }
+
     function _parseUserEncodedData(bytes memory data)
         internal
         pure
         override
         returns (uint256 maxSubmissionCost, bytes memory callHookData, uint256 tokenTotalFeeAmount)
     {
-        (maxSubmissionCost, callHookData, tokenTotalFeeAmount) =
-            abi.decode(data, (uint256, bytes, uint256));
+        if (GatewayMessageHandler.isPackedUserData(data)) {
+            require(data.length >= 65, "INVALID_PACKED_MSG");
+            maxSubmissionCost = BytesLib.toUint(data, 1);
+            tokenTotalFeeAmount = BytesLib.toUint(data, 33);
+            callHookData = BytesLib.slice(data, 65, data.length - 65);
+        } else {
+            (maxSubmissionCost, callHookData, tokenTotalFeeAmount) =
+                abi.decode(data, (uint256, bytes, uint256));
+        }
     }
 
     function _initiateDeposit(
@@ -84,11 +116,11 @@ contract L1OrbitUSDCGateway is L1USDCGateway {
             // Transfer native token amount needed to pay for retryable fees to the inbox.
             // Fee tokens will be transferred from user who initiated the action - that's `_user` account in
             // case call was routed by router, or msg.sender in case gateway's entrypoint was called directly.
-            address nativeFeeToken = IERC20Bridge(address(getBridge(_inbox))).nativeToken();
-            uint256 inboxNativeTokenBalance = IERC20(nativeFeeToken).balanceOf(_inbox);
+            address feeToken = _getNativeFeeToken(_inbox);
+            uint256 inboxNativeTokenBalance = IERC20(feeToken).balanceOf(_inbox);
             if (inboxNativeTokenBalance < _totalFeeAmount) {
                 address transferFrom = isRouter(msg.sender) ? _user : msg.sender;
-                IERC20(nativeFeeToken).safeTransferFrom(
+                IERC20(feeToken).safeTransferFrom(
                     transferFrom, _inbox, _totalFeeAmount - inboxNativeTokenBalance
                 );
             }
@@ -106,4 +138,21 @@ contract L1OrbitUSDCGateway is L1USDCGateway {
             _data
         );
     }
+
+    /**
+     * @notice get rollup's native token that's used to pay for fees
+     * @dev falls back to querying the bridge until the cache is set by postUpgradeInit
+     */
+    function _getNativeFeeToken(address _inbox) internal view returns (address feeToken) {
+        feeToken = nativeFeeToken;
+        if (feeToken == address(0)) {
+            feeToken = IERC20Bridge(address(getBridge(_inbox))).nativeToken();
+        }
+    }
+
+    function _cacheNativeFeeToken() internal {
+        // templates are initialized with a placeholder inbox, their cache is left empty
+        if (inbox.code.length == 0) return;
+        nativeFeeToken = IERC20Bridge(address(getBridge(inbox))).nativeToken();
+    }
 }
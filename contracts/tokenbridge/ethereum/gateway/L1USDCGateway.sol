@@ -72,7 +72,7 @@ contract L1USDCGateway is L1ArbitrumExtendedGateway {
         address _l1USDC,
         address _l2USDC,
         address _owner
-    ) public {
+    ) public virtual {
         if (_l1USDC == address(0)) {
             revert L1USDCGateway_InvalidL1USDC();
         }
@@ -186,6 +186,26 @@ contract L1USDCGateway is L1ArbitrumExtendedGateway {
         );
     }
 
+    /**
+     * @notice batched entrypoint for depositing USDC, can be used only if deposits are not paused.
+     */
+    function outboundTransferBatchCustomRefund(
+        address[] memory _l1Tokens,
+        address _refundTo,
+        address[] memory _to,
+        uint256[] memory _amounts,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        bytes calldata _data
+    ) public payable override returns (bytes memory res) {
+        if (depositsPaused) {
+            revert L1USDCGateway_DepositsPaused();
+        }
+        return super.outboundTransferBatchCustomRefund(
+            _l1Tokens, _refundTo, _to, _amounts, _maxGas, _gasPriceBid, _data
+        );
+    }
+
     /**
      * @notice only parent chain - child chain USDC token pair is supported
      */
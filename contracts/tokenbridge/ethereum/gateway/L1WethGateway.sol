@@ -24,8 +24,9 @@ import "@openzeppelin/contracts/token/ERC20/IERC20.sol";
 import "../../libraries/IWETH9.sol";
 import "../../test/TestWETH9.sol";
 import "./L1ArbitrumExtendedGateway.sol";
+import "./IL1WethGateway.sol";
 
-contract L1WethGateway is L1ArbitrumExtendedGateway {
+contract L1WethGateway is L1ArbitrumExtendedGateway, IL1WethGateway {
     using SafeERC20 for IERC20;
 
     address public l1Weth;
@@ -73,6 +74,89 @@ contract L1WethGateway is L1ArbitrumExtendedGateway {
             );
     }
 
+    /**
+     * @notice Deposit ether from Ethereum into Arbitrum, credited as WETH in the L2. Initiated by GatewayRouter.
+     * @dev Same as outboundTransferCustomRefund for `l1Weth`, except that the deposited ether is sent along with the
+     *      retryable cost instead of being pulled from the sender's WETH, so there is no need to wrap it first.
+     *      The L2 receives the same message as for WETH deposits.
+     * @param _l1Token L1 address of WETH
+     * @param _refundTo Account, or its L2 alias if it have code in L1, to be credited with excess gas refund in L2
+     * @param _to Account to be credited with the tokens in the L2 (can be an EOA or a contract), not subject to L2 aliasing
+     * @param _amount Ether amount, msg.value needs to cover it on top of the retryable cost
+     * @param _maxGas Max gas deducted from user's L2 balance to cover L2 execution
+     * @param _gasPriceBid Gas price for L2 execution
+     * @param _data encoded data from router and user
+     * @return res abi encoded inbox sequence number
+     */
+    function outboundTransferETHCustomRefund(
+        address _l1Token,
+        address _refundTo,
+        address _to,
+        uint256 _amount,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        bytes calldata _data
+    ) external payable override returns (bytes memory res) {
+        require(isRouter(msg.sender), "NOT_FROM_ROUTER");
+        require(_l1Token == l1Weth, "NOT_WETH");
+        require(msg.value >= _amount, "INSUFFICIENT_VALUE");
+
+        address _from;
+        uint256 seqNum;
+        {
+            uint256 _maxSubmissionCost;
+            bytes memory extraData;
+            (_from, extraData) = GatewayMessageHandler.parseFromRouter(_data, isRouter(msg.sender));
+            (_maxSubmissionCost, extraData, ) = _parseUserEncodedData(extraData);
+
+            _validateCallHookData(extraData, _maxGas);
+
+            // we override the res field to save on the stack
+            res = getOutboundCalldata(_l1Token, _from, _to, _amount, extraData);
+
+            seqNum = _createOutboundETHTx(
+                _refundTo,
+                _from,
+                _amount,
+                _maxGas,
+                _gasPriceBid,
+                _maxSubmissionCost,
+                res
+            );
+        }
+        emit DepositInitiated(_l1Token, _from, _to, seqNum, _amount);
+        _emitDepositMessageSent(_l1Token, seqNum, res);
+        return abi.encode(seqNum);
+    }
+
+    function _createOutboundETHTx(
+        address _refundTo,
+        address _from,
+        uint256 _amount,
+        uint256 _maxGas,
+        uint256 _gasPriceBid,
+        uint256 _maxSubmissionCost,
+        bytes memory _outboundCalldata
+    ) internal returns (uint256) {
+        return
+            sendTxToL2CustomRefund(
+                inbox,
+                counterpartGateway,
+                _refundTo,
+                _from,
+                // msg.value already includes the deposited ether
+                msg.value,
+                // send ether amount to L2 as call value
+                _amount,
+                L2GasParams({
+                    _maxSubmissionCost: _maxSubmissionCost,
+                    _maxGas: _maxGas,
+                    _gasPriceBid: _gasPriceBid
+                }),
+                _outboundCalldata
+            );
+    }
+
     function outboundEscrowTransfer(
         address _l1Token,
         address _from,
@@ -55,5 +55,30 @@ library BytesLib {
 
         return tempBytes32;
     }
+
+    function slice(
+        bytes memory _bytes,
+        uint256 _start,
+        uint256 _length
+    ) internal pure returns (bytes memory) {
+        require(_bytes.length >= (_start + _length), "Read out of bounds");
+        bytes memory tempBytes = new bytes(_length);
+
+        assembly {
+            let src := add(add(_bytes, 0x20), _start)
+            let dest := add(tempBytes, 0x20)
+            for {
+                let i := 0
+            } lt(i, _length) {
+                i := add(i, 0x20)
+            } {
+                mstore(add(dest, i), mload(add(src, i)))
+            }
+            // clear what was copied past the end of the slice in the last word
+            mstore(add(dest, _length), 0)
+        }
+
+        return tempBytes;
+    }
 }
 /* solhint-enable no-inline-assembly */
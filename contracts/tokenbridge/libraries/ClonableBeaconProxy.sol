@@ -5,6 +5,7 @@ pragma solidity >=0.6.0 <0.9.0;
 import "@openzeppelin/contracts/proxy/beacon/BeaconProxy.sol";
 import "@openzeppelin/contracts/proxy/beacon/UpgradeableBeacon.sol";
 import "@openzeppelin/contracts/utils/Create2.sol";
+import "./L2TokenAddress.sol";
 
 interface ProxySetter {
     function beacon() external view returns (address);
@@ -31,7 +32,7 @@ contract BeaconProxyFactory is ProxySetter {
     }
 
     function getSalt(address user, bytes32 userSalt) public pure returns (bytes32) {
-        return keccak256(abi.encode(user, userSalt));
+        return L2TokenAddress.getSalt(user, userSalt);
     }
 
     function createProxy(bytes32 userSalt) external returns (address) {
@@ -47,10 +48,98 @@ contract BeaconProxyFactory is ProxySetter {
         returns (address)
     {
         bytes32 salt = getSalt(user, userSalt);
-        return Create2.computeAddress(salt, cloneableProxyHash, address(this));
+        return L2TokenAddress.computeAddress(address(this), salt, cloneableProxyHash);
     }
 
     function calculateExpectedAddress(bytes32 salt) public view returns (address) {
-        return Create2.computeAddress(salt, cloneableProxyHash, address(this));
+        return L2TokenAddress.computeAddress(address(this), salt, cloneableProxyHash);
+    }
+}
+
+/**
+ * @notice Lighter alternative to ClonableBeaconProxy, deployed by MinimalBeaconProxyFactory.
+ * @dev The beacon is read from the factory at construction and kept in the runtime code, so the proxy writes no
+ * storage when deployed and every call saves the beacon slot SLOAD. The implementation is still queried from the
+ * beacon on every call, so beacon upgrades apply to all tokens at once. The beacon isn't stored in the ERC1967
+ * beacon slot, so tools that rely on it won't detect this contract as a proxy.
+ */
+contract MinimalBeaconProxy {
+    address private immutable beacon;
+
+    constructor() {
+        beacon = ProxySetter(msg.sender).beacon();
+    }
+
+    fallback() external payable {
+        _delegate();
+    }
+
+    receive() external payable {
+        _delegate();
+    }
+
+    function _delegate() private {
+        address _beacon = beacon;
+        assembly {
+            // IBeacon.implementation()
+            mstore(0x00, 0x5c60da1b00000000000000000000000000000000000000000000000000000000)
+            if iszero(staticcall(gas(), _beacon, 0x00, 0x04, 0x00, 0x20)) {
+                revert(0, 0)
+            }
+            let implementation := mload(0x00)
+
+            calldatacopy(0, 0, calldatasize())
+            let result := delegatecall(gas(), implementation, 0, calldatasize(), 0, 0)
+            returndatacopy(0, 0, returndatasize())
+
+            switch result
+            case 0 {
+                revert(0, returndatasize())
+            }
+            default {
+                return(0, returndatasize())
+            }
+        }
+    }
+}
+
+/**
+ * @notice Same as BeaconProxyFactory, but deploys MinimalBeaconProxy. Token addresses are derived the same way,
+ * with this factory's cloneableProxyHash.
+ * @dev Deployed by L2AtomicTokenBridgeFactory, and L1AtomicTokenBridgeCreator predicts its address and
+ * cloneableProxyHash. Chains deployed before keep their BeaconProxyFactory.
+ */
+contract MinimalBeaconProxyFactory is ProxySetter {
+    bytes32 public constant cloneableProxyHash = keccak256(type(MinimalBeaconProxy).creationCode);
+
+    address public override beacon;
+
+    function initialize(address _beacon) external {
+        require(_beacon != address(0), "INVALID_BEACON");
+        require(beacon == address(0), "ALREADY_INIT");
+        beacon = _beacon;
+    }
+
+    function getSalt(address user, bytes32 userSalt) public pure returns (bytes32) {
+        return L2TokenAddress.getSalt(user, userSalt);
+    }
+
+    function createProxy(bytes32 userSalt) external returns (address) {
+        // deployment will fail and this function will revert if contract `salt` is not unique
+        bytes32 salt = getSalt(msg.sender, userSalt);
+        return address(new MinimalBeaconProxy{ salt: salt }());
+    }
+
+    function calculateExpectedAddress(address user, bytes32 userSalt)
+        public
+        view
+        returns (address)
+    {
+        bytes32 salt = getSalt(user, userSalt);
+        return L2TokenAddress.computeAddress(address(this), salt, cloneableProxyHash);
+    }
+
+    function calculateExpectedAddress(bytes32 salt) public view returns (address) {
+        return L2TokenAddress.computeAddress(address(this), salt, cloneableProxyHash);
     }
 }
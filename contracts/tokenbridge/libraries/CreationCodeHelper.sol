@@ -21,4 +21,33 @@ library CreationCodeHelper {
             runtimeCode
         );
     }
+
+    /**
+     * @notice Same as `getCreationCodeFor`, with the deployed code of `target` as deployed code.
+     * @dev The code is copied with EXTCODECOPY right after the constructor bytecode, which is exactly 32 bytes,
+     *      instead of being loaded into memory first and then copied again.
+     * @param target Contract whose deployed bytecode will be used
+     * @return creationCode Creation code of a new contract
+     */
+    function getCreationCodeForDeployedCode(address target)
+        internal
+        view
+        returns (bytes memory creationCode)
+    {
+        assembly {
+            let codeLength := extcodesize(target)
+            creationCode := mload(0x40)
+            mstore(creationCode, add(codeLength, 0x20))
+            // constructor bytecode of getCreationCodeFor, with the 2 bytes of code length at bytes 19-20
+            mstore(
+                add(creationCode, 0x20),
+                or(
+                    0x608060405234801561001057600080fd5b50610000806100206000396000f3fe,
+                    shl(88, and(codeLength, 0xffff))
+                )
+            )
+            extcodecopy(target, add(creationCode, 0x40), 0, codeLength)
+            mstore(0x40, add(add(creationCode, 0x40), and(add(codeLength, 31), not(31))))
+        }
+    }
 }
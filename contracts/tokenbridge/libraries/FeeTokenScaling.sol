@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+/**
+ * @title Conversion of retryable fees to the decimals of a custom fee token
+ * @notice Retryable costs are computed with 18 decimals, chains with a custom fee token are paid
+ * in the token's own decimals. Ie. an amount of 1e18 is scaled to 1e6 if the fee token has 6 decimals like USDC.
+ */
+library FeeTokenScaling {
+    /// @notice Scale an 18 decimals `amount` to `decimals`, rounding up so the fees are always covered
+    function scaleAmount(uint256 amount, uint8 decimals) internal pure returns (uint256) {
+        if (decimals == 18) {
+            return amount;
+        }
+        if (decimals < 18) {
+            uint256 scaledAmount = amount / (10**(18 - decimals));
+            // round up if necessary
+            if (scaledAmount * (10**(18 - decimals)) < amount) {
+                scaledAmount++;
+            }
+            return scaledAmount;
+        }
+        return amount * (10**(decimals - 18));
+    }
+}
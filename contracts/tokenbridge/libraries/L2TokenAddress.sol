@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: Apache-2.0
+
+// solhint-disable-next-line compiler-version
+pragma solidity >=0.6.0 <0.9.0;
+
+/**
+ * @title Derivation of the L2 address of standard bridged tokens
+ * @notice A token is deployed by the beacon proxy factory with CREATE2, salted with the L2 gateway address and
+ * the L1 token address. L1 gateways, L2 gateways and the factory must agree on it, so they all use this library.
+ * @dev Hashes are computed in the scratch space and in memory past the free memory pointer, which is left
+ * untouched, so no memory is allocated.
+ */
+library L2TokenAddress {
+    /// @notice Salt given by the L2 gateway to the factory, keccak256(abi.encode(l1Token))
+    function getUserSalt(address l1Token) internal pure returns (bytes32 userSalt) {
+        assembly {
+            mstore(0x00, and(l1Token, shr(96, not(0))))
+            userSalt := keccak256(0x00, 0x20)
+        }
+    }
+
+    /// @notice Salt used by the factory for the CREATE2 deployment, keccak256(abi.encode(gateway, userSalt))
+    function getSalt(address gateway, bytes32 userSalt) internal pure returns (bytes32 salt) {
+        assembly {
+            mstore(0x00, and(gateway, shr(96, not(0))))
+            mstore(0x20, userSalt)
+            salt := keccak256(0x00, 0x40)
+        }
+    }
+
+    /// @notice Address deployed with CREATE2 by `deployer`, same as OpenZeppelin's Create2.computeAddress
+    function computeAddress(
+        address deployer,
+        bytes32 salt,
+        bytes32 codeHash
+    ) internal pure returns (address addr) {
+        assembly {
+            let ptr := mload(0x40)
+            // 0xff ++ deployer is built as a single word, hashed from offset 11
+            mstore(ptr, or(shl(160, 0xff), and(deployer, shr(96, not(0)))))
+            mstore(add(ptr, 0x20), salt)
+            mstore(add(ptr, 0x40), codeHash)
+            addr := and(keccak256(add(ptr, 0x0b), 0x55), shr(96, not(0)))
+        }
+    }
+
+    /// @notice L2 address of the token bridged for `l1Token` through the standard `gateway`
+    function calculateL2TokenAddress(
+        address factory,
+        bytes32 cloneableProxyHash,
+        address gateway,
+        address l1Token
+    ) internal pure returns (address) {
+        return computeAddress(factory, getSalt(gateway, getUserSalt(l1Token)), cloneableProxyHash);
+    }
+}
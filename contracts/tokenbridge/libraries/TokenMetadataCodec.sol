@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+/**
+ * @notice Encoding of the name/symbol/decimals of an L1 token, sent by the L1 gateway to deploy its L2 token
+ * @dev The L1 gateway sends either the raw results of the token's getters, abi encoded as (bytes, bytes, bytes),
+ * or their canonical compact form:
+ *      COMPACT_VERSION | uint8 flags | uint8 decimals | uint8 name length | name | symbol
+ * where the flags mark the getters which aren't available. Raw results are parsed the same way as BytesParser:
+ * a 32 bytes result without a trailing null byte is not a string, a 32 bytes result with one is a bytes32 string
+ * whose trailing null bytes are dropped, and any other result is abi decoded. Results BytesParser would revert on
+ * are treated as not available.
+ */
+library TokenMetadataCodec {
+    bytes1 internal constant COMPACT_VERSION = 0x01;
+
+    uint256 internal constant NAME_NOT_AVAILABLE = 1 << 0;
+    uint256 internal constant SYMBOL_NOT_AVAILABLE = 1 << 1;
+    uint256 internal constant DECIMALS_NOT_AVAILABLE = 1 << 2;
+
+    /**
+     * @notice Normalize raw results of the getters to the compact form
+     * @dev falls back to the raw encoding for names which don't fit the compact form
+     */
+    function encode(
+        bytes memory name,
+        bytes memory symbol,
+        bytes memory decimals
+    ) internal pure returns (bytes memory) {
+        (bool nameSuccess, string memory parsedName) = decodeString(name);
+        if (bytes(parsedName).length > type(uint8).max) {
+            return abi.encode(name, symbol, decimals);
+        }
+        (bool symbolSuccess, string memory parsedSymbol) = decodeString(symbol);
+        (bool decimalsSuccess, uint8 parsedDecimals) = decodeUint8(decimals);
+
+        uint256 flags = (nameSuccess ? 0 : NAME_NOT_AVAILABLE) |
+            (symbolSuccess ? 0 : SYMBOL_NOT_AVAILABLE) |
+            (decimalsSuccess ? 0 : DECIMALS_NOT_AVAILABLE);
+        return
+            abi.encodePacked(
+                COMPACT_VERSION,
+                uint8(flags),
+                parsedDecimals,
+                uint8(bytes(parsedName).length),
+                parsedName,
+                parsedSymbol
+            );
+    }
+
+    /**
+     * @notice Decode metadata of either encoding, values which aren't available are returned empty
+     */
+    function decode(bytes memory data)
+        internal
+        pure
+        returns (
+            bool nameSuccess,
+            string memory name,
+            bool symbolSuccess,
+            string memory symbol,
+            bool decimalsSuccess,
+            uint8 decimals
+        )
+    {
+        if (data.length == 0 || data[0] != COMPACT_VERSION) {
+            // abi decode may revert, but the encoding is done by L1 gateway, so we trust it
+            (bytes memory name_, bytes memory symbol_, bytes memory decimals_) = abi.decode(
+                data,
+                (bytes, bytes, bytes)
+            );
+            (nameSuccess, name) = decodeString(name_);
+            (symbolSuccess, symbol) = decodeString(symbol_);
+            (decimalsSuccess, decimals) = decodeUint8(decimals_);
+            return (nameSuccess, name, symbolSuccess, symbol, decimalsSuccess, decimals);
+        }
+
+        // the fixed header is read with a single word, the encoding is done by L1 gateway, so we trust it
+        uint256 header;
+        assembly {
+            header := mload(add(data, 0x20))
+        }
+        uint256 flags = (header >> 240) & 0xff;
+        decimals = uint8(header >> 232);
+        uint256 nameLength = (header >> 224) & 0xff;
+        require(data.length >= 4 + nameLength, "INVALID_METADATA");
+
+        nameSuccess = flags & NAME_NOT_AVAILABLE == 0;
+        symbolSuccess = flags & SYMBOL_NOT_AVAILABLE == 0;
+        decimalsSuccess = flags & DECIMALS_NOT_AVAILABLE == 0;
+        name = _copyToString(data, 4, nameLength);
+        symbol = _copyToString(data, 4 + nameLength, data.length - 4 - nameLength);
+    }
+
+    /**
+     * @notice Parse the raw result of a string getter, same as BytesParser.toString without reverting
+     * @dev abi encoded strings are not copied, the returned string points into `input`
+     */
+    function decodeString(bytes memory input)
+        internal
+        pure
+        returns (bool success, string memory res)
+    {
+        uint256 inputLength = input.length;
+        if (inputLength == 0) {
+            return (false, res);
+        }
+
+        if (inputLength == 32) {
+            uint256 word;
+            assembly {
+                word := mload(add(input, 0x20))
+            }
+            // null terminated bytes32 string
+            if (word & 0xff != 0) {
+                return (false, res);
+            }
+            uint256 len = _trimmedLength(word);
+            assembly {
+                res := mload(0x40)
+                mstore(0x40, add(res, 0x40))
+                mstore(res, len)
+                mstore(add(res, 0x20), word)
+            }
+            return (true, res);
+        }
+
+        // same checks as abi.decode(input, (string))
+        if (inputLength < 32) {
+            return (false, res);
+        }
+        uint256 offset;
+        assembly {
+            offset := mload(add(input, 0x20))
+        }
+        if (offset > type(uint64).max || offset + 32 > inputLength) {
+            return (false, res);
+        }
+        uint256 len;
+        assembly {
+            len := mload(add(add(input, 0x20), offset))
+        }
+        if (len > type(uint64).max || offset + 32 + len > inputLength) {
+            return (false, res);
+        }
+        assembly {
+            res := add(add(input, 0x20), offset)
+        }
+        return (true, res);
+    }
+
+    /**
+     * @notice Parse the raw result of the decimals getter, same as BytesParser.toUint8
+     */
+    function decodeUint8(bytes memory input) internal pure returns (bool success, uint8 res) {
+        if (input.length != 32) {
+            return (false, 0);
+        }
+        uint256 word;
+        assembly {
+            word := mload(add(input, 0x20))
+        }
+        if (word > type(uint8).max) {
+            return (false, 0);
+        }
+        return (true, uint8(word));
+    }
+
+    /// @dev length of a left-aligned string once its trailing null bytes are dropped
+    function _trimmedLength(uint256 word) private pure returns (uint256 len) {
+        if (word == 0) {
+            return 0;
+        }
+        // binary search of the last non null byte
+        len = 32;
+        if (word & type(uint128).max == 0) {
+            len -= 16;
+            word >>= 128;
+        }
+        if (word & type(uint64).max == 0) {
+            len -= 8;
+            word >>= 64;
+        }
+        if (word & type(uint32).max == 0) {
+            len -= 4;
+            word >>= 32;
+        }
+        if (word & type(uint16).max == 0) {
+            len -= 2;
+            word >>= 16;
+        }
+        if (word & type(uint8).max == 0) {
+            len -= 1;
+        }
+    }
+
+    function _copyToString(
+        bytes memory data,
+        uint256 start,
+        uint256 len
+    ) private pure returns (string memory res) {
+        assembly {
+            res := mload(0x40)
+            mstore(res, len)
+            let src := add(add(data, 0x20), start)
+            let dest := add(res, 0x20)
+            for {
+                let i := 0
+            } lt(i, len) {
+                i := add(i, 0x20)
+            } {
+                mstore(add(dest, i), mload(add(src, i)))
+            }
+            // clear what was copied past the end of the string in the last word
+            mstore(add(dest, len), 0)
+            mstore(0x40, and(add(add(dest, len), 0x1f), not(0x1f)))
+        }
+    }
+}
@@ -18,6 +18,8 @@
 
 pragma solidity ^0.8.0;
 
+import "@openzeppelin/contracts/utils/cryptography/MerkleProof.sol";
+
 abstract contract WhitelistConsumer {
     address public whitelist;
 
@@ -37,9 +39,11 @@ abstract contract WhitelistConsumer {
     }
 }
 
-contract Whitelist {
+/**
+ * @notice Owner of a whitelist, which can switch its consumers over to another whitelist source
+ */
+abstract contract WhitelistSource {
     address public owner;
-    mapping(address => bool) public isAllowed;
 
     event OwnerUpdated(address newOwner);
     event WhitelistUpgraded(address newWhitelist, address[] targets);
@@ -53,11 +57,25 @@ contract Whitelist {
         _;
     }
 
+    function isAllowed(address user) external view virtual returns (bool);
+
     function setOwner(address newOwner) external onlyOwner {
         owner = newOwner;
         emit OwnerUpdated(newOwner);
     }
 
+    // set new whitelist to address(0) to disable whitelist
+    function triggerConsumers(address newWhitelist, address[] memory targets) external onlyOwner {
+        for (uint256 i = 0; i < targets.length; i++) {
+            WhitelistConsumer(targets[i]).updateWhitelistSource(newWhitelist);
+        }
+        emit WhitelistUpgraded(newWhitelist, targets);
+    }
+}
+
+contract Whitelist is WhitelistSource {
+    mapping(address => bool) public override isAllowed;
+
     function setWhitelist(address[] memory user, bool[] memory val) external onlyOwner {
         require(user.length == val.length, "INVALID_INPUT");
 
@@ -65,12 +83,114 @@ contract Whitelist {
             isAllowed[user[i]] = val[i];
         }
     }
+}
 
-    // set new whitelist to address(0) to disable whitelist
-    function triggerConsumers(address newWhitelist, address[] memory targets) external onlyOwner {
-        for (uint256 i = 0; i < targets.length; i++) {
-            WhitelistConsumer(targets[i]).updateWhitelistSource(newWhitelist);
+/**
+ * @notice Whitelist of users published as Merkle roots, so the owner doesn't write every user to storage.
+ * Users are added in cohorts, each with its own root. Leaves are keccak256(keccak256(abi.encode(user))),
+ * as built by OpenZeppelin's StandardMerkleTree for the `address` type.
+ * @dev A user proves membership once through proveMembership, which sets the cohort's bit in the user's bitmap,
+ * so consumers keep using isAllowed. There are at most MAX_COHORTS active cohorts, a removed cohort's slot can be
+ * added again with a new root, eg. to correct it. Each slot has an epoch which is incremented when it's removed,
+ * proofs are recorded with the epoch of their slot, so memberships proven under an old root never apply to a new one.
+ * Single users of an active cohort are revoked with setDenied rather than by removing their whole cohort.
+ */
+contract MerkleWhitelist is WhitelistSource {
+    uint256 public constant MAX_COHORTS = 256;
+
+    mapping(uint256 => bytes32) public cohortRoots;
+    /// @notice bitmap of cohorts whose members are allowed
+    uint256 public activeCohorts;
+    /// @notice bitmap of cohorts each user has proven membership in, only valid for the epoch of the proof
+    mapping(address => uint256) public provenCohorts;
+    /// @notice number of times each cohort was removed
+    mapping(uint256 => uint256) public cohortEpochs;
+    /// @notice epoch of the cohort when each user proved their membership
+    mapping(address => mapping(uint256 => uint256)) public provenEpochs;
+    /// @notice users which aren't allowed regardless of their cohorts
+    mapping(address => bool) public isDenied;
+
+    event CohortAdded(uint256 indexed cohort, bytes32 root);
+    event CohortRemoved(uint256 indexed cohort);
+    event MembershipProven(address indexed user, uint256 indexed cohort);
+    event DeniedUpdated(address indexed user, bool denied);
+
+    function addCohort(uint256 cohort, bytes32 root) external onlyOwner {
+        require(cohort < MAX_COHORTS, "INVALID_COHORT");
+        require(activeCohorts & (1 << cohort) == 0, "COHORT_EXISTS");
+        require(root != bytes32(0), "INVALID_ROOT");
+
+        cohortRoots[cohort] = root;
+        activeCohorts |= 1 << cohort;
+        emit CohortAdded(cohort, root);
+    }
+
+    /**
+     * @notice Remove a cohort, its members have to prove their membership again if it's added back
+     */
+    function removeCohort(uint256 cohort) external onlyOwner {
+        require(activeCohorts & (1 << cohort) != 0, "COHORT_NOT_ACTIVE");
+
+        activeCohorts &= ~(1 << cohort);
+        delete cohortRoots[cohort];
+        cohortEpochs[cohort]++;
+        emit CohortRemoved(cohort);
+    }
+
+    function setDenied(address[] memory user, bool[] memory denied) external onlyOwner {
+        require(user.length == denied.length, "INVALID_INPUT");
+
+        for (uint256 i = 0; i < user.length; i++) {
+            isDenied[user[i]] = denied[i];
+            emit DeniedUpdated(user[i], denied[i]);
         }
-        emit WhitelistUpgraded(newWhitelist, targets);
+    }
+
+    /**
+     * @notice Allowed users which have proven their membership of an active cohort in its current epoch
+     */
+    function isAllowed(address user) external view override returns (bool) {
+        if (isDenied[user]) {
+            return false;
+        }
+        // proofs of a previous epoch are ignored, users are usually in a single cohort so this ends early
+        uint256 cohorts = provenCohorts[user] & activeCohorts;
+        for (uint256 cohort = 0; cohorts != 0; cohort++) {
+            if (cohorts & 1 != 0 && provenEpochs[user][cohort] == cohortEpochs[cohort]) {
+                return true;
+            }
+            cohorts >>= 1;
+        }
+        return false;
+    }
+
+    /**
+     * @notice Check the membership of `user` without caching it, for consumers which can pass the proof along
+     */
+    function isAllowedWithProof(
+        address user,
+        uint256 cohort,
+        bytes32[] calldata proof
+    ) public view returns (bool) {
+        if (cohort >= MAX_COHORTS || activeCohorts & (1 << cohort) == 0 || isDenied[user]) {
+            return false;
+        }
+        bytes32 leaf = keccak256(bytes.concat(keccak256(abi.encode(user))));
+        return MerkleProof.verifyCalldata(proof, cohortRoots[cohort], leaf);
+    }
+
+    /**
+     * @notice Cache the membership of `user` in `cohort`, callable by anyone since proofs are public
+     */
+    function proveMembership(
+        address user,
+        uint256 cohort,
+        bytes32[] calldata proof
+    ) external {
+        require(isAllowedWithProof(user, cohort, proof), "INVALID_PROOF");
+
+        provenCohorts[user] |= 1 << cohort;
+        provenEpochs[user][cohort] = cohortEpochs[cohort];
+        emit MembershipProven(user, cohort);
     }
 }
@@ -41,4 +41,19 @@ contract aeERC20 is ERC20PermitUpgradeable, TransferAndCallToken {
         __ERC20_init(name_, symbol_);
         _setupDecimals(decimals_);
     }
+
+    /**
+     * @dev initializes the permit domain, for tokens that store their metadata outside of ERC20Upgradeable.
+     * `longName_` and `longSymbol_` are only stored in ERC20Upgradeable if one of them isn't empty
+     */
+    function _initializePermit(
+        string memory name_,
+        string memory longName_,
+        string memory longSymbol_
+    ) internal initializer {
+        __ERC20Permit_init(name_);
+        if (bytes(longName_).length != 0 || bytes(longSymbol_).length != 0) {
+            __ERC20_init(longName_, longSymbol_);
+        }
+    }
 }
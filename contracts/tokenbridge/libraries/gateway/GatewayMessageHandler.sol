@@ -18,8 +18,43 @@
 
 pragma solidity ^0.8.0;
 
-/// @notice this library manages encoding and decoding of gateway communication
+import "../BytesLib.sol";
+
+/**
+ * @notice this library manages encoding and decoding of gateway communication
+ * @dev Messages are abi encoded by default. Each hop also accepts an opt-in packed encoding which starts with
+ * the PACKED_MSG_VERSION tag and drops the offsets, lengths and padding of the abi encoding:
+ *      user data               version | uint256 fields | callHookData
+ *      withdrawal user data    version | callHookData
+ *      router to gateway       version | from | user data
+ *      L1 to L2 gateway        version | uint32 gatewayData length | gatewayData | callHookData
+ * Abi encoded messages always start with a zero byte since their first word is an offset, an address or
+ * a small amount, so legacy messages keep being parsed as before.
+ * L1 gateways only send packed messages to their L2 counterpart once their packedL2MsgEnabled flag is set.
+ * Gateways that advertise APPENDED_SENDER_INTERFACE_ID through ERC-165 when they are set in the router get
+ * packed user data unchanged from it, with the sender appended to the calldata of the gateway call instead,
+ * in the ERC-2771 style. The gateway tells both apart by the length of its calldata, which for abi encoded
+ * calls ends with the tail of `_data`, and only for calls of the router. Other gateways keep getting the
+ * sender in the router to gateway encoding.
+ * The callHookData of a deposit is only used if it is a post deposit hook, which the L2 gateway calls on the
+ * receiver after crediting it with the tokens:
+ *      deposit hook            DEPOSIT_HOOK_VERSION | uint256 gasLimit | hookData
+ */
 library GatewayMessageHandler {
+    bytes1 internal constant PACKED_MSG_VERSION = 0x01;
+    bytes1 internal constant DEPOSIT_HOOK_VERSION = 0x02;
+    // ERC-165 id of gateways that read the sender appended by the router to the calldata
+    bytes4 internal constant APPENDED_SENDER_INTERFACE_ID =
+        bytes4(keccak256("GatewayMessageHandler.appendedSender"));
+
+    function isPackedMsg(bytes calldata _data) internal pure returns (bool) {
+        return _data.length != 0 && _data[0] == PACKED_MSG_VERSION;
+    }
+
+    function isPackedUserData(bytes memory _data) internal pure returns (bool) {
+        return _data.length != 0 && _data[0] == PACKED_MSG_VERSION;
+    }
+
     // these are for communication from L1 to L2 gateway
 
     function encodeToL2GatewayMsg(bytes memory gatewayData, bytes memory callHookData)
@@ -30,15 +65,62 @@ library GatewayMessageHandler {
         res = abi.encode(gatewayData, callHookData);
     }
 
+    function encodeToL2GatewayMsgPacked(bytes memory gatewayData, bytes memory callHookData)
+        internal
+        pure
+        returns (bytes memory res)
+    {
+        res = abi.encodePacked(
+            PACKED_MSG_VERSION,
+            uint32(gatewayData.length),
+            gatewayData,
+            callHookData
+        );
+    }
+
     function parseFromL1GatewayMsg(bytes calldata _data)
         internal
         pure
         returns (bytes memory gatewayData, bytes memory callHookData)
     {
+        if (isPackedMsg(_data)) {
+            // the message may come from an older L1 gateway, so check its lengths before slicing it
+            require(_data.length >= 5, "INVALID_PACKED_MSG");
+            uint256 gatewayDataEnd = 5 + uint32(bytes4(_data[1:5]));
+            require(_data.length >= gatewayDataEnd, "INVALID_PACKED_MSG");
+            gatewayData = _data[5:gatewayDataEnd];
+            callHookData = _data[gatewayDataEnd:];
+            return (gatewayData, callHookData);
+        }
         // abi decode may revert, but the encoding is done by L1 gateway, so we trust it
         (gatewayData, callHookData) = abi.decode(_data, (bytes, bytes));
     }
 
+    // these are for the post deposit hook, sent as callHookData from L1 to L2 gateway
+
+    function encodeDepositHook(uint256 gasLimit, bytes memory hookData)
+        internal
+        pure
+        returns (bytes memory res)
+    {
+        res = abi.encodePacked(DEPOSIT_HOOK_VERSION, gasLimit, hookData);
+    }
+
+    function isDepositHook(bytes memory callHookData) internal pure returns (bool) {
+        return callHookData.length >= 33 && callHookData[0] == DEPOSIT_HOOK_VERSION;
+    }
+
+    function parseDepositHook(bytes memory callHookData)
+        internal
+        pure
+        returns (uint256 gasLimit, bytes memory hookData)
+    {
+        // callers are expected to check isDepositHook first
+        require(callHookData.length >= 33, "INVALID_DEPOSIT_HOOK");
+        gasLimit = BytesLib.toUint(callHookData, 1);
+        hookData = BytesLib.slice(callHookData, 33, callHookData.length - 33);
+    }
+
     // these are for communication from L2 to L1 gateway
 
     function encodeFromL2GatewayMsg(uint256 exitNum, bytes memory callHookData)
@@ -65,15 +147,62 @@ library GatewayMessageHandler {
         pure
         returns (bytes memory res)
     {
+        if (isPackedMsg(_data)) {
+            // the user opted into the packed encoding, which the gateway is then expected to support
+            return abi.encodePacked(PACKED_MSG_VERSION, _from, _data);
+        }
         // abi decode may revert, but the encoding is done by L1 gateway, so we trust it
         return abi.encode(_from, _data);
     }
 
+    /**
+     * @dev `_call` is the abi encoded call to the gateway, which has to take the router data as `bytes` last argument
+     */
+    function appendSenderToGatewayCall(bytes memory _call, address _from)
+        internal
+        pure
+        returns (bytes memory res)
+    {
+        res = abi.encodePacked(_call, _from);
+    }
+
+    /**
+     * @dev any caller can append 20 bytes, so only to be trusted if the call comes from the router, see
+     *      parseFromRouter. `_data` has to be the last argument of the call
+     */
+    function hasAppendedSender(bytes calldata _data) internal pure returns (bool) {
+        // the tail of the last argument is padded to 32 bytes
+        return msg.data.length == _data.offset + ((_data.length + 31) & ~uint256(31)) + 20;
+    }
+
+    /**
+     * @notice parse router data of a call made with either convention, see hasAppendedSender
+     * @param _fromRouter whether msg.sender is the router, the appended sender is ignored otherwise
+     */
+    function parseFromRouter(bytes calldata _data, bool _fromRouter)
+        internal
+        pure
+        returns (address, bytes memory)
+    {
+        if (_fromRouter && hasAppendedSender(_data)) {
+            return (appendedSender(), _data);
+        }
+        return parseFromRouterToGateway(_data);
+    }
+
+    function appendedSender() internal pure returns (address) {
+        return address(bytes20(msg.data[msg.data.length - 20:]));
+    }
+
     function parseFromRouterToGateway(bytes calldata _data)
         internal
         pure
         returns (address, bytes memory res)
     {
+        if (isPackedMsg(_data)) {
+            require(_data.length >= 21, "INVALID_PACKED_MSG");
+            return (address(bytes20(_data[1:21])), _data[21:]);
+        }
         // abi decode may revert, but the encoding is done by L1 gateway, so we trust it
         return abi.decode(_data, (address, bytes));
     }
@@ -20,9 +20,12 @@ pragma solidity ^0.8.0;
 
 import "../ProxyUtil.sol";
 import "@openzeppelin/contracts/utils/Address.sol";
+import "@openzeppelin/contracts/token/ERC20/IERC20.sol";
+import "@openzeppelin/contracts/token/ERC20/extensions/draft-IERC20Permit.sol";
 import "./TokenGateway.sol";
 import "./GatewayMessageHandler.sol";
 import "./IGatewayRouter.sol";
+import "../IERC165.sol";
 
 /**
  * @title Common interface for L1 and L2 Gateway Routers
@@ -33,10 +36,28 @@ abstract contract GatewayRouter is TokenGateway, IGatewayRouter {
     address internal constant ZERO_ADDR = address(0);
     address internal constant DISABLED = address(1);
 
+    // Stored above the address in a l1TokenToGateway entry, or in the defaultGateway slot, if the gateway
+    // already had code when it was set, so getGateway doesn't need to check it again.
+    // Solidity reads only the lower 160 bits of these slots, so the getters are unaffected,
+    // but no variable can be packed in the defaultGateway slot.
+    uint256 internal constant GATEWAY_IS_CONTRACT = 1 << 160;
+    // Stored next to GATEWAY_IS_CONTRACT if the gateway advertised APPENDED_SENDER_INTERFACE_ID when it was
+    // set, so routing a packed call doesn't query it. Gateways set before this flag, or before their
+    // deployment, get the sender in the router to gateway encoding until they are set again.
+    uint256 internal constant GATEWAY_READS_APPENDED_SENDER = 1 << 161;
+
+    /// @notice EIP-2612 permit signed by the sender, allowing the gateway to pull the tokens
+    struct PermitData {
+        uint256 deadline;
+        uint8 v;
+        bytes32 r;
+        bytes32 s;
+    }
+
     mapping(address => address) public l1TokenToGateway;
     address public override defaultGateway;
 
-    function postUpgradeInit() external {
+    function postUpgradeInit() public virtual {
         // it is assumed the L2 Arbitrum Gateway contract is behind a Proxy controlled by a proxy admin
         // this function can only be called by the proxy admin contract
         address proxyAdmin = ProxyUtil.getProxyAdmin();
@@ -53,7 +74,92 @@ abstract contract GatewayRouter is TokenGateway, IGatewayRouter {
         require(_router == address(0), "BAD_ROUTER");
         TokenGateway._initialize(_counterpartGateway, _router);
         // default gateway can have 0 address
-        defaultGateway = _defaultGateway;
+        _setDefaultGatewayEntry(_defaultGateway);
+    }
+
+    function _setGatewayEntry(address _token, address _gateway) internal {
+        uint256 entry = _toGatewayEntry(_gateway);
+        assembly {
+            mstore(0x00, _token)
+            mstore(0x20, l1TokenToGateway.slot)
+            sstore(keccak256(0x00, 0x40), entry)
+        }
+    }
+
+    function _setDefaultGatewayEntry(address _gateway) internal {
+        uint256 entry = _toGatewayEntry(_gateway);
+        assembly {
+            sstore(defaultGateway.slot, entry)
+        }
+    }
+
+    /**
+     * @notice Approve `_spender` to pull `_amount` of `_token` from the sender using its EIP-2612 signature
+     * @dev the permit is public once the transaction is in the mempool, so anyone can submit it first to make
+     *      this call fail. The transfer can still go through if that permit already set the allowance.
+     */
+    function _permit(
+        address _token,
+        address _spender,
+        uint256 _amount,
+        PermitData calldata _permitData
+    ) internal {
+        try
+            IERC20Permit(_token).permit(
+                msg.sender,
+                _spender,
+                _amount,
+                _permitData.deadline,
+                _permitData.v,
+                _permitData.r,
+                _permitData.s
+            )
+        {} catch {
+            require(IERC20(_token).allowance(msg.sender, _spender) >= _amount, "PERMIT_FAILED");
+        }
+    }
+
+    /**
+     * @notice Call `_gateway` with the sender appended to the calldata, see GatewayMessageHandler
+     * @dev reverts of the gateway are bubbled up
+     * @param _call abi encoded call, with the user data as last argument
+     * @return bytes returned by the gateway
+     */
+    function _callGatewayWithSender(
+        address _gateway,
+        uint256 _value,
+        bytes memory _call
+    ) internal returns (bytes memory) {
+        bytes memory returnData = _gateway.functionCallWithValue(
+            GatewayMessageHandler.appendSenderToGatewayCall(_call, msg.sender),
+            _value
+        );
+        return abi.decode(returnData, (bytes));
+    }
+
+    /**
+     * @notice Whether `_gateway` reads the sender appended to its calldata, see GatewayMessageHandler
+     * @dev checked through ERC-165 when the gateway is set so gateways registered before the convention, or by
+     * third parties, never get a call they would parse the sender of from user supplied bytes
+     */
+    function _supportsAppendedSender(address _gateway) private view returns (bool) {
+        (bool success, bytes memory res) = _gateway.staticcall{ gas: 30000 }(
+            abi.encodeWithSelector(
+                IERC165.supportsInterface.selector,
+                GatewayMessageHandler.APPENDED_SENDER_INTERFACE_ID
+            )
+        );
+        return success && res.length == 32 && abi.decode(res, (uint256)) == 1;
+    }
+
+    function _toGatewayEntry(address _gateway) private view returns (uint256 entry) {
+        entry = uint256(uint160(_gateway));
+        if (_gateway != DISABLED && _gateway.isContract()) {
+            entry |= GATEWAY_IS_CONTRACT;
+            if (_supportsAppendedSender(_gateway)) {
+                entry |= GATEWAY_READS_APPENDED_SENDER;
+            }
+        }
     }
 
     function finalizeInboundTransfer(
@@ -77,12 +183,30 @@ abstract contract GatewayRouter is TokenGateway, IGatewayRouter {
         // this function is kept instead of delegating to outboundTransferCustomRefund to allow
         // compatibility with older gateways that did not implement outboundTransferCustomRefund
         address gateway = getGateway(_token);
+        emit TransferRouted(_token, msg.sender, _to, gateway);
+
+        if (GatewayMessageHandler.isPackedMsg(_data) && _readsAppendedSender(_token)) {
+            // packed user data is forwarded as is, the gateway reads the sender from the calldata
+            return
+                _callGatewayWithSender(
+                    gateway,
+                    msg.value,
+                    abi.encodeWithSelector(
+                        ITokenGateway.outboundTransfer.selector,
+                        _token,
+                        _to,
+                        _amount,
+                        _maxGas,
+                        _gasPriceBid,
+                        _data
+                    )
+                );
+        }
+
         bytes memory gatewayData = GatewayMessageHandler.encodeFromRouterToGateway(
             msg.sender,
             _data
         );
-
-        emit TransferRouted(_token, msg.sender, _to, gateway);
         return
             ITokenGateway(gateway).outboundTransfer{ value: msg.value }(
                 _token,
@@ -106,19 +230,47 @@ abstract contract GatewayRouter is TokenGateway, IGatewayRouter {
     }
 
     function getGateway(address _token) public view virtual override returns (address gateway) {
-        gateway = l1TokenToGateway[_token];
+        (gateway, ) = _resolveGateway(_token);
+    }
 
-        if (gateway == ZERO_ADDR) {
+    /**
+     * @dev Whether the gateway of `_token` reads the sender appended to its calldata, from the flag stored
+     *      when it was set. Only a warm slot is read again, the gateway isn't called.
+     */
+    function _readsAppendedSender(address _token) internal view returns (bool readsAppendedSender) {
+        (, readsAppendedSender) = _resolveGateway(_token);
+    }
+
+    /**
+     * @dev gateway of `_token`, see getGateway, and whether it reads the sender appended to its calldata
+     */
+    function _resolveGateway(address _token)
+        internal
+        view
+        returns (address gateway, bool readsAppendedSender)
+    {
+        uint256 entry;
+        assembly {
+            mstore(0x00, _token)
+            mstore(0x20, l1TokenToGateway.slot)
+            entry := sload(keccak256(0x00, 0x40))
+        }
+
+        if (uint160(entry) == 0) {
             // if no gateway value set, use default gateway
-            gateway = defaultGateway;
+            assembly {
+                entry := sload(defaultGateway.slot)
+            }
         }
 
-        if (gateway == DISABLED || !gateway.isContract()) {
+        gateway = address(uint160(entry));
+        // gateways set without code (ie an L2 gateway registered before its deployment) are checked on every call
+        if (gateway == DISABLED || ((entry & GATEWAY_IS_CONTRACT) == 0 && !gateway.isContract())) {
             // not a valid gateway
-            return ZERO_ADDR;
+            return (ZERO_ADDR, false);
         }
 
-        return gateway;
+        return (gateway, (entry & GATEWAY_READS_APPENDED_SENDER) != 0);
     }
 
     function calculateL2TokenAddress(address l1ERC20)
@@ -134,4 +286,162 @@ abstract contract GatewayRouter is TokenGateway, IGatewayRouter {
         }
         return TokenGateway(gateway).calculateL2TokenAddress(l1ERC20);
     }
+
+    /**
+     * @notice Gateways of multiple tokens, see getGateway
+     * @param _tokens addresses of L1 tokens
+     * @return gateways gateways of the tokens, in the same order
+     */
+    function getGateways(address[] calldata _tokens)
+        public
+        view
+        virtual
+        override
+        returns (address[] memory gateways)
+    {
+        gateways = new address[](_tokens.length);
+        for (uint256 i = 0; i < _tokens.length; i++) {
+            gateways[i] = getGateway(_tokens[i]);
+        }
+    }
+
+    /**
+     * @notice Calculate the L2 addresses of multiple tokens, see calculateL2TokenAddress
+     * @dev Tokens are grouped by gateway in a single pass, so each gateway is called once with all of its tokens.
+     *      Gateways deployed before calculateL2TokenAddresses was added are called once per token.
+     */
+    function calculateL2TokenAddresses(address[] calldata l1ERC20s)
+        public
+        view
+        virtual
+        override
+        returns (address[] memory l2Tokens)
+    {
+        address[] memory gateways = getGateways(l1ERC20s);
+        l2Tokens = new address[](l1ERC20s.length);
+        (
+            uint256[] memory tokenGroups,
+            address[] memory groupGateways,
+            uint256[] memory groupSizes,
+            uint256 numGroups
+        ) = _groupByGateway(gateways);
+
+        address[][] memory groupTokens = new address[][](numGroups);
+        for (uint256 g = 0; g < numGroups; g++) {
+            groupTokens[g] = new address[](groupSizes[g]);
+            // refilled below as the position of the next token of the group
+            groupSizes[g] = 0;
+        }
+        for (uint256 i = 0; i < l1ERC20s.length; i++) {
+            uint256 group = tokenGroups[i];
+            if (group != 0) {
+                groupTokens[group - 1][groupSizes[group - 1]++] = l1ERC20s[i];
+            }
+        }
+
+        for (uint256 g = 0; g < numGroups; g++) {
+            groupTokens[g] = _calculateL2TokenAddresses(groupGateways[g], groupTokens[g]);
+            groupSizes[g] = 0;
+        }
+        for (uint256 i = 0; i < l1ERC20s.length; i++) {
+            uint256 group = tokenGroups[i];
+            if (group != 0) {
+                l2Tokens[i] = groupTokens[group - 1][groupSizes[group - 1]++];
+            }
+        }
+    }
+
+    /**
+     * @dev Group of each token, plus one so tokens without a gateway keep zero, and the gateway and size of
+     *      each group. Gateways are found in an open addressing table, so each token is only looked at once.
+     */
+    function _groupByGateway(address[] memory _gateways)
+        internal
+        pure
+        returns (
+            uint256[] memory tokenGroups,
+            address[] memory groupGateways,
+            uint256[] memory groupSizes,
+            uint256 numGroups
+        )
+    {
+        tokenGroups = new uint256[](_gateways.length);
+        groupGateways = new address[](_gateways.length);
+        groupSizes = new uint256[](_gateways.length);
+        // each entry packs a gateway with its group plus one, the table is never more than half full
+        uint256[] memory table = new uint256[](_gateways.length * 2);
+        for (uint256 i = 0; i < _gateways.length; i++) {
+            address gateway = _gateways[i];
+            if (gateway == ZERO_ADDR) {
+                continue;
+            }
+            uint256 slot = _hashAddress(gateway) % table.length;
+            while (table[slot] != 0 && address(uint160(table[slot])) != gateway) {
+                slot = (slot + 1) % table.length;
+            }
+            if (table[slot] == 0) {
+                groupGateways[numGroups++] = gateway;
+                table[slot] = (numGroups << 160) | uint256(uint160(gateway));
+            }
+            tokenGroups[i] = table[slot] >> 160;
+            groupSizes[tokenGroups[i] - 1]++;
+        }
+    }
+
+    function _calculateL2TokenAddresses(address _gateway, address[] memory _tokens)
+        internal
+        view
+        returns (address[] memory l2Tokens)
+    {
+        // a try/catch would still revert if the return data can't be decoded as address[]
+        (bool success, bytes memory res) = _gateway.staticcall(
+            abi.encodeWithSelector(TokenGateway.calculateL2TokenAddresses.selector, _tokens)
+        );
+        if (success && _isAddressArray(res, _tokens.length)) {
+            assembly {
+                // skip the length of the return data and the offset of the array, the rest is the array
+                l2Tokens := add(res, 0x40)
+            }
+            return l2Tokens;
+        }
+
+        l2Tokens = new address[](_tokens.length);
+        for (uint256 i = 0; i < _tokens.length; i++) {
+            l2Tokens[i] = TokenGateway(_gateway).calculateL2TokenAddress(_tokens[i]);
+        }
+    }
+
+    /// @dev whether `_data` is exactly the abi encoding of an address[] of `_length` elements
+    function _isAddressArray(bytes memory _data, uint256 _length) internal pure returns (bool) {
+        if (_data.length != 0x40 + _length * 0x20) {
+            return false;
+        }
+        uint256 offset;
+        uint256 encodedLength;
+        assembly {
+            offset := mload(add(_data, 0x20))
+            encodedLength := mload(add(_data, 0x40))
+        }
+        if (offset != 0x20 || encodedLength != _length) {
+            return false;
+        }
+        for (uint256 i = 0; i < _length; i++) {
+            uint256 word;
+            assembly {
+                word := mload(add(_data, add(0x60, mul(i, 0x20))))
+            }
+            if (word >> 160 != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    function _hashAddress(address _addr) internal pure returns (uint256 hash) {
+        assembly {
+            // scratch space, no memory is allocated
+            mstore(0x00, _addr)
+            hash := keccak256(0x00, 0x20)
+        }
+    }
 }
@@ -40,4 +40,9 @@ interface IGatewayRouter is ITokenGateway {
     event DefaultGatewayUpdated(address newDefaultGateway);
 
     function getGateway(address _token) external view returns (address gateway);
+
+    function getGateways(address[] calldata _tokens)
+        external
+        view
+        returns (address[] memory gateways);
 }
@@ -43,7 +43,8 @@ abstract contract TokenGateway is ITokenGateway {
         router = _router;
     }
 
-    function isRouter(address _target) internal view returns (bool isTargetRouter) {
+    function isRouter(address _target) internal view virtual returns (bool isTargetRouter) {
+        // virtual so implementations deployed for a single chain can compare against an immutable
         return _target == router;
     }
 
@@ -60,4 +61,21 @@ abstract contract TokenGateway is ITokenGateway {
         virtual
         override
         returns (address);
+
+    /**
+     * @notice Calculate the addresses used when bridging multiple ERC20 tokens, see calculateL2TokenAddress
+     * @param l1ERC20s addresses of L1 tokens
+     * @return l2Tokens L2 addresses of the bridged ERC20 tokens, in the same order
+     */
+    function calculateL2TokenAddresses(address[] calldata l1ERC20s)
+        public
+        view
+        virtual
+        returns (address[] memory l2Tokens)
+    {
+        l2Tokens = new address[](l1ERC20s.length);
+        for (uint256 i = 0; i < l1ERC20s.length; i++) {
+            l2Tokens[i] = calculateL2TokenAddress(l1ERC20s[i]);
+        }
+    }
 }
@@ -66,6 +66,15 @@ contract InboxMock is AbsInboxMock {
         emit InboxRetryableTicket(msg.sender, to, l2CallValue, gasLimit, data);
         return seqNum++;
     }
+
+    /// @dev same formula as the nitro Inbox
+    function calculateRetryableSubmissionFee(uint256 dataLength, uint256 baseFee)
+        public
+        view
+        returns (uint256)
+    {
+        return (1400 + 6 * dataLength) * (baseFee == 0 ? block.basefee : baseFee);
+    }
 }
 
 contract ERC20InboxMock is AbsInboxMock {
@@ -118,6 +127,11 @@ contract ERC20InboxMock is AbsInboxMock {
         return seqNum++;
     }
 
+    /// @dev submissions are free on chains with a custom fee token, as in the nitro ERC20Inbox
+    function calculateRetryableSubmissionFee(uint256, uint256) public pure returns (uint256) {
+        return 0;
+    }
+
     function setMockNativeToken(address _nativeToken) external {
         nativeToken = _nativeToken;
     }
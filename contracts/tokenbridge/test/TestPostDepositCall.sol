@@ -18,7 +18,9 @@
 
 pragma solidity ^0.8.0;
 
+import "@openzeppelin/contracts/token/ERC20/IERC20.sol";
 import "../libraries/ITransferAndCall.sol";
+import "../arbitrum/IDepositHookReceiver.sol";
 
 contract L2Called is ITransferAndCallReceiver {
     event Called(uint256 num);
@@ -49,3 +51,40 @@ contract L2Called is ITransferAndCallReceiver {
         }
     }
 }
+
+contract L2DepositHookReceiver is IDepositHookReceiver {
+    event DepositHookCalled(
+        address l1Token,
+        address l2Token,
+        address from,
+        uint256 amount,
+        uint256 balance,
+        bytes data
+    );
+
+    function onDepositFinalized(
+        address l1Token,
+        address l2Token,
+        address from,
+        uint256 amount,
+        bytes calldata data
+    ) external override {
+        uint256 num = abi.decode(data, (uint256));
+
+        if (num == 7) {
+            revert("should fail because 7");
+        } else if (num == 9) {
+            // this should use all gas
+            while (gasleft() > 0) {}
+        }
+        // deposited tokens are already credited when the hook is called
+        emit DepositHookCalled(
+            l1Token,
+            l2Token,
+            from,
+            amount,
+            IERC20(l2Token).balanceOf(address(this)),
+            data
+        );
+    }
+}
@@ -1,4 +1,4 @@
-import { BigNumber, Signer, Wallet, ethers } from 'ethers'
+import { BigNumber, ContractFactory, Signer, Wallet, ethers } from 'ethers'
 import {
   L1CustomGateway__factory,
   L1ERC20Gateway__factory,
@@ -45,6 +45,7 @@ import { OmitTyped } from '@arbitrum/sdk/dist/lib/utils/types'
 import { L1ToL2MessageGasParams } from '@arbitrum/sdk/dist/lib/message/L1ToL2MessageCreator'
 import { L1ContractCallTransactionReceipt } from '@arbitrum/sdk/dist/lib/message/L1Transaction'
 import { _getScaledAmount } from './local-deployment/localDeploymentLib'
+import { DeploymentEngine } from './deploymentEngine'
 
 /**
  * Dummy non-zero address which is provided to logic contracts initializers
@@ -56,11 +57,15 @@ const ADDRESS_DEAD = '0x000000000000000000000000000000000000dEaD'
  * Function first gets estimates for 2 retryable tickets - one for deploying L2 factory and
  * one for deploying L2 side of token bridge. Then it creates retryables, waits for
  * until they're executed, and finally it picks up addresses of new contracts.
+ * Estimates are run concurrently, and deployment addresses are read from L1 while retryables are tracked on L2.
  *
  * @param l1Signer
  * @param l2Provider
  * @param l1TokenBridgeCreator
  * @param rollupAddress
+ * @param rollupOwnerAddress
+ * @param resumable record the creation TX in `_deployments/<chainId>_current_deployment.json`, so a run
+ *                  which was interrupted resumes tracking the retryables instead of creating them again
  * @returns
  */
 export const createTokenBridge = async (
@@ -68,26 +73,11 @@ export const createTokenBridge = async (
   l2Provider: ethers.providers.Provider,
   l1TokenBridgeCreator: L1AtomicTokenBridgeCreator,
   rollupAddress: string,
-  rollupOwnerAddress: string
+  rollupOwnerAddress: string,
+  resumable = false
 ) => {
-  const gasPrice = await l2Provider.getGasPrice()
-
-  //// run retryable estimate for deploying L2 factory
-  const deployFactoryGasParams = await getEstimateForDeployingFactory(
-    l1Signer,
-    l2Provider
-  )
-
-  const maxGasForFactory =
-    await l1TokenBridgeCreator.gasLimitForL2FactoryDeployment()
-  const maxSubmissionCostForFactory = deployFactoryGasParams.maxSubmissionCost
-
   //// run retryable estimate for deploying L2 contracts
   //// we do this estimate using L2 factory template on L1 because on L2 factory does not yet exist
-  const l2FactoryTemplate = L2AtomicTokenBridgeFactory__factory.connect(
-    await l1TokenBridgeCreator.l2TokenBridgeFactoryTemplate(),
-    l1Signer
-  )
   const l2Code = {
     router: L2GatewayRouter__factory.bytecode,
     standardGateway: L2ERC20Gateway__factory.bytecode,
@@ -97,8 +87,12 @@ export const createTokenBridge = async (
     upgradeExecutor: UpgradeExecutorBytecode,
     multicall: ArbMulticall2__factory.bytecode,
   }
-  const gasEstimateToDeployContracts =
-    await l2FactoryTemplate.estimateGas.deployL2Contracts(
+  const estimateDeployingContracts = async () => {
+    const l2FactoryTemplate = L2AtomicTokenBridgeFactory__factory.connect(
+      await l1TokenBridgeCreator.l2TokenBridgeFactoryTemplate(),
+      l1Signer
+    )
+    return l2FactoryTemplate.estimateGas.deployL2Contracts(
       l2Code,
       ethers.Wallet.createRandom().address,
       ethers.Wallet.createRandom().address,
@@ -109,6 +103,28 @@ export const createTokenBridge = async (
       ethers.Wallet.createRandom().address,
       ethers.Wallet.createRandom().address
     )
+  }
+
+  // estimates and getting inbox from rollup contract don't depend on each other
+  const [
+    gasPrice,
+    deployFactoryGasParams,
+    maxGasForFactory,
+    gasEstimateToDeployContracts,
+    inbox,
+  ] = await Promise.all([
+    l2Provider.getGasPrice(),
+    //// run retryable estimate for deploying L2 factory
+    getEstimateForDeployingFactory(l1Signer, l2Provider),
+    l1TokenBridgeCreator.gasLimitForL2FactoryDeployment(),
+    estimateDeployingContracts(),
+    RollupAdminLogic__factory.connect(
+      rollupAddress,
+      l1Signer.provider!
+    ).inbox(),
+  ])
+
+  const maxSubmissionCostForFactory = deployFactoryGasParams.maxSubmissionCost
   const maxGasForContracts = gasEstimateToDeployContracts.mul(2)
   const maxSubmissionCostForContracts =
     deployFactoryGasParams.maxSubmissionCost.mul(2)
@@ -120,38 +136,37 @@ export const createTokenBridge = async (
     maxGasForContracts.mul(gasPrice)
   )
 
-  // get inbox from rollup contract
-  const inbox = await RollupAdminLogic__factory.connect(
-    rollupAddress,
-    l1Signer.provider!
-  ).inbox()
+  const engine = await DeploymentEngine.create(
+    l1Signer,
+    `tokenBridge:${inbox}`,
+    resumable
+  )
 
   // if fee token is used approve the fee
   const feeToken = await _getFeeToken(inbox, l1Signer.provider!)
   if (feeToken != ethers.constants.AddressZero) {
     // scale the retryable fees to the fee token decimals denomination
-    let scaledRetryableFeeForFactory = await _getScaledAmount(
-      feeToken,
-      retryableFeeForFactory,
-      l1Signer.provider!
-    )
-    let scaledRetryableFeeForContracts = await _getScaledAmount(
-      feeToken,
-      retryableFeeForContracts,
-      l1Signer.provider!
-    )
-
-    await (
-      await IERC20__factory.connect(feeToken, l1Signer).approve(
+    const [scaledRetryableFeeForFactory, scaledRetryableFeeForContracts] =
+      await Promise.all([
+        _getScaledAmount(feeToken, retryableFeeForFactory, l1Signer.provider!),
+        _getScaledAmount(
+          feeToken,
+          retryableFeeForContracts,
+          l1Signer.provider!
+        ),
+      ])
+
+    await engine.execute('approveFeeToken', () =>
+      IERC20__factory.connect(feeToken, l1Signer).populateTransaction.approve(
         l1TokenBridgeCreator.address,
         scaledRetryableFeeForFactory.add(scaledRetryableFeeForContracts)
       )
-    ).wait()
+    )
   }
 
   /// do it - create token bridge
-  const receipt = await (
-    await l1TokenBridgeCreator.createTokenBridge(
+  const receipt = await engine.execute('createTokenBridge', () =>
+    l1TokenBridgeCreator.populateTransaction.createTokenBridge(
       inbox,
       rollupOwnerAddress,
       maxGasForContracts,
@@ -163,16 +178,30 @@ export const createTokenBridge = async (
             : BigNumber.from(0),
       }
     )
-  ).wait()
+  )
 
   console.log('Deployment TX:', receipt.transactionHash)
 
-  /// wait for execution of both tickets
+  /// wait for execution of both tickets, and fetch deployment addresses from registry meanwhile
   const l1TxReceipt = new L1TransactionReceipt(receipt)
   const messages = await l1TxReceipt.getL1ToL2Messages(l2Provider)
-  const messageResults = await Promise.all(
-    messages.map(message => message.waitForStatus())
-  )
+  const [
+    messageResults,
+    l1Deployment,
+    l2Deployment,
+    l1MultiCall,
+    l1ProxyAdmin,
+  ] = await Promise.all([
+    Promise.all(messages.map(message => message.waitForStatus())),
+    l1TokenBridgeCreator.inboxToL1Deployment(inbox),
+    l1TokenBridgeCreator.inboxToL2Deployment(inbox),
+    /// fetch l1 multicall and l1 proxy admin from creator
+    l1TokenBridgeCreator.l1Multicall(),
+    IInboxProxyAdmin__factory.connect(
+      inbox,
+      l1Signer.provider!
+    ).getProxyAdmin(),
+  ])
 
   // if both tickets are not redeemed log it and exit
   if (
@@ -200,187 +229,292 @@ export const createTokenBridge = async (
     )
   console.log('L2AtomicTokenBridgeFactory', l2AtomicTokenBridgeFactory.address)
 
-  /// fetch deployment addresses from registry
-  const l1Deployment = await l1TokenBridgeCreator.inboxToL1Deployment(inbox)
-  const l2Deployment = await l1TokenBridgeCreator.inboxToL2Deployment(inbox)
-
-  /// fetch l1 multicall and l1 proxy admin from creator
-  const l1MultiCall = await l1TokenBridgeCreator.l1Multicall()
-  const l1ProxyAdmin = await IInboxProxyAdmin__factory.connect(
-    inbox,
-    l1Signer.provider!
-  ).getProxyAdmin()
-
   return { l1Deployment, l2Deployment, l1MultiCall, l1ProxyAdmin }
 }
 
 /**
- * Deploy token bridge creator contract to base chain and set all the templates
+ * Deploy token bridge creator contract to base chain and set all the templates.
+ * Contracts which don't depend on each other are deployed concurrently, and every TX is sent as soon as
+ * the contracts it depends on are deployed.
  * @param l1Deployer
- * @param l2Provider
  * @param l1WethAddress
+ * @param gasLimitForL2FactoryDeployment can be a pending estimate, it's only needed when setting templates
+ * @param verifyContracts
+ * @param resumable record deployment steps in `_deployments/<chainId>_current_deployment.json`, and resume
+ *                  a partially completed deployment recorded there
  * @returns
  */
 export const deployL1TokenBridgeCreator = async (
   l1Deployer: Signer,
   l1WethAddress: string,
-  gasLimitForL2FactoryDeployment: BigNumber,
-  verifyContracts = false
+  gasLimitForL2FactoryDeployment: BigNumber | Promise<BigNumber>,
+  verifyContracts = false,
+  resumable = false
 ) => {
-  /// deploy creator behind proxy
-  const l2MulticallAddressOnL1Fac = await new ArbMulticall2__factory(
-    l1Deployer
-  ).deploy()
-  const l2MulticallAddressOnL1 = await l2MulticallAddressOnL1Fac.deployed()
-
-  const l1TokenBridgeCreatorProxyAdmin = await new ProxyAdmin__factory(
-    l1Deployer
-  ).deploy()
-  await l1TokenBridgeCreatorProxyAdmin.deployed()
+  const engine = await DeploymentEngine.create(
+    l1Deployer,
+    'tokenBridgeCreator',
+    resumable
+  )
 
-  const l1TokenBridgeCreatorLogic =
-    await new L1AtomicTokenBridgeCreator__factory(l1Deployer).deploy()
-  await l1TokenBridgeCreatorLogic.deployed()
+  /// deploy and init templates. Logic contracts are initialized with dummy data
+  const deployAndInit = async <F extends ContractFactory>(
+    name: string,
+    factory: F,
+    init?: (
+      template: ReturnType<F['attach']>
+    ) => Promise<ethers.PopulatedTransaction>
+  ) => {
+    const template = await engine.deploy(name, factory)
+    if (init) {
+      await engine.execute(`${name}.initialize`, () => init(template))
+    }
+    return template
+  }
 
-  const l1TokenBridgeCreatorProxy =
-    await new TransparentUpgradeableProxy__factory(l1Deployer).deploy(
-      l1TokenBridgeCreatorLogic.address,
-      l1TokenBridgeCreatorProxyAdmin.address,
-      '0x'
+  const routerTemplateDeployment = deployAndInit(
+    'routerTemplate',
+    new L1GatewayRouter__factory(l1Deployer),
+    template =>
+      template.populateTransaction.initialize(
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD
+      )
+  )
+  const standardGatewayTemplateDeployment = deployAndInit(
+    'standardGatewayTemplate',
+    new L1ERC20Gateway__factory(l1Deployer),
+    template =>
+      template.populateTransaction.initialize(
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ethers.utils.hexZeroPad('0x01', 32),
+        ADDRESS_DEAD
+      )
+  )
+  const customGatewayTemplateDeployment = deployAndInit(
+    'customGatewayTemplate',
+    new L1CustomGateway__factory(l1Deployer),
+    template =>
+      template.populateTransaction.initialize(
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD
+      )
+  )
+  const wethGatewayTemplateDeployment = deployAndInit(
+    'wethGatewayTemplate',
+    new L1WethGateway__factory(l1Deployer),
+    template =>
+      template.populateTransaction.initialize(
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD
+      )
+  )
+  const feeTokenBasedRouterTemplateDeployment = deployAndInit(
+    'feeTokenBasedRouterTemplate',
+    new L1OrbitGatewayRouter__factory(l1Deployer),
+    template =>
+      template.populateTransaction.initialize(
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD
+      )
+  )
+  const feeTokenBasedStandardGatewayTemplateDeployment = deployAndInit(
+    'feeTokenBasedStandardGatewayTemplate',
+    new L1OrbitERC20Gateway__factory(l1Deployer),
+    template =>
+      template.populateTransaction.initialize(
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ethers.utils.hexZeroPad('0x01', 32),
+        ADDRESS_DEAD
+      )
+  )
+  const feeTokenBasedCustomGatewayTemplateDeployment = deployAndInit(
+    'feeTokenBasedCustomGatewayTemplate',
+    new L1OrbitCustomGateway__factory(l1Deployer),
+    template =>
+      template.populateTransaction.initialize(
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD
+      )
+  )
+  const upgradeExecutorDeployment = deployAndInit(
+    'upgradeExecutor',
+    new ethers.ContractFactory(
+      UpgradeExecutorABI,
+      UpgradeExecutorBytecode,
+      l1Deployer
     )
-  await l1TokenBridgeCreatorProxy.deployed()
+  )
 
-  const l1TokenBridgeCreator = L1AtomicTokenBridgeCreator__factory.connect(
-    l1TokenBridgeCreatorProxy.address,
-    l1Deployer
+  /// deploy L2 contracts as placeholders on L1. Initialize them with dummy data
+  const l2TokenBridgeFactoryOnL1Deployment = deployAndInit(
+    'l2TokenBridgeFactoryOnL1',
+    new L2AtomicTokenBridgeFactory__factory(l1Deployer)
+  )
+  const l2GatewayRouterOnL1Deployment = deployAndInit(
+    'l2GatewayRouterOnL1',
+    new L2GatewayRouter__factory(l1Deployer),
+    template =>
+      template.populateTransaction.initialize(ADDRESS_DEAD, ADDRESS_DEAD)
+  )
+  const l2StandardGatewayAddressOnL1Deployment = deployAndInit(
+    'l2StandardGatewayAddressOnL1',
+    new L2ERC20Gateway__factory(l1Deployer),
+    template =>
+      template.populateTransaction.initialize(
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD
+      )
+  )
+  const l2CustomGatewayAddressOnL1Deployment = deployAndInit(
+    'l2CustomGatewayAddressOnL1',
+    new L2CustomGateway__factory(l1Deployer),
+    template =>
+      template.populateTransaction.initialize(ADDRESS_DEAD, ADDRESS_DEAD)
+  )
+  const l2WethGatewayAddressOnL1Deployment = deployAndInit(
+    'l2WethGatewayAddressOnL1',
+    new L2WethGateway__factory(l1Deployer),
+    template =>
+      template.populateTransaction.initialize(
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD,
+        ADDRESS_DEAD
+      )
+  )
+  const l2WethAddressOnL1Deployment = deployAndInit(
+    'l2WethAddressOnL1',
+    new AeWETH__factory(l1Deployer)
+  )
+  const l2MulticallAddressOnL1Deployment = deployAndInit(
+    'l2MulticallAddressOnL1',
+    new ArbMulticall2__factory(l1Deployer)
+  )
+  const l1MulticallDeployment = deployAndInit(
+    'l1Multicall',
+    new Multicall2__factory(l1Deployer)
   )
 
-  /// deploy retryable sender behind proxy
-  const retryableSenderLogic = await new L1TokenBridgeRetryableSender__factory(
-    l1Deployer
-  ).deploy()
-  await retryableSenderLogic.deployed()
+  /// deploy creator and retryable sender behind proxies
+  const l1TokenBridgeCreatorProxyAdminDeployment = engine.deploy(
+    'l1TokenBridgeCreatorProxyAdmin',
+    new ProxyAdmin__factory(l1Deployer)
+  )
+  const l1TokenBridgeCreatorLogicDeployment = engine.deploy(
+    'l1TokenBridgeCreatorLogic',
+    new L1AtomicTokenBridgeCreator__factory(l1Deployer)
+  )
+  const retryableSenderLogicDeployment = engine.deploy(
+    'retryableSenderLogic',
+    new L1TokenBridgeRetryableSender__factory(l1Deployer)
+  )
 
-  const retryableSenderProxy = await new TransparentUpgradeableProxy__factory(
+  const [
+    l1TokenBridgeCreatorProxyAdmin,
+    l1TokenBridgeCreatorLogic,
+    retryableSenderLogic,
+  ] = await Promise.all([
+    l1TokenBridgeCreatorProxyAdminDeployment,
+    l1TokenBridgeCreatorLogicDeployment,
+    retryableSenderLogicDeployment,
+  ])
+
+  const [l1TokenBridgeCreatorProxy, retryableSenderProxy] = await Promise.all([
+    engine.deploy(
+      'l1TokenBridgeCreatorProxy',
+      new TransparentUpgradeableProxy__factory(l1Deployer),
+      [
+        l1TokenBridgeCreatorLogic.address,
+        l1TokenBridgeCreatorProxyAdmin.address,
+        '0x',
+      ]
+    ),
+    engine.deploy(
+      'retryableSenderProxy',
+      new TransparentUpgradeableProxy__factory(l1Deployer),
+      [
+        retryableSenderLogic.address,
+        l1TokenBridgeCreatorProxyAdmin.address,
+        '0x',
+      ]
+    ),
+    // initialize retryable sender logic contract
+    engine.execute('retryableSenderLogic.initialize', () =>
+      retryableSenderLogic.populateTransaction.initialize()
+    ),
+  ])
+
+  const l1TokenBridgeCreator = L1AtomicTokenBridgeCreator__factory.connect(
+    l1TokenBridgeCreatorProxy.address,
     l1Deployer
-  ).deploy(
-    retryableSenderLogic.address,
-    l1TokenBridgeCreatorProxyAdmin.address,
-    '0x'
   )
-  await retryableSenderProxy.deployed()
-
   const retryableSender = L1TokenBridgeRetryableSender__factory.connect(
     retryableSenderProxy.address,
     l1Deployer
   )
 
-  // initialize retryable sender logic contract
-  await (await retryableSenderLogic.initialize()).wait()
-
   /// init creator
-  await (await l1TokenBridgeCreator.initialize(retryableSender.address)).wait()
-
-  /// deploy L1 logic contracts. Initialize them with dummy data
-  const routerTemplate = await new L1GatewayRouter__factory(l1Deployer).deploy()
-  await routerTemplate.deployed()
-  await (
-    await routerTemplate.initialize(
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD
-    )
-  ).wait()
-
-  const standardGatewayTemplate = await new L1ERC20Gateway__factory(
-    l1Deployer
-  ).deploy()
-  await standardGatewayTemplate.deployed()
-  await (
-    await standardGatewayTemplate.initialize(
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ethers.utils.hexZeroPad('0x01', 32),
-      ADDRESS_DEAD
-    )
-  ).wait()
-
-  const customGatewayTemplate = await new L1CustomGateway__factory(
-    l1Deployer
-  ).deploy()
-  await customGatewayTemplate.deployed()
-  await (
-    await customGatewayTemplate.initialize(
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD
-    )
-  ).wait()
-
-  const wethGatewayTemplate = await new L1WethGateway__factory(
-    l1Deployer
-  ).deploy()
-  await wethGatewayTemplate.deployed()
-  await (
-    await wethGatewayTemplate.initialize(
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD
-    )
-  ).wait()
-
-  const feeTokenBasedRouterTemplate = await new L1OrbitGatewayRouter__factory(
-    l1Deployer
-  ).deploy()
-  await feeTokenBasedRouterTemplate.deployed()
-  await (
-    await feeTokenBasedRouterTemplate.initialize(
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD
-    )
-  ).wait()
-
-  const feeTokenBasedStandardGatewayTemplate =
-    await new L1OrbitERC20Gateway__factory(l1Deployer).deploy()
-  await feeTokenBasedStandardGatewayTemplate.deployed()
-  await (
-    await feeTokenBasedStandardGatewayTemplate.initialize(
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ethers.utils.hexZeroPad('0x01', 32),
-      ADDRESS_DEAD
-    )
-  ).wait()
-
-  const feeTokenBasedCustomGatewayTemplate =
-    await new L1OrbitCustomGateway__factory(l1Deployer).deploy()
-  await feeTokenBasedCustomGatewayTemplate.deployed()
-  await (
-    await feeTokenBasedCustomGatewayTemplate.initialize(
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD
-    )
-  ).wait()
-
-  const upgradeExecutorFactory = new ethers.ContractFactory(
-    UpgradeExecutorABI,
-    UpgradeExecutorBytecode,
-    l1Deployer
+  await engine.execute('l1TokenBridgeCreator.initialize', () =>
+    l1TokenBridgeCreator.populateTransaction.initialize(retryableSender.address)
   )
-  const upgradeExecutor = await upgradeExecutorFactory.deploy()
-  await upgradeExecutor.deployed()
+
+  const [
+    routerTemplate,
+    standardGatewayTemplate,
+    customGatewayTemplate,
+    wethGatewayTemplate,
+    feeTokenBasedRouterTemplate,
+    feeTokenBasedStandardGatewayTemplate,
+    feeTokenBasedCustomGatewayTemplate,
+    upgradeExecutor,
+  ] = await Promise.all([
+    routerTemplateDeployment,
+    standardGatewayTemplateDeployment,
+    customGatewayTemplateDeployment,
+    wethGatewayTemplateDeployment,
+    feeTokenBasedRouterTemplateDeployment,
+    feeTokenBasedStandardGatewayTemplateDeployment,
+    feeTokenBasedCustomGatewayTemplateDeployment,
+    upgradeExecutorDeployment,
+  ])
+  const [
+    l2TokenBridgeFactoryOnL1,
+    l2GatewayRouterOnL1,
+    l2StandardGatewayAddressOnL1,
+    l2CustomGatewayAddressOnL1,
+    l2WethGatewayAddressOnL1,
+    l2WethAddressOnL1,
+    l2MulticallAddressOnL1,
+    l1Multicall,
+  ] = await Promise.all([
+    l2TokenBridgeFactoryOnL1Deployment,
+    l2GatewayRouterOnL1Deployment,
+    l2StandardGatewayAddressOnL1Deployment,
+    l2CustomGatewayAddressOnL1Deployment,
+    l2WethGatewayAddressOnL1Deployment,
+    l2WethAddressOnL1Deployment,
+    l2MulticallAddressOnL1Deployment,
+    l1MulticallDeployment,
+  ])
 
   const l1Templates = {
     routerTemplate: routerTemplate.address,
@@ -395,60 +529,8 @@ export const deployL1TokenBridgeCreator = async (
     upgradeExecutor: upgradeExecutor.address,
   }
 
-  /// deploy L2 contracts as placeholders on L1. Initialize them with dummy data
-  const l2TokenBridgeFactoryOnL1 =
-    await new L2AtomicTokenBridgeFactory__factory(l1Deployer).deploy()
-  await l2TokenBridgeFactoryOnL1.deployed()
-
-  const l2GatewayRouterOnL1 = await new L2GatewayRouter__factory(
-    l1Deployer
-  ).deploy()
-  await l2GatewayRouterOnL1.deployed()
-  await (
-    await l2GatewayRouterOnL1.initialize(ADDRESS_DEAD, ADDRESS_DEAD)
-  ).wait()
-
-  const l2StandardGatewayAddressOnL1 = await new L2ERC20Gateway__factory(
-    l1Deployer
-  ).deploy()
-  await l2StandardGatewayAddressOnL1.deployed()
-  await (
-    await l2StandardGatewayAddressOnL1.initialize(
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD
-    )
-  ).wait()
-
-  const l2CustomGatewayAddressOnL1 = await new L2CustomGateway__factory(
-    l1Deployer
-  ).deploy()
-  await l2CustomGatewayAddressOnL1.deployed()
-  await (
-    await l2CustomGatewayAddressOnL1.initialize(ADDRESS_DEAD, ADDRESS_DEAD)
-  ).wait()
-
-  const l2WethGatewayAddressOnL1 = await new L2WethGateway__factory(
-    l1Deployer
-  ).deploy()
-  await l2WethGatewayAddressOnL1.deployed()
-  await (
-    await l2WethGatewayAddressOnL1.initialize(
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD,
-      ADDRESS_DEAD
-    )
-  ).wait()
-
-  const l2WethAddressOnL1 = await new AeWETH__factory(l1Deployer).deploy()
-  await l2WethAddressOnL1.deployed()
-
-  const l1Multicall = await new Multicall2__factory(l1Deployer).deploy()
-  await l1Multicall.deployed()
-
-  await (
-    await l1TokenBridgeCreator.setTemplates(
+  await engine.execute('l1TokenBridgeCreator.setTemplates', async () =>
+    l1TokenBridgeCreator.populateTransaction.setTemplates(
       l1Templates,
       l2TokenBridgeFactoryOnL1.address,
       l2GatewayRouterOnL1.address,
@@ -459,9 +541,9 @@ export const deployL1TokenBridgeCreator = async (
       l2MulticallAddressOnL1.address,
       l1WethAddress,
       l1Multicall.address,
-      gasLimitForL2FactoryDeployment
+      await gasLimitForL2FactoryDeployment
     )
-  ).wait()
+  )
 
   ///// verify contracts
   if (verifyContracts) {
@@ -69,7 +69,8 @@ export const createTokenBridgeOnTargetChain = async () => {
       l2Provider,
       l1TokenBridgeCreator,
       envVars.rollupAddress,
-      envVars.rollupOwner
+      envVars.rollupOwner,
+      true
     )
 
   const l2Network = {
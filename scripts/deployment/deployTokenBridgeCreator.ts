@@ -27,6 +27,7 @@ export const envVars = {
  * - deploy L1 bridge creator and set templates
  * - do single TX deployment of token bridge
  * - populate network objects with new addresses and return it
+ * If previous run was interrupted, deployment is resumed from `_deployments/<chainId>_current_deployment.json`
  *
  * @param l1Deployer
  * @param l2Deployer
@@ -56,29 +57,33 @@ export const deployTokenBridgeCreator = async () => {
   const l1Provider = new JsonRpcProvider(envVars.baseChainRpc)
   const l1Deployer = getSigner(l1Provider, envVars.baseChainDeployerKey)
 
-  // get gas limit for L2 factory deployment from env var or do retryable estimate
-  let gasLimitForL2FactoryDeployment: BigNumber
+  // get gas limit for L2 factory deployment from env var or do retryable estimate.
+  // Estimate runs while L1 contracts are deployed, it's only needed when setting templates
+  let gasLimitForL2FactoryDeployment: Promise<BigNumber>
   if (envVars.gasLimitForL2FactoryDeployment) {
-    gasLimitForL2FactoryDeployment = BigNumber.from(
-      envVars.gasLimitForL2FactoryDeployment
+    gasLimitForL2FactoryDeployment = Promise.resolve(
+      BigNumber.from(envVars.gasLimitForL2FactoryDeployment)
     )
   } else {
     const l2Provider = new JsonRpcProvider(envVars.childChainRpc)
-    await registerNetworks(l1Provider, l2Provider, envVars.rollupAddress)
-    //// run retryable estimate for deploying L2 factory
-    const deployFactoryGasParams = await getEstimateForDeployingFactory(
-      l1Deployer,
-      l2Provider
-    )
-    gasLimitForL2FactoryDeployment = deployFactoryGasParams.gasLimit
+    gasLimitForL2FactoryDeployment = (async () => {
+      await registerNetworks(l1Provider, l2Provider, envVars.rollupAddress)
+      //// run retryable estimate for deploying L2 factory
+      const deployFactoryGasParams = await getEstimateForDeployingFactory(
+        l1Deployer,
+        l2Provider
+      )
+      return deployFactoryGasParams.gasLimit
+    })()
   }
 
-  // deploy L1 creator and set templates
+  // deploy L1 creator and set templates. Deployment is recorded in _deployments, so it can be resumed
   const { l1TokenBridgeCreator, retryableSender } =
     await deployL1TokenBridgeCreator(
       l1Deployer,
       envVars.baseChainWeth,
       gasLimitForL2FactoryDeployment,
+      true,
       true
     )
 
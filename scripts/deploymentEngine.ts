@@ -0,0 +1,192 @@
+import { ContractFactory, Signer } from 'ethers'
+import {
+  TransactionReceipt,
+  TransactionRequest,
+} from '@ethersproject/providers'
+import { existsSync, readFileSync, writeFileSync } from 'fs'
+import path from 'path'
+
+/**
+ * Key under which deployment steps are recorded in `_deployments/<chainId>_current_deployment.json`,
+ * next to the data used by the upgrade tasks
+ */
+const STATE_KEY = 'atomicTokenBridgeDeployments'
+
+export interface DeploymentStep {
+  txHash: string
+  done: boolean
+}
+
+interface DeploymentState {
+  deployer: string
+  steps: { [name: string]: DeploymentStep }
+}
+
+/**
+ * Sends the TXs of a deployment done by a single signer.
+ * Nonces are managed locally, so TXs which don't depend on each other can be sent without waiting for receipts
+ * of previous ones. TXs are signed and broadcasted one at a time, in order of nonces, while receipts are waited
+ * for concurrently.
+ * Every step is identified by its name. If the engine is resumable, steps are recorded in the chain's current
+ * deployment file as soon as their TX is sent, so an interrupted run picks up pending TXs and skips completed steps.
+ */
+export class DeploymentEngine {
+  private nonce = 0
+  private sendQueue: Promise<unknown> = Promise.resolve()
+
+  private constructor(
+    public readonly signer: Signer,
+    private readonly name: string,
+    private readonly state: DeploymentState,
+    private readonly statePath?: string
+  ) {}
+
+  /**
+   * @param signer deployer
+   * @param name name of the deployment, steps of different deployments are recorded separately
+   * @param resumable record steps in `_deployments/<chainId>_current_deployment.json` and resume from there
+   */
+  public static async create(
+    signer: Signer,
+    name: string,
+    resumable = false
+  ): Promise<DeploymentEngine> {
+    const deployer = await signer.getAddress()
+    let state: DeploymentState = { deployer, steps: {} }
+    let statePath: string | undefined
+
+    if (resumable) {
+      const chainId = await signer.getChainId()
+      statePath = path.join(
+        __dirname,
+        '..',
+        '_deployments',
+        `${chainId}_current_deployment.json`
+      )
+      const recorded = DeploymentEngine.readStateFile(statePath)[STATE_KEY]?.[
+        name
+      ] as DeploymentState | undefined
+      if (recorded) {
+        if (recorded.deployer !== deployer) {
+          throw new Error(
+            `Deployment '${name}' was started by ${recorded.deployer}, can't be resumed by ${deployer}`
+          )
+        }
+        console.log(`Resuming deployment '${name}' from ${statePath}`)
+        state = recorded
+      }
+    }
+
+    const engine = new DeploymentEngine(signer, name, state, statePath)
+    // TXs left pending by an interrupted run are tracked by their hashes
+    engine.nonce = await signer.getTransactionCount('pending')
+    return engine
+  }
+
+  /**
+   * Deploy contract using the factory, or pick up the one deployed by a previous run
+   */
+  public async deploy<F extends ContractFactory>(
+    step: string,
+    factory: F,
+    args: unknown[] = []
+  ): Promise<ReturnType<F['attach']>> {
+    const receipt = await this.execute(step, async () =>
+      factory.getDeployTransaction(...args)
+    )
+    return factory.attach(receipt.contractAddress) as ReturnType<F['attach']>
+  }
+
+  /**
+   * Send TX returned by `populate`, unless it was already done by a previous run, and wait for its receipt.
+   * `populate` is only called if the TX has to be sent.
+   */
+  public async execute(
+    step: string,
+    populate: () => Promise<TransactionRequest>
+  ): Promise<TransactionReceipt> {
+    const recorded = this.state.steps[step]
+    if (recorded) {
+      const receipt = await this.waitForRecorded(step, recorded)
+      if (receipt) {
+        return receipt
+      }
+    }
+
+    // gas is estimated concurrently, only the broadcast is serialized. Nonce is overridden when sending
+    const tx = await this.signer.populateTransaction(await populate())
+    const response = await this.enqueue(async () => {
+      try {
+        return await this.signer.sendTransaction({ ...tx, nonce: this.nonce++ })
+      } catch (err) {
+        // don't leave a gap in nonces of the TXs which follow
+        this.nonce = await this.signer.getTransactionCount('pending')
+        throw err
+      }
+    })
+    this.record(step, { txHash: response.hash, done: false })
+
+    const receipt = await response.wait()
+    this.record(step, { txHash: response.hash, done: true })
+    return receipt
+  }
+
+  /**
+   * Receipt of the step's TX if it was done by a previous run, after waiting for it if it's still pending
+   */
+  private async waitForRecorded(
+    step: string,
+    recorded: DeploymentStep
+  ): Promise<TransactionReceipt | undefined> {
+    const provider = this.signer.provider!
+    const tx = await provider.getTransaction(recorded.txHash)
+    if (!tx) {
+      // dropped before it was included, or chain was reset
+      console.log(`TX of step '${step}' not found, sending it again`)
+      return undefined
+    }
+
+    const receipt = await provider.waitForTransaction(recorded.txHash)
+    if (receipt.status !== 1) {
+      console.log(`TX of step '${step}' reverted, sending it again`)
+      return undefined
+    }
+    if (receipt.contractAddress) {
+      if ((await provider.getCode(receipt.contractAddress)) === '0x') {
+        return undefined
+      }
+    }
+
+    if (!recorded.done) {
+      this.record(step, { ...recorded, done: true })
+    }
+    return receipt
+  }
+
+  private enqueue<T>(send: () => Promise<T>): Promise<T> {
+    const sent = this.sendQueue.then(send)
+    this.sendQueue = sent.catch(() => undefined)
+    return sent
+  }
+
+  private record(step: string, data: DeploymentStep) {
+    this.state.steps[step] = data
+    if (!this.statePath) {
+      return
+    }
+
+    const deployments = DeploymentEngine.readStateFile(this.statePath)
+    deployments[STATE_KEY] = {
+      ...deployments[STATE_KEY],
+      [this.name]: this.state,
+    }
+    writeFileSync(this.statePath, JSON.stringify(deployments, null, 2))
+  }
+
+  private static readStateFile(statePath: string): any {
+    if (!existsSync(statePath)) {
+      return {}
+    }
+    return JSON.parse(readFileSync(statePath).toString())
+  }
+}
@@ -0,0 +1,14 @@
+#!/bin/bash
+# fails when the gas of a benchmark in test-foundry/benchmark moves by more than GAS_TOLERANCE percent
+# from the committed snapshot, run `yarn gas:snapshot` to update the snapshot after an intended change
+snapshot="./.gas-snapshot"
+tolerance="${GAS_TOLERANCE:-2}"
+if [ ! -f "$snapshot" ]
+then
+    # nothing to compare against yet, record the benchmarks so the snapshot can be committed
+    echo "::warning::Missing $snapshot, creating it, commit it to check gas benchmarks"
+    forge snapshot --match-path "test-foundry/benchmark/*" --snap "$snapshot"
+    exit $?
+fi
+echo "Checking gas benchmarks against $snapshot with a $tolerance% tolerance"
+forge snapshot --match-path "test-foundry/benchmark/*" --snap "$snapshot" --check --tolerance "$tolerance"
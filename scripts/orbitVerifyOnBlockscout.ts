@@ -2,8 +2,8 @@ import { ethers } from 'hardhat'
 import { run } from 'hardhat'
 import {
   AeWETH__factory,
-  BeaconProxyFactory__factory,
   L1AtomicTokenBridgeCreator__factory,
+  MinimalBeaconProxyFactory__factory,
   UpgradeableBeacon__factory,
 } from '../build/types'
 import { Provider } from '@ethersproject/providers'
@@ -47,7 +47,7 @@ async function main() {
   const l2Deployment = await tokenBridgeCreator.inboxToL2Deployment(
     inboxAddress
   )
-  const beaconProxyFactory = BeaconProxyFactory__factory.connect(
+  const beaconProxyFactory = MinimalBeaconProxyFactory__factory.connect(
     l2Deployment.beaconProxyFactory,
     orbitProvider
   )
@@ -93,7 +93,11 @@ async function main() {
     await _getLogicAddress(l2Deployment.wethGateway, orbitProvider),
     []
   )
-  await _verifyContract('BeaconProxyFactory', beaconProxyFactory.address, [])
+  await _verifyContract(
+    'MinimalBeaconProxyFactory',
+    beaconProxyFactory.address,
+    []
+  )
   await _verifyContract('UpgradeableBeacon', upgradeableBeacon.address, [
     standardArbERC20,
   ])
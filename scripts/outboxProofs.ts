@@ -0,0 +1,131 @@
+import {
+  BigNumber,
+  BigNumberish,
+  BytesLike,
+  ContractReceipt,
+  Signer,
+  providers,
+} from 'ethers'
+import { OutboxBatchExecutor__factory } from '../build/types'
+import { ArbSys__factory } from '@arbitrum/sdk/dist/lib/abi/factories/ArbSys__factory'
+import { NodeInterface__factory } from '@arbitrum/sdk/dist/lib/abi/factories/NodeInterface__factory'
+import {
+  ARB_SYS_ADDRESS,
+  NODE_INTERFACE_ADDRESS,
+} from '@arbitrum/sdk/dist/lib/dataEntities/constants'
+
+/**
+ * Parameters of Outbox.executeTransaction, see OutboxBatchExecutor.OutboxMessage
+ */
+export interface OutboxMessage {
+  proof: BytesLike[]
+  index: BigNumber
+  l2Sender: string
+  to: string
+  l2Block: BigNumber
+  l1Block: BigNumber
+  l2Timestamp: BigNumber
+  value: BigNumber
+  data: BytesLike
+}
+
+/**
+ * Number of L2 to L1 messages in the send root of an L2 block. Messages can only be proven
+ * against the send root of a block which was confirmed on L1.
+ */
+export const getOutboxSize = async (
+  l2Provider: providers.JsonRpcProvider,
+  l2BlockHash: string
+): Promise<BigNumber> => {
+  // sendCount is an Arbitrum field of the block, ethers drops it
+  const block = await l2Provider.send('eth_getBlockByHash', [
+    l2BlockHash,
+    false,
+  ])
+  return BigNumber.from(block.sendCount)
+}
+
+/**
+ * Fetch the L2 to L1 messages sent by L2 transactions, such as gateway withdrawals, and their
+ * proofs against the send root of `outboxSize` messages, see getOutboxSize.
+ * Messages are read from the ArbSys L2ToL1Tx events, in the order of the transactions, and
+ * proven with NodeInterface.constructOutboxProof. The receipts and the proofs are each sent to
+ * the L2 node as a single JSON-RPC batch request. The messages are returned as expected by
+ * OutboxBatchExecutor.executeTransactions.
+ */
+export const lookupOutboxMessages = async (
+  l2RpcUrl: string,
+  l2TxHashes: string[],
+  outboxSize: BigNumberish
+): Promise<OutboxMessage[]> => {
+  // concurrent calls of a batch provider are sent in one request
+  const batchProvider = new providers.JsonRpcBatchProvider(l2RpcUrl)
+  const arbSys = ArbSys__factory.connect(ARB_SYS_ADDRESS, batchProvider)
+  const nodeInterface = NodeInterface__factory.connect(
+    NODE_INTERFACE_ADDRESS,
+    batchProvider
+  )
+
+  const receipts = await Promise.all(
+    l2TxHashes.map(txHash => batchProvider.getTransactionReceipt(txHash))
+  )
+  const events = receipts.flatMap(receipt =>
+    receipt.logs
+      .filter(
+        log => log.address.toLowerCase() === ARB_SYS_ADDRESS.toLowerCase()
+      )
+      .map(log => arbSys.interface.parseLog(log))
+      .filter(event => event.name === 'L2ToL1Tx')
+  )
+  for (const event of events) {
+    if (event.args.position.gte(outboxSize)) {
+      throw new Error(
+        `Message ${event.args.position} isn't in the send root of ${outboxSize} messages`
+      )
+    }
+  }
+
+  const proofs = await Promise.all(
+    events.map(event =>
+      nodeInterface.constructOutboxProof(outboxSize, event.args.position)
+    )
+  )
+  return events.map((event, i) => ({
+    proof: proofs[i].proof,
+    index: event.args.position,
+    l2Sender: event.args.caller,
+    to: event.args.destination,
+    l2Block: event.args.arbBlockNum,
+    l1Block: event.args.ethBlockNum,
+    l2Timestamp: event.args.timestamp,
+    value: event.args.callvalue,
+    data: event.args.data,
+  }))
+}
+
+/**
+ * Execute L2 to L1 messages of `outbox` in one transaction, each with its gas limit, returns the
+ * outbox index of the messages which failed. Failed messages aren't spent and can be relayed again.
+ */
+export const relayOutboxMessages = async (
+  l1Signer: Signer,
+  executorAddress: string,
+  outboxAddress: string,
+  messages: OutboxMessage[],
+  gasLimits: BigNumberish[]
+): Promise<{ receipt: ContractReceipt; failed: BigNumber[] }> => {
+  const executor = OutboxBatchExecutor__factory.connect(
+    executorAddress,
+    l1Signer
+  )
+  const receipt = await (
+    await executor.executeTransactions(outboxAddress, messages, gasLimits)
+  ).wait()
+
+  const failed = receipt.logs
+    .filter(log => log.address.toLowerCase() === executorAddress.toLowerCase())
+    .map(log => executor.interface.parseLog(log))
+    .filter(event => event.name === 'TransactionFailed')
+    .map(event => event.args.index as BigNumber)
+  return { receipt, failed }
+}
@@ -0,0 +1,924 @@
+import {
+  L1Network,
+  L1ToL2MessageGasEstimator,
+  L1ToL2MessageStatus,
+  L1TransactionReceipt,
+  L2Network,
+  L2TransactionReceipt,
+  addCustomNetwork,
+} from '@arbitrum/sdk'
+import {
+  l1Networks,
+  l2Networks,
+} from '@arbitrum/sdk/dist/lib/dataEntities/networks'
+import { RollupCore__factory } from '@arbitrum/sdk/dist/lib/abi/factories/RollupCore__factory'
+import { getBaseFee } from '@arbitrum/sdk/dist/lib/utils/lib'
+import {
+  JsonRpcProvider,
+  TransactionReceipt,
+  TransactionResponse,
+} from '@ethersproject/providers'
+import { expect } from 'chai'
+import { execSync } from 'child_process'
+import { writeFileSync } from 'fs'
+import { BigNumber, Signer, Wallet, ethers } from 'ethers'
+import { defaultAbiCoder, solidityPack } from 'ethers/lib/utils'
+import {
+  _getScaledAmount,
+  setupTokenBridgeInLocalEnv,
+} from '../../scripts/local-deployment/localDeploymentLib'
+import {
+  ERC20,
+  ERC20__factory,
+  IFiatToken__factory,
+  IInbox__factory,
+  IOwnable__factory,
+  L1AtomicTokenBridgeCreator__factory,
+  L1ERC20Gateway__factory,
+  L1GatewayRouter__factory,
+  L1USDCGateway__factory,
+  L2CustomGateway__factory,
+  L2GatewayRouter__factory,
+  L2USDCGateway__factory,
+  ProxyAdmin__factory,
+  TestArbCustomToken__factory,
+  TestCustomTokenL1__factory,
+  TestERC20__factory,
+  TestOrbitCustomTokenL1__factory,
+  TestWETH9__factory,
+  TransparentUpgradeableProxy__factory,
+  UpgradeExecutor__factory,
+} from '../../build/types'
+import { _deployUsdcProxy, _deployUsdcToken, getFeeToken } from '../e2eUtils'
+
+/**
+ * Cost of every bridge operation, as paid by the user on both chains, written as JSON to `COST_REPORT_PATH`.
+ * By default it deploys the token bridge with `localDeploymentLib` to the chains at `PARENT_RPC` and
+ * `CHILD_RPC`. An existing token bridge is used instead when the child chain is known to the SDK, ie. on forks
+ * of Arbitrum One, Nova or Sepolia, or when `ROLLUP_ADDRESS` and `L1_TOKEN_BRIDGE_CREATOR` point to a bridge
+ * deployed by the creator. The user is `COST_REPORT_USER_KEY`, or `COST_REPORT_IMPERSONATE` on forks, funded on
+ * both chains, otherwise a local account funded by the test node. Operations and amounts are always the same,
+ * so gas numbers can be compared between commits.
+ */
+const config = {
+  parentUrl: process.env['PARENT_RPC'] || 'http://127.0.0.1:8547',
+  childUrl: process.env['CHILD_RPC'] || 'http://127.0.0.1:3347',
+  reportPath: process.env['COST_REPORT_PATH'] || 'bridge-cost-report.json',
+  // deposits use the packed user data, which also opts into the router to gateway call with appended sender
+  packedUserData: process.env['COST_REPORT_PACKED_DATA'] === 'true',
+  // withdrawals can only be executed on the parent chain once their assertion is confirmed
+  executeWithdrawals: process.env['COST_REPORT_EXECUTE_WITHDRAWALS'] === 'true',
+  userKey: process.env['COST_REPORT_USER_KEY'],
+  // account unlocked with hardhat_impersonateAccount, supported by hardhat and anvil forks
+  impersonate: process.env['COST_REPORT_IMPERSONATE'],
+  rollupAddress: process.env['ROLLUP_ADDRESS'],
+  tokenBridgeCreator: process.env['L1_TOKEN_BRIDGE_CREATOR'],
+  // registers the USDC gateway in the router of an existing deployment
+  rollupOwnerKey: process.env['ROLLUP_OWNER_KEY'],
+}
+
+const LOCALHOST_L3_OWNER_KEY =
+  '0xecdf21cb41c65afb51f91df408b7656e2c8739a5877f2814add0afd780cc210e'
+
+/**
+ * Cost of a single TX, at the gas price it actually paid
+ */
+interface TxCost {
+  txHash: string
+  gasUsed: string
+  effectiveGasPrice: string
+  fee: string
+  /** intrinsic gas of the calldata, only for TXs signed by the user */
+  calldataBytes?: number
+  calldataGas?: number
+  /** part of gasUsed paying for the posting of the TX to the parent chain, only reported by Arbitrum chains */
+  gasUsedForL1?: string
+}
+
+interface RetryableCost {
+  dataLength: number
+  l2CallValue: string
+  maxSubmissionFee: string
+  /** submission fee charged for the base fee of the block the retryable was created in */
+  submissionFee: string
+  gasLimit: string
+  maxFeePerGas: string
+  autoRedeem: TxCost
+}
+
+interface OperationCost {
+  operation: string
+  skipped?: string
+  parentChainTx?: TxCost
+  retryables?: RetryableCost[]
+  childChainTx?: TxCost
+}
+
+interface CostReport {
+  commit: string
+  parentChainId: number
+  childChainId: number
+  feeToken: string
+  packedUserData: boolean
+  operations: OperationCost[]
+}
+
+let parentProvider: JsonRpcProvider
+let childProvider: JsonRpcProvider
+
+// deploys the test tokens and USDC, same address on both chains
+let deployerL1Signer: Signer
+let deployerL2Signer: Signer
+let deployerAddress: string
+
+// same address on both chains
+let userL1Signer: Signer
+let userL2Signer: Signer
+let userAddress: string
+
+let _l2Network: L2Network
+// token bridge wasn't deployed by this test
+let existingDeployment: boolean
+let nativeToken: ERC20 | undefined
+
+let report: CostReport
+
+describe('bridgeCostReport', () => {
+  before(async function () {
+    parentProvider = new ethers.providers.JsonRpcProvider(config.parentUrl)
+    childProvider = new ethers.providers.JsonRpcProvider(config.childUrl)
+
+    const existingNetwork = await getExistingNetwork()
+    existingDeployment = existingNetwork !== undefined
+    if (config.impersonate || config.userKey) {
+      // user pays for everything, including the test contracts
+      if (config.impersonate) {
+        userL1Signer = await impersonate(parentProvider, config.impersonate)
+        userL2Signer = await impersonate(childProvider, config.impersonate)
+      } else {
+        userL1Signer = new Wallet(config.userKey!, parentProvider)
+        userL2Signer = new Wallet(config.userKey!, childProvider)
+      }
+      deployerL1Signer = userL1Signer
+      deployerL2Signer = userL2Signer
+      _l2Network =
+        existingNetwork || (await setupTokenBridgeInLocalEnv()).l2Network
+    } else {
+      const testDevKey =
+        '0xb6b15c8cb491557369f3c7d2c287b053eb229daa9c22138887752191c9520659'
+      const deployerKey = ethers.utils.sha256(
+        ethers.utils.toUtf8Bytes('user_token_bridge_deployer')
+      )
+      deployerL1Signer = new Wallet(deployerKey, parentProvider)
+      deployerL2Signer = new Wallet(deployerKey, childProvider)
+      await fund(
+        new Wallet(testDevKey, parentProvider),
+        new Wallet(testDevKey, childProvider),
+        await deployerL1Signer.getAddress(),
+        ethers.utils.parseEther('20.0')
+      )
+
+      _l2Network =
+        existingNetwork || (await setupTokenBridgeInLocalEnv()).l2Network
+
+      const userKey = ethers.utils.sha256(
+        ethers.utils.toUtf8Bytes('user_cost_report_wallet')
+      )
+      userL1Signer = new Wallet(userKey, parentProvider)
+      userL2Signer = new Wallet(userKey, childProvider)
+      await fund(
+        deployerL1Signer,
+        deployerL2Signer,
+        await userL1Signer.getAddress(),
+        ethers.utils.parseEther('10.0')
+      )
+    }
+    deployerAddress = await deployerL1Signer.getAddress()
+    userAddress = await userL1Signer.getAddress()
+
+    const feeToken = await getFeeToken(
+      _l2Network.ethBridge.inbox,
+      parentProvider
+    )
+    nativeToken =
+      feeToken === ethers.constants.AddressZero
+        ? undefined
+        : ERC20__factory.connect(feeToken, userL1Signer)
+    if (nativeToken && deployerAddress !== userAddress) {
+      const supply = await nativeToken.balanceOf(deployerAddress)
+      await (
+        await nativeToken
+          .connect(deployerL1Signer)
+          .transfer(userAddress, supply.div(10))
+      ).wait()
+    }
+
+    report = {
+      commit: execSync('git rev-parse HEAD').toString().trim(),
+      parentChainId: (await parentProvider.getNetwork()).chainId,
+      childChainId: (await childProvider.getNetwork()).chainId,
+      feeToken,
+      packedUserData: config.packedUserData,
+      operations: [],
+    }
+  })
+
+  after(function () {
+    if (report) {
+      writeFileSync(config.reportPath, JSON.stringify(report, null, 2))
+      console.log('Cost report written to', config.reportPath)
+    }
+  })
+
+  it('fee token deposit', async function () {
+    if (!nativeToken) {
+      skip('feeTokenDeposit', 'only chains with a custom fee token')
+      return
+    }
+
+    // native currency of the child chain, deposited through the inbox instead of a gateway
+    const amount = await _getScaledAmount(
+      nativeToken.address,
+      ethers.utils.parseEther('1.0'),
+      parentProvider
+    )
+    await (
+      await nativeToken.approve(_l2Network.ethBridge.inbox, amount)
+    ).wait()
+    // not part of the IERC20Inbox of the token bridge
+    const inbox = new ethers.Contract(
+      _l2Network.ethBridge.inbox,
+      ['function depositERC20(uint256 amount) returns (uint256)'],
+      userL1Signer
+    )
+    const depositTx: TransactionResponse = await inbox.depositERC20(amount)
+    const [ethDeposit] = await new L1TransactionReceipt(
+      await depositTx.wait()
+    ).getEthDeposits(childProvider)
+    await ethDeposit.wait()
+    await recordParentChainOperation('feeTokenDeposit', depositTx)
+  })
+
+  it('standard token deposits and withdrawal', async function () {
+    const token = await (
+      await new TestERC20__factory(userL1Signer).deploy()
+    ).deployed()
+    await (await token.mint()).wait()
+
+    // first deposit also deploys the L2 token
+    await depositViaRouter('standardDeposit', token.address, 100)
+    await depositViaRouter('standardDepositWarm', token.address, 100)
+    await withdrawViaRouter('standardWithdrawal', token.address, 50)
+  })
+
+  it('custom token registration, deposit and withdrawal', async function () {
+    const customL1Token = await (nativeToken
+      ? await new TestOrbitCustomTokenL1__factory(deployerL1Signer).deploy(
+          _l2Network.tokenBridge.l1CustomGateway,
+          _l2Network.tokenBridge.l1GatewayRouter
+        )
+      : await new TestCustomTokenL1__factory(deployerL1Signer).deploy(
+          _l2Network.tokenBridge.l1CustomGateway,
+          _l2Network.tokenBridge.l1GatewayRouter
+        )
+    ).deployed()
+    await (await customL1Token.connect(userL1Signer).mint()).wait()
+    const customL2Token = await (
+      await new TestArbCustomToken__factory(deployerL2Signer).deploy(
+        _l2Network.tokenBridge.l2CustomGateway,
+        customL1Token.address
+      )
+    ).deployed()
+
+    // registration creates a retryable for both the custom gateway and the router
+    const gatewayRetryable = await estimateRetryable(
+      _l2Network.tokenBridge.l1CustomGateway,
+      _l2Network.tokenBridge.l2CustomGateway,
+      L2CustomGateway__factory.createInterface().encodeFunctionData(
+        'registerTokenFromL1',
+        [[customL1Token.address], [customL2Token.address]]
+      )
+    )
+    const routerRetryable = await estimateRetryable(
+      _l2Network.tokenBridge.l1GatewayRouter,
+      _l2Network.tokenBridge.l2GatewayRouter,
+      L2GatewayRouter__factory.createInterface().encodeFunctionData(
+        'setGateway',
+        [[customL1Token.address], [_l2Network.tokenBridge.l2CustomGateway]]
+      )
+    )
+    if (nativeToken) {
+      await (
+        await nativeToken.approve(
+          customL1Token.address,
+          gatewayRetryable.value.add(routerRetryable.value)
+        )
+      ).wait()
+    }
+    const registrationTx = await customL1Token
+      .connect(userL1Signer)
+      .registerTokenOnL2(
+        customL2Token.address,
+        gatewayRetryable.maxSubmissionCost,
+        routerRetryable.maxSubmissionCost,
+        gatewayRetryable.gasLimit,
+        routerRetryable.gasLimit,
+        // both retryables are sent with the same gas price
+        maxBN(gatewayRetryable.maxFeePerGas, routerRetryable.maxFeePerGas),
+        gatewayRetryable.value,
+        routerRetryable.value,
+        userAddress,
+        {
+          value: nativeToken
+            ? BigNumber.from(0)
+            : gatewayRetryable.value.add(routerRetryable.value),
+        }
+      )
+    await recordParentChainOperation('customTokenRegistration', registrationTx)
+
+    await depositViaRouter('customDeposit', customL1Token.address, 100)
+    await withdrawViaRouter('customWithdrawal', customL1Token.address, 50)
+  })
+
+  it('WETH deposits and withdrawal', async function () {
+    if (nativeToken) {
+      const reason = 'no WETH gateway on chains with a custom fee token'
+      skip('wethWrap', reason)
+      skip('wethDeposit', reason)
+      skip('wethDepositNativeEth', reason)
+      skip('wethWithdrawal', reason)
+      return
+    }
+
+    const amount = ethers.utils.parseEther('0.1')
+    const l1Weth = TestWETH9__factory.connect(
+      _l2Network.tokenBridge.l1Weth,
+      userL1Signer
+    )
+
+    // wrapping is the extra TX paid by users depositing their ETH as WETH
+    await recordParentChainOperation(
+      'wethWrap',
+      await l1Weth.deposit({ value: amount })
+    )
+    await depositViaRouter('wethDeposit', l1Weth.address, amount)
+    await depositViaRouter('wethDepositNativeEth', l1Weth.address, amount, true)
+    await withdrawViaRouter('wethWithdrawal', l1Weth.address, amount)
+  })
+
+  it('USDC deposit and withdrawal', async function () {
+    if (nativeToken) {
+      skip('usdcDeposit', 'USDC gateway is only set up on ETH based chains')
+      skip('usdcWithdrawal', 'USDC gateway is only set up on ETH based chains')
+      return
+    }
+    if (existingDeployment && !config.rollupOwnerKey) {
+      const reason = 'ROLLUP_OWNER_KEY is needed to register the USDC gateway'
+      skip('usdcDeposit', reason)
+      skip('usdcWithdrawal', reason)
+      return
+    }
+
+    const amount = ethers.utils.parseUnits('2', 6)
+    const { l1Usdc, l2Usdc, l2UsdcGateway } = await setupUsdcGateways()
+    await depositViaRouter('usdcDeposit', l1Usdc, amount)
+
+    await (
+      await ERC20__factory.connect(l2Usdc, userL2Signer).approve(
+        l2UsdcGateway,
+        amount
+      )
+    ).wait()
+    await withdrawViaRouter('usdcWithdrawal', l1Usdc, amount)
+  })
+})
+
+/**
+ * Deposit `amount` of `l1Token` from the user to itself through the router, paying for the retryable.
+ * If `ethDeposit` is set, the amount of a WETH deposit is sent as ETH instead of being pulled from the user.
+ */
+async function depositViaRouter(
+  operation: string,
+  l1Token: string,
+  amount: ethers.BigNumberish,
+  ethDeposit = false
+) {
+  const router = L1GatewayRouter__factory.connect(
+    _l2Network.tokenBridge.l1GatewayRouter,
+    userL1Signer
+  )
+  const gateway = L1ERC20Gateway__factory.connect(
+    await router.getGateway(l1Token),
+    userL1Signer
+  )
+  const isWeth = l1Token === _l2Network.tokenBridge.l1Weth
+
+  if (!ethDeposit) {
+    await (
+      await ERC20__factory.connect(l1Token, userL1Signer).approve(
+        gateway.address,
+        amount
+      )
+    ).wait()
+  }
+
+  const retryable = await estimateRetryable(
+    gateway.address,
+    await gateway.counterpartGateway(),
+    await router.getOutboundCalldata(
+      l1Token,
+      userAddress,
+      userAddress,
+      amount,
+      '0x'
+    ),
+    // deposited ETH is sent as the L2 call value
+    isWeth ? BigNumber.from(amount) : BigNumber.from(0)
+  )
+  if (nativeToken) {
+    await (
+      await nativeToken.approve(gateway.address, retryable.value)
+    ).wait()
+  }
+
+  const userEncodedData = encodeUserData(
+    retryable.maxSubmissionCost,
+    retryable.value
+  )
+  const depositTx = ethDeposit
+    ? await router.outboundTransferETHCustomRefund(
+        l1Token,
+        userAddress,
+        userAddress,
+        amount,
+        retryable.gasLimit,
+        retryable.maxFeePerGas,
+        userEncodedData,
+        { value: retryable.value.add(amount) }
+      )
+    : await router.outboundTransferCustomRefund(
+        l1Token,
+        userAddress,
+        userAddress,
+        amount,
+        retryable.gasLimit,
+        retryable.maxFeePerGas,
+        userEncodedData,
+        { value: nativeToken ? BigNumber.from(0) : retryable.value }
+      )
+  await recordParentChainOperation(operation, depositTx)
+}
+
+/**
+ * Withdraw `amount` of `l1Token` from the user to itself through the L2 router.
+ * The withdrawal is only executed on the parent chain if COST_REPORT_EXECUTE_WITHDRAWALS is set.
+ */
+async function withdrawViaRouter(
+  operation: string,
+  l1Token: string,
+  amount: ethers.BigNumberish
+) {
+  const l2Router = L2GatewayRouter__factory.connect(
+    _l2Network.tokenBridge.l2GatewayRouter,
+    userL2Signer
+  )
+  const withdrawTx = await l2Router[
+    'outboundTransfer(address,address,uint256,bytes)'
+  ](l1Token, userAddress, amount, '0x')
+  const withdrawReceipt = await withdrawTx.wait()
+
+  const cost: OperationCost = {
+    operation,
+    childChainTx: await getTxCost(childProvider, withdrawReceipt, withdrawTx),
+  }
+  if (config.executeWithdrawals) {
+    const [l2ToL1Msg] = await new L2TransactionReceipt(
+      withdrawReceipt
+    ).getL2ToL1Messages(userL1Signer)
+    await l2ToL1Msg.waitUntilReadyToExecute(childProvider)
+    const executeTx = await l2ToL1Msg.execute(childProvider)
+    cost.parentChainTx = await getTxCost(
+      parentProvider,
+      await executeTx.wait(),
+      executeTx
+    )
+  }
+  report.operations.push(cost)
+}
+
+/**
+ * Record the cost of a parent chain TX and of the retryables it created, once they are redeemed
+ */
+async function recordParentChainOperation(
+  operation: string,
+  tx: TransactionResponse
+) {
+  const receipt = await tx.wait()
+  const messages = await new L1TransactionReceipt(
+    receipt
+  ).getL1ToL2Messages(childProvider)
+
+  const baseFee = (await parentProvider.getBlock(receipt.blockNumber))
+    .baseFeePerGas!
+  const inbox = IInbox__factory.connect(
+    _l2Network.ethBridge.inbox,
+    parentProvider
+  )
+  const retryables: RetryableCost[] = []
+  for (const message of messages) {
+    const result = await message.waitForStatus()
+    expect(result.status).to.be.eq(L1ToL2MessageStatus.REDEEMED)
+    if (result.status !== L1ToL2MessageStatus.REDEEMED) {
+      return
+    }
+
+    const dataLength = ethers.utils.hexDataLength(message.messageData.data)
+    retryables.push({
+      dataLength,
+      l2CallValue: message.messageData.l2CallValue.toString(),
+      maxSubmissionFee: message.messageData.maxSubmissionFee.toString(),
+      submissionFee: (
+        await inbox.calculateRetryableSubmissionFee(dataLength, baseFee, {
+          blockTag: receipt.blockNumber,
+        })
+      ).toString(),
+      gasLimit: message.messageData.gasLimit.toString(),
+      maxFeePerGas: message.messageData.maxFeePerGas.toString(),
+      autoRedeem: await getTxCost(childProvider, result.l2TxReceipt),
+    })
+  }
+
+  report.operations.push({
+    operation,
+    parentChainTx: await getTxCost(parentProvider, receipt, tx),
+    retryables,
+  })
+}
+
+function skip(operation: string, reason: string) {
+  report.operations.push({ operation, skipped: reason })
+}
+
+async function getTxCost(
+  provider: JsonRpcProvider,
+  receipt: TransactionReceipt,
+  tx?: TransactionResponse
+): Promise<TxCost> {
+  const cost: TxCost = {
+    txHash: receipt.transactionHash,
+    gasUsed: receipt.gasUsed.toString(),
+    effectiveGasPrice: receipt.effectiveGasPrice.toString(),
+    fee: receipt.gasUsed.mul(receipt.effectiveGasPrice).toString(),
+  }
+
+  if (tx) {
+    const data = ethers.utils.arrayify(tx.data)
+    const zeroBytes = data.filter(b => b === 0).length
+    cost.calldataBytes = data.length
+    cost.calldataGas = zeroBytes * 4 + (data.length - zeroBytes) * 16
+  }
+
+  // not part of the ethers receipt
+  const rawReceipt = await provider.send('eth_getTransactionReceipt', [
+    receipt.transactionHash,
+  ])
+  if (rawReceipt.gasUsedForL1 !== undefined) {
+    cost.gasUsedForL1 = BigNumber.from(rawReceipt.gasUsedForL1).toString()
+  }
+  return cost
+}
+
+/**
+ * Gas params of a retryable, and the value paying for it in the native token of the parent chain
+ */
+async function estimateRetryable(
+  from: string,
+  to: string,
+  data: string,
+  l2CallValue = BigNumber.from(0)
+) {
+  const estimate = await new L1ToL2MessageGasEstimator(
+    childProvider
+  ).estimateAll(
+    {
+      from,
+      to,
+      l2CallValue,
+      excessFeeRefundAddress: userAddress,
+      callValueRefundAddress: userAddress,
+      data,
+    },
+    await getBaseFee(parentProvider),
+    parentProvider
+  )
+
+  // there is no submission fee on chains with a custom fee token
+  const maxSubmissionCost = nativeToken
+    ? BigNumber.from(0)
+    : estimate.maxSubmissionCost
+  const fees = maxSubmissionCost.add(
+    estimate.gasLimit.mul(estimate.maxFeePerGas)
+  )
+  return {
+    gasLimit: estimate.gasLimit,
+    maxFeePerGas: estimate.maxFeePerGas,
+    maxSubmissionCost,
+    value: nativeToken
+      ? await _getScaledAmount(nativeToken.address, fees, parentProvider)
+      : fees,
+  }
+}
+
+function encodeUserData(maxSubmissionCost: BigNumber, feeAmount: BigNumber) {
+  if (config.packedUserData) {
+    return nativeToken
+      ? solidityPack(
+          ['bytes1', 'uint256', 'uint256'],
+          ['0x01', maxSubmissionCost, feeAmount]
+        )
+      : solidityPack(['bytes1', 'uint256'], ['0x01', maxSubmissionCost])
+  }
+  return nativeToken
+    ? defaultAbiCoder.encode(
+        ['uint256', 'bytes', 'uint256'],
+        [maxSubmissionCost, '0x', feeAmount]
+      )
+    : defaultAbiCoder.encode(['uint256', 'bytes'], [maxSubmissionCost, '0x'])
+}
+
+function maxBN(a: BigNumber, b: BigNumber) {
+  return a.gt(b) ? a : b
+}
+
+/**
+ * Token bridge of a chain known to the SDK, or deployed by L1_TOKEN_BRIDGE_CREATOR for ROLLUP_ADDRESS,
+ * undefined if it should be deployed by the test
+ */
+async function getExistingNetwork(): Promise<L2Network | undefined> {
+  const parentChainId = (await parentProvider.getNetwork()).chainId
+  const childChainId = (await childProvider.getNetwork()).chainId
+  if (l2Networks[childChainId] && !l2Networks[childChainId].isCustom) {
+    return l2Networks[childChainId]
+  }
+  if (!config.rollupAddress || !config.tokenBridgeCreator) {
+    return undefined
+  }
+
+  const rollup = RollupCore__factory.connect(
+    config.rollupAddress,
+    parentProvider
+  )
+  const inbox = await rollup.inbox()
+  const creator = L1AtomicTokenBridgeCreator__factory.connect(
+    config.tokenBridgeCreator,
+    parentProvider
+  )
+  const l1Deployment = await creator.inboxToL1Deployment(inbox)
+  const l2Deployment = await creator.inboxToL2Deployment(inbox)
+
+  const l2Network: L2Network = {
+    chainID: childChainId,
+    name: 'CostReportChild',
+    explorerUrl: '',
+    isCustom: true,
+    isArbitrum: true,
+    partnerChainID: parentChainId,
+    partnerChainIDs: [],
+    confirmPeriodBlocks: (await rollup.confirmPeriodBlocks()).toNumber(),
+    retryableLifetimeSeconds: 7 * 24 * 60 * 60,
+    nitroGenesisBlock: 0,
+    nitroGenesisL1Block: 0,
+    depositTimeout: 1800000,
+    blockTime: 0.25,
+    ethBridge: {
+      bridge: await rollup.bridge(),
+      inbox,
+      outbox: await rollup.outbox(),
+      rollup: rollup.address,
+      sequencerInbox: await rollup.sequencerInbox(),
+    },
+    tokenBridge: {
+      l1CustomGateway: l1Deployment.customGateway,
+      l1ERC20Gateway: l1Deployment.standardGateway,
+      l1GatewayRouter: l1Deployment.router,
+      l1MultiCall: await creator.l1Multicall(),
+      l1ProxyAdmin: ethers.constants.AddressZero,
+      l1Weth: l1Deployment.weth,
+      l1WethGateway: l1Deployment.wethGateway,
+
+      l2CustomGateway: l2Deployment.customGateway,
+      l2ERC20Gateway: l2Deployment.standardGateway,
+      l2GatewayRouter: l2Deployment.router,
+      l2Multicall: l2Deployment.multicall,
+      l2ProxyAdmin: l2Deployment.proxyAdmin,
+      l2Weth: l2Deployment.weth,
+      l2WethGateway: l2Deployment.wethGateway,
+    },
+  }
+
+  // the SDK looks up both chains when following messages
+  const parentNetwork: L1Network | undefined =
+    l1Networks[parentChainId] || l2Networks[parentChainId]
+      ? undefined
+      : {
+          blockTime: 12,
+          chainID: parentChainId,
+          explorerUrl: '',
+          isCustom: true,
+          name: 'CostReportParent',
+          partnerChainIDs: [childChainId],
+          isArbitrum: false,
+        }
+  addCustomNetwork({
+    customL1Network: parentNetwork,
+    customL2Network: l2Network,
+  })
+  return l2Network
+}
+
+async function impersonate(provider: JsonRpcProvider, address: string) {
+  await provider.send('hardhat_impersonateAccount', [address])
+  return provider.getSigner(address)
+}
+
+/**
+ * Send `amount` of ETH from the funders to `to` on both chains
+ */
+async function fund(
+  parentFunder: Signer,
+  childFunder: Signer,
+  to: string,
+  amount: BigNumber
+) {
+  await (await parentFunder.sendTransaction({ to, value: amount })).wait()
+  await (await childFunder.sendTransaction({ to, value: amount })).wait()
+}
+
+/**
+ * Deploy USDC and the USDC gateways on both chains, register them in the routers and fund the user with USDC
+ */
+async function setupUsdcGateways() {
+  const proxyAdmin = await (
+    await new ProxyAdmin__factory(deployerL1Signer).deploy()
+  ).deployed()
+  const proxyAdminL2 = await (
+    await new ProxyAdmin__factory(deployerL2Signer).deploy()
+  ).deployed()
+
+  const l1UsdcGateway = L1USDCGateway__factory.connect(
+    (
+      await new TransparentUpgradeableProxy__factory(deployerL1Signer).deploy(
+        (
+          await (await new L1USDCGateway__factory(deployerL1Signer).deploy())
+            .deployed()
+        ).address,
+        proxyAdmin.address,
+        '0x'
+      )
+    ).address,
+    deployerL1Signer
+  )
+  const l2UsdcGateway = L2USDCGateway__factory.connect(
+    (
+      await new TransparentUpgradeableProxy__factory(deployerL2Signer).deploy(
+        (
+          await (await new L2USDCGateway__factory(deployerL2Signer).deploy())
+            .deployed()
+        ).address,
+        proxyAdminL2.address,
+        '0x'
+      )
+    ).address,
+    deployerL2Signer
+  )
+
+  // USDC on both chains, with the deployer as master minter
+  const l1UsdcProxy = await (
+    await new TransparentUpgradeableProxy__factory(deployerL1Signer).deploy(
+      (
+        await _deployUsdcToken(deployerL1Signer)
+      ).address,
+      proxyAdmin.address,
+      '0x'
+    )
+  ).deployed()
+  const l1Usdc = IFiatToken__factory.connect(
+    l1UsdcProxy.address,
+    deployerL1Signer
+  )
+  const l2Usdc = IFiatToken__factory.connect(
+    await _deployUsdcProxy(
+      deployerL2Signer,
+      (
+        await _deployUsdcToken(deployerL2Signer)
+      ).address,
+      proxyAdminL2.address
+    ),
+    deployerL2Signer
+  )
+  // deployer has the same address on both chains
+  for (const usdc of [l1Usdc, l2Usdc]) {
+    await (
+      await usdc.initialize(
+        'USDC token',
+        'USDC.e',
+        'USD',
+        6,
+        deployerAddress,
+        ethers.Wallet.createRandom().address,
+        ethers.Wallet.createRandom().address,
+        deployerAddress
+      )
+    ).wait()
+    await (await usdc.initializeV2('USDC')).wait()
+    await (
+      await usdc.initializeV2_1(ethers.Wallet.createRandom().address)
+    ).wait()
+    await (await usdc.initializeV2_2([], 'USDC')).wait()
+  }
+
+  await (
+    await l1UsdcGateway.initialize(
+      l2UsdcGateway.address,
+      _l2Network.tokenBridge.l1GatewayRouter,
+      _l2Network.ethBridge.inbox,
+      l1Usdc.address,
+      l2Usdc.address,
+      deployerAddress
+    )
+  ).wait()
+  await (
+    await l2UsdcGateway.initialize(
+      l1UsdcGateway.address,
+      _l2Network.tokenBridge.l2GatewayRouter,
+      l1Usdc.address,
+      l2Usdc.address,
+      deployerAddress
+    )
+  ).wait()
+
+  // register the gateway through the upgrade executor owning the router
+  const router = L1GatewayRouter__factory.connect(
+    _l2Network.tokenBridge.l1GatewayRouter,
+    deployerL1Signer
+  )
+  const routerRetryable = await estimateRetryable(
+    router.address,
+    _l2Network.tokenBridge.l2GatewayRouter,
+    L2GatewayRouter__factory.createInterface().encodeFunctionData(
+      'setGateway',
+      [[l1Usdc.address], [l2UsdcGateway.address]]
+    )
+  )
+  const rollupOwner = new Wallet(
+    config.rollupOwnerKey || LOCALHOST_L3_OWNER_KEY,
+    parentProvider
+  )
+  const upgradeExecutor = UpgradeExecutor__factory.connect(
+    await IOwnable__factory.connect(
+      _l2Network.ethBridge.rollup,
+      parentProvider
+    ).owner(),
+    rollupOwner
+  )
+  const registrationTx = await upgradeExecutor.executeCall(
+    router.address,
+    router.interface.encodeFunctionData('setGateways', [
+      [l1Usdc.address],
+      [l1UsdcGateway.address],
+      routerRetryable.gasLimit,
+      routerRetryable.maxFeePerGas,
+      routerRetryable.maxSubmissionCost,
+    ]),
+    { value: routerRetryable.value }
+  )
+  const [message] = await new L1TransactionReceipt(
+    await registrationTx.wait()
+  ).getL1ToL2Messages(childProvider)
+  expect((await message.waitForStatus()).status).to.be.eq(
+    L1ToL2MessageStatus.REDEEMED
+  )
+
+  // L2 gateway mints deposits, user gets USDC to deposit
+  await (
+    await l2Usdc.configureMinter(
+      l2UsdcGateway.address,
+      ethers.constants.MaxUint256
+    )
+  ).wait()
+  await (
+    await l1Usdc.configureMinter(
+      deployerAddress,
+      ethers.utils.parseUnits('1000', 6)
+    )
+  ).wait()
+  await (
+    await l1Usdc.mint(userAddress, ethers.utils.parseUnits('10', 6))
+  ).wait()
+
+  return {
+    l1Usdc: l1Usdc.address,
+    l2Usdc: l2Usdc.address,
+    l2UsdcGateway: l2UsdcGateway.address,
+  }
+}
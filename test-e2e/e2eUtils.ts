@@ -0,0 +1,84 @@
+import { Signer, ethers } from 'ethers'
+import {
+  IERC20Bridge__factory,
+  IFiatTokenProxy__factory,
+  IInbox__factory,
+} from '../build/types'
+import {
+  abi as SigCheckerAbi,
+  bytecode as SigCheckerBytecode,
+} from '@offchainlabs/stablecoin-evm/artifacts/hardhat/contracts/util/SignatureChecker.sol/SignatureChecker.json'
+import {
+  abi as UsdcAbi,
+  bytecode as UsdcBytecode,
+} from '@offchainlabs/stablecoin-evm/artifacts/hardhat/contracts/v2/FiatTokenV2_2.sol/FiatTokenV2_2.json'
+import {
+  abi as UsdcProxyAbi,
+  bytecode as UsdcProxyBytecode,
+} from '@offchainlabs/stablecoin-evm/artifacts/hardhat/contracts/v1/FiatTokenProxy.sol/FiatTokenProxy.json'
+
+export const getFeeToken = async (inbox: string, parentProvider: any) => {
+  const bridge = await IInbox__factory.connect(inbox, parentProvider).bridge()
+
+  let feeToken = ethers.constants.AddressZero
+
+  try {
+    feeToken = await IERC20Bridge__factory.connect(
+      bridge,
+      parentProvider
+    ).nativeToken()
+  } catch {}
+
+  return feeToken
+}
+
+export async function _deployUsdcToken(deployer: Signer) {
+  /// deploy library
+  const sigCheckerFac = new ethers.ContractFactory(
+    SigCheckerAbi,
+    SigCheckerBytecode,
+    deployer
+  )
+  const sigCheckerLib = await sigCheckerFac.deploy()
+
+  // prepare bridged usdc bytecode
+  const bytecodeWithPlaceholder: string = UsdcBytecode
+  const placeholder = '__$715109b5d747ea58b675c6ea3f0dba8c60$__'
+
+  const libAddressStripped = sigCheckerLib.address.replace(/^0x/, '')
+  const bridgedUsdcLogicBytecode = bytecodeWithPlaceholder
+    .split(placeholder)
+    .join(libAddressStripped)
+
+  // deploy bridged usdc logic
+  const bridgedUsdcLogicFactory = new ethers.ContractFactory(
+    UsdcAbi,
+    bridgedUsdcLogicBytecode,
+    deployer
+  )
+  const bridgedUsdcLogic = await bridgedUsdcLogicFactory.deploy()
+
+  return bridgedUsdcLogic
+}
+
+export async function _deployUsdcProxy(
+  deployer: Signer,
+  bridgedUsdcLogic: string,
+  proxyAdmin: string
+) {
+  const usdcProxyFactory = new ethers.ContractFactory(
+    UsdcProxyAbi,
+    UsdcProxyBytecode,
+    deployer
+  )
+  const usdcProxy = await usdcProxyFactory.deploy(bridgedUsdcLogic)
+
+  await (
+    await IFiatTokenProxy__factory.connect(
+      usdcProxy.address,
+      deployer
+    ).changeAdmin(proxyAdmin)
+  ).wait()
+
+  return usdcProxy.address
+}
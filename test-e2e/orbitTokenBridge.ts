@@ -16,9 +16,7 @@ import {
 import {
   ERC20,
   ERC20__factory,
-  IERC20Bridge__factory,
   IERC20__factory,
-  IInbox__factory,
   IOwnable__factory,
   L1OrbitUSDCGateway__factory,
   L1GatewayRouter__factory,
@@ -43,17 +41,10 @@ import { defaultAbiCoder } from 'ethers/lib/utils'
 import { BigNumber, Wallet, ethers } from 'ethers'
 import { exit } from 'process'
 import {
-  abi as SigCheckerAbi,
-  bytecode as SigCheckerBytecode,
-} from '@offchainlabs/stablecoin-evm/artifacts/hardhat/contracts/util/SignatureChecker.sol/SignatureChecker.json'
-import {
-  abi as UsdcAbi,
-  bytecode as UsdcBytecode,
-} from '@offchainlabs/stablecoin-evm/artifacts/hardhat/contracts/v2/FiatTokenV2_2.sol/FiatTokenV2_2.json'
-import {
-  abi as UsdcProxyAbi,
-  bytecode as UsdcProxyBytecode,
-} from '@offchainlabs/stablecoin-evm/artifacts/hardhat/contracts/v1/FiatTokenProxy.sol/FiatTokenProxy.json'
+  _deployUsdcProxy,
+  _deployUsdcToken,
+  getFeeToken,
+} from './e2eUtils'
 const config = {
   parentUrl: 'http://127.0.0.1:8547',
   childUrl: 'http://127.0.0.1:3347',
@@ -1444,72 +1435,6 @@ async function waitOnL2Msg(tx: ethers.ContractTransaction) {
   expect(status).to.be.eq(L1ToL2MessageStatus.REDEEMED)
 }
 
-const getFeeToken = async (inbox: string, parentProvider: any) => {
-  const bridge = await IInbox__factory.connect(inbox, parentProvider).bridge()
-
-  let feeToken = ethers.constants.AddressZero
-
-  try {
-    feeToken = await IERC20Bridge__factory.connect(
-      bridge,
-      parentProvider
-    ).nativeToken()
-  } catch {}
-
-  return feeToken
-}
-
 function sleep(ms: number) {
   return new Promise(resolve => setTimeout(resolve, ms))
 }
-
-async function _deployUsdcToken(deployer: Wallet) {
-  /// deploy library
-  const sigCheckerFac = new ethers.ContractFactory(
-    SigCheckerAbi,
-    SigCheckerBytecode,
-    deployer
-  )
-  const sigCheckerLib = await sigCheckerFac.deploy()
-
-  // prepare bridged usdc bytecode
-  const bytecodeWithPlaceholder: string = UsdcBytecode
-  const placeholder = '__$715109b5d747ea58b675c6ea3f0dba8c60$__'
-
-  const libAddressStripped = sigCheckerLib.address.replace(/^0x/, '')
-  const bridgedUsdcLogicBytecode = bytecodeWithPlaceholder
-    .split(placeholder)
-    .join(libAddressStripped)
-
-  // deploy bridged usdc logic
-  const bridgedUsdcLogicFactory = new ethers.ContractFactory(
-    UsdcAbi,
-    bridgedUsdcLogicBytecode,
-    deployer
-  )
-  const bridgedUsdcLogic = await bridgedUsdcLogicFactory.deploy()
-
-  return bridgedUsdcLogic
-}
-
-async function _deployUsdcProxy(
-  deployer: Wallet,
-  bridgedUsdcLogic: string,
-  proxyAdmin: string
-) {
-  const usdcProxyFactory = new ethers.ContractFactory(
-    UsdcProxyAbi,
-    UsdcProxyBytecode,
-    deployer
-  )
-  const usdcProxy = await usdcProxyFactory.deploy(bridgedUsdcLogic)
-
-  await (
-    await IFiatTokenProxy__factory.connect(
-      usdcProxy.address,
-      deployer
-    ).changeAdmin(proxyAdmin)
-  ).wait()
-
-  return usdcProxy.address
-}
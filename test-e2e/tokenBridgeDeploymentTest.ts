@@ -3,7 +3,6 @@ import {
   AeWETH__factory,
   ArbMulticall2,
   ArbMulticall2__factory,
-  BeaconProxyFactory__factory,
   IERC20Bridge__factory,
   IInboxProxyAdmin__factory,
   IInbox__factory,
@@ -26,6 +25,7 @@ import {
   L2GatewayRouter__factory,
   L2WethGateway,
   L2WethGateway__factory,
+  MinimalBeaconProxyFactory__factory,
   StandardArbERC20__factory,
   UpgradeableBeacon__factory,
 } from '../build/types'
@@ -257,7 +257,7 @@ async function checkL1StandardGatewayInitialization(
   )
   expect((await l1ERC20Gateway.cloneableProxyHash()).toLowerCase()).to.be.eq(
     (
-      await BeaconProxyFactory__factory.connect(
+      await MinimalBeaconProxyFactory__factory.connect(
         await l1ERC20Gateway.l2BeaconProxyFactory(),
         l2Provider
       ).cloneableProxyHash()
@@ -398,7 +398,7 @@ async function checkL2StandardGatewayInitialization(
     l2Deployment.router.toLowerCase()
   )
 
-  const beaconProxyFactory = BeaconProxyFactory__factory.connect(
+  const beaconProxyFactory = MinimalBeaconProxyFactory__factory.connect(
     await l2ERC20Gateway.beaconProxyFactory(),
     l2Provider
   )
@@ -0,0 +1,296 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "forge-std/Test.sol";
+import {GatewayMessageHandler} from "contracts/tokenbridge/libraries/gateway/GatewayMessageHandler.sol";
+import {ITokenGateway} from "contracts/tokenbridge/libraries/gateway/ITokenGateway.sol";
+
+contract GatewayMessageHandlerTest is Test {
+    GatewayMessageHandlerHarness public handler;
+
+    function setUp() public {
+        handler = new GatewayMessageHandlerHarness();
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_parseFromL1GatewayMsg(bytes memory gatewayData, bytes memory callHookData)
+        public
+    {
+        (bytes memory parsedGatewayData, bytes memory parsedCallHookData) = handler
+            .parseFromL1GatewayMsg(abi.encode(gatewayData, callHookData));
+
+        assertEq(parsedGatewayData, gatewayData, "Invalid gatewayData");
+        assertEq(parsedCallHookData, callHookData, "Invalid callHookData");
+    }
+
+    function test_parseFromL1GatewayMsg_Packed(bytes memory gatewayData, bytes memory callHookData)
+        public
+    {
+        bytes memory packed = handler.encodeToL2GatewayMsgPacked(gatewayData, callHookData);
+        assertEq(
+            packed.length,
+            5 + gatewayData.length + callHookData.length,
+            "Invalid packed length"
+        );
+
+        (bytes memory parsedGatewayData, bytes memory parsedCallHookData) = handler
+            .parseFromL1GatewayMsg(packed);
+
+        assertEq(parsedGatewayData, gatewayData, "Invalid gatewayData");
+        assertEq(parsedCallHookData, callHookData, "Invalid callHookData");
+    }
+
+    function test_parseFromL1GatewayMsg_revert_PackedTooShort() public {
+        vm.expectRevert("INVALID_PACKED_MSG");
+        handler.parseFromL1GatewayMsg(abi.encodePacked(GatewayMessageHandler.PACKED_MSG_VERSION));
+
+        // gatewayData length is past the end of the message
+        vm.expectRevert("INVALID_PACKED_MSG");
+        handler.parseFromL1GatewayMsg(
+            abi.encodePacked(GatewayMessageHandler.PACKED_MSG_VERSION, uint32(4), bytes3("abc"))
+        );
+    }
+
+    function test_encodeFromRouterToGateway(address from, uint128 maxSubmissionCost) public {
+        // legacy user data keeps the legacy router encoding
+        bytes memory userData = abi.encode(maxSubmissionCost, "");
+        bytes memory routerData = handler.encodeFromRouterToGateway(from, userData);
+        assertEq(routerData, abi.encode(from, userData), "Invalid router data");
+
+        (address parsedFrom, bytes memory parsedUserData) = handler.parseFromRouterToGateway(
+            routerData
+        );
+        assertEq(parsedFrom, from, "Invalid from");
+        assertEq(parsedUserData, userData, "Invalid user data");
+    }
+
+    function test_encodeFromRouterToGateway_Packed(address from, uint256 maxSubmissionCost)
+        public
+    {
+        bytes memory userData = abi.encodePacked(
+            GatewayMessageHandler.PACKED_MSG_VERSION,
+            maxSubmissionCost
+        );
+        bytes memory routerData = handler.encodeFromRouterToGateway(from, userData);
+        assertEq(routerData.length, 1 + 20 + userData.length, "Invalid router data length");
+
+        (address parsedFrom, bytes memory parsedUserData) = handler.parseFromRouterToGateway(
+            routerData
+        );
+        assertEq(parsedFrom, from, "Invalid from");
+        assertEq(parsedUserData, userData, "Invalid user data");
+    }
+
+    function test_parseFromRouterToGateway_revert_PackedTooShort() public {
+        vm.expectRevert("INVALID_PACKED_MSG");
+        handler.parseFromRouterToGateway(
+            abi.encodePacked(GatewayMessageHandler.PACKED_MSG_VERSION, bytes19(0))
+        );
+    }
+
+    function test_parseFromRouter(address from, uint128 maxSubmissionCost) public {
+        bytes memory userData = abi.encode(maxSubmissionCost, "");
+        (address parsedFrom, bytes memory parsedUserData) = handler.parseFromRouter(
+            abi.encode(from, userData),
+            true
+        );
+        assertEq(parsedFrom, from, "Invalid from");
+        assertEq(parsedUserData, userData, "Invalid user data");
+    }
+
+    function test_parseFromRouter_AppendedSender(address from, bytes memory userData) public {
+        bytes memory callData = GatewayMessageHandler.appendSenderToGatewayCall(
+            abi.encodeWithSelector(
+                GatewayMessageHandlerHarness.parseFromRouter.selector,
+                userData,
+                true
+            ),
+            from
+        );
+        (bool success, bytes memory returnData) = address(handler).call(callData);
+        assertTrue(success, "Call failed");
+
+        (address parsedFrom, bytes memory parsedUserData) = abi.decode(
+            returnData,
+            (address, bytes)
+        );
+        assertEq(parsedFrom, from, "Invalid from");
+        assertEq(parsedUserData, userData, "Invalid user data");
+    }
+
+    function test_parseFromRouter_AppendedSenderNotFromRouter(address from, address spoofed)
+        public
+    {
+        bytes memory userData = abi.encode(from, abi.encode(uint256(100), ""));
+        // anyone can append 20 bytes, they are ignored unless the call comes from the router
+        bytes memory callData = abi.encodePacked(
+            abi.encodeWithSelector(
+                GatewayMessageHandlerHarness.parseFromRouter.selector,
+                userData,
+                false
+            ),
+            spoofed
+        );
+        (bool success, bytes memory returnData) = address(handler).call(callData);
+        assertTrue(success, "Call failed");
+
+        (address parsedFrom, ) = abi.decode(returnData, (address, bytes));
+        assertEq(parsedFrom, from, "Invalid from");
+    }
+
+    function test_parseDepositHook(uint256 gasLimit, bytes memory hookData) public {
+        bytes memory callHookData = GatewayMessageHandler.encodeDepositHook(gasLimit, hookData);
+        assertEq(
+            callHookData,
+            abi.encodePacked(bytes1(0x02), gasLimit, hookData),
+            "Invalid deposit hook"
+        );
+        assertTrue(GatewayMessageHandler.isDepositHook(callHookData), "Not a deposit hook");
+
+        (uint256 parsedGasLimit, bytes memory parsedHookData) = GatewayMessageHandler
+            .parseDepositHook(callHookData);
+        assertEq(parsedGasLimit, gasLimit, "Invalid gas limit");
+        assertEq(parsedHookData, hookData, "Invalid hook data");
+    }
+
+    function test_parseDepositHook_revert_TooShort() public {
+        vm.expectRevert("INVALID_DEPOSIT_HOOK");
+        handler.parseDepositHook(abi.encodePacked(bytes1(0x02), uint128(1)));
+    }
+
+    function test_isDepositHook() public {
+        assertFalse(GatewayMessageHandler.isDepositHook(""), "Empty data");
+        assertFalse(GatewayMessageHandler.isDepositHook(new bytes(33)), "Zero version");
+        assertFalse(
+            GatewayMessageHandler.isDepositHook(abi.encodePacked(bytes1(0x02), uint128(1))),
+            "Missing gas limit"
+        );
+        assertFalse(GatewayMessageHandler.isDepositHook(abi.encode("hook")), "Abi encoded data");
+    }
+
+    function test_packedDepositSize() public {
+        // typical L1ERC20Gateway deposit of a token not yet deployed on L2, without call hook data
+        bytes memory deployData = abi.encode(
+            abi.encode("IntArbTestToken"),
+            abi.encode("IARB"),
+            abi.encode(uint8(18))
+        );
+        address from = makeAddr("from");
+
+        // user data
+        bytes memory userData = abi.encode(uint256(70), "");
+        bytes memory packedUserData = abi.encodePacked(
+            GatewayMessageHandler.PACKED_MSG_VERSION,
+            uint256(70)
+        );
+        assertEq(userData.length, 96, "Invalid user data length");
+        assertEq(packedUserData.length, 33, "Invalid packed user data length");
+
+        // router to gateway
+        assertEq(
+            handler.encodeFromRouterToGateway(from, userData).length,
+            192,
+            "Invalid router data length"
+        );
+        assertEq(
+            handler.encodeFromRouterToGateway(from, packedUserData).length,
+            54,
+            "Invalid packed router data length"
+        );
+
+        // L1 to L2 gateway
+        bytes memory l2Msg = handler.encodeToL2GatewayMsg(deployData, "");
+        bytes memory packedL2Msg = handler.encodeToL2GatewayMsgPacked(deployData, "");
+        assertEq(l2Msg.length, 544, "Invalid L2 message length");
+        assertEq(packedL2Msg.length, 421, "Invalid packed L2 message length");
+
+        // retryable calldata
+        assertEq(
+            abi
+                .encodeWithSelector(
+                    ITokenGateway.finalizeInboundTransfer.selector,
+                    address(1),
+                    from,
+                    from,
+                    100,
+                    l2Msg
+                )
+                .length,
+            740,
+            "Invalid calldata length"
+        );
+        assertEq(
+            abi
+                .encodeWithSelector(
+                    ITokenGateway.finalizeInboundTransfer.selector,
+                    address(1),
+                    from,
+                    from,
+                    100,
+                    packedL2Msg
+                )
+                .length,
+            644,
+            "Invalid packed calldata length"
+        );
+    }
+}
+
+contract GatewayMessageHandlerHarness {
+    function encodeToL2GatewayMsg(bytes memory gatewayData, bytes memory callHookData)
+        external
+        pure
+        returns (bytes memory)
+    {
+        return GatewayMessageHandler.encodeToL2GatewayMsg(gatewayData, callHookData);
+    }
+
+    function encodeToL2GatewayMsgPacked(bytes memory gatewayData, bytes memory callHookData)
+        external
+        pure
+        returns (bytes memory)
+    {
+        return GatewayMessageHandler.encodeToL2GatewayMsgPacked(gatewayData, callHookData);
+    }
+
+    function parseFromL1GatewayMsg(bytes calldata _data)
+        external
+        pure
+        returns (bytes memory, bytes memory)
+    {
+        return GatewayMessageHandler.parseFromL1GatewayMsg(_data);
+    }
+
+    function encodeFromRouterToGateway(address _from, bytes calldata _data)
+        external
+        pure
+        returns (bytes memory)
+    {
+        return GatewayMessageHandler.encodeFromRouterToGateway(_from, _data);
+    }
+
+    function parseFromRouterToGateway(bytes calldata _data)
+        external
+        pure
+        returns (address, bytes memory)
+    {
+        return GatewayMessageHandler.parseFromRouterToGateway(_data);
+    }
+
+    function parseFromRouter(bytes calldata _data, bool _fromRouter)
+        external
+        pure
+        returns (address, bytes memory)
+    {
+        return GatewayMessageHandler.parseFromRouter(_data, _fromRouter);
+    }
+
+    function parseDepositHook(bytes memory callHookData)
+        external
+        pure
+        returns (uint256, bytes memory)
+    {
+        return GatewayMessageHandler.parseDepositHook(callHookData);
+    }
+}
@@ -5,6 +5,7 @@ pragma solidity ^0.8.0;
 import "forge-std/Test.sol";
 import { GatewayRouter } from "contracts/tokenbridge/libraries/gateway/GatewayRouter.sol";
 import { ERC20 } from "@openzeppelin/contracts/token/ERC20/ERC20.sol";
+import { IERC20Permit } from "@openzeppelin/contracts/token/ERC20/extensions/draft-IERC20Permit.sol";
 
 abstract contract GatewayRouterTest is Test {
     GatewayRouter public router;
@@ -27,4 +28,34 @@ abstract contract GatewayRouterTest is Test {
         vm.expectRevert("ONLY_OUTBOUND_ROUTER");
         router.finalizeInboundTransfer(address(1), address(2), address(3), 0, "");
     }
+
+    ////
+    // Helper functions
+    ////
+    function _signPermit(
+        address token,
+        uint256 ownerKey,
+        address spender,
+        uint256 value,
+        uint256 deadline
+    ) internal view returns (GatewayRouter.PermitData memory) {
+        address owner = vm.addr(ownerKey);
+        bytes32 structHash = keccak256(
+            abi.encode(
+                keccak256(
+                    "Permit(address owner,address spender,uint256 value,uint256 nonce,uint256 deadline)"
+                ),
+                owner,
+                spender,
+                value,
+                IERC20Permit(token).nonces(owner),
+                deadline
+            )
+        );
+        bytes32 digest = keccak256(
+            abi.encodePacked("\x19\x01", IERC20Permit(token).DOMAIN_SEPARATOR(), structHash)
+        );
+        (uint8 v, bytes32 r, bytes32 s) = vm.sign(ownerKey, digest);
+        return GatewayRouter.PermitData(deadline, v, r, s);
+    }
 }
@@ -235,6 +235,99 @@ abstract contract L1ArbitrumExtendedGatewayTest is L1ArbitrumGatewayTest {
         );
     }
 
+    function test_transferExitAndCallBatch() public virtual {
+        address seller = makeAddr("seller");
+        address otherSeller = makeAddr("otherSeller");
+        address desk = makeAddr("desk");
+
+        // seller previously bought the exit of otherSeller
+        vm.prank(otherSeller);
+        L1ArbitrumExtendedGateway(address(l1Gateway)).transferExitAndCall(
+            12, otherSeller, seller, "", ""
+        );
+
+        uint256[] memory exitNums = new uint256[](3);
+        exitNums[0] = 10;
+        exitNums[1] = 11;
+        exitNums[2] = 12;
+        address[] memory initialDestinations = new address[](3);
+        initialDestinations[0] = seller;
+        initialDestinations[1] = seller;
+        initialDestinations[2] = otherSeller;
+
+        // check events
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawRedirected(seller, desk, 10, "", "", false);
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawRedirected(seller, desk, 11, "", "", false);
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawRedirected(seller, desk, 12, "", "", false);
+
+        // do it
+        vm.prank(seller);
+        L1ArbitrumExtendedGateway(address(l1Gateway)).transferExitAndCallBatch(
+            exitNums, initialDestinations, desk, ""
+        );
+
+        // check exits are redirected
+        for (uint256 i = 0; i < exitNums.length; i++) {
+            (address target,) = L1ArbitrumExtendedGateway(address(l1Gateway)).getExternalCall(
+                exitNums[i], initialDestinations[i], ""
+            );
+            assertEq(target, desk, "Invalid dest");
+        }
+    }
+
+    function test_transferExitAndCallBatch_NonEmptyData() public virtual {
+        address seller = makeAddr("seller");
+        address desk = address(new TestExitReceiver());
+        bytes memory data = abi.encode("fun()");
+
+        uint256[] memory exitNums = new uint256[](2);
+        exitNums[0] = 10;
+        exitNums[1] = 11;
+        address[] memory initialDestinations = new address[](2);
+        initialDestinations[0] = seller;
+        initialDestinations[1] = seller;
+
+        // hook is called for every exit
+        vm.expectEmit(true, true, true, true);
+        emit ExitHookTriggered(seller, 10, data);
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawRedirected(seller, desk, 10, "", data, true);
+        vm.expectEmit(true, true, true, true);
+        emit ExitHookTriggered(seller, 11, data);
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawRedirected(seller, desk, 11, "", data, true);
+
+        vm.prank(seller);
+        L1ArbitrumExtendedGateway(address(l1Gateway)).transferExitAndCallBatch(
+            exitNums, initialDestinations, desk, data
+        );
+    }
+
+    function test_transferExitAndCallBatch_revert_NotExpectedSender() public {
+        uint256[] memory exitNums = new uint256[](2);
+        exitNums[0] = 10;
+        exitNums[1] = 11;
+        address[] memory initialDestinations = new address[](2);
+        initialDestinations[0] = makeAddr("seller");
+        initialDestinations[1] = makeAddr("otherSeller");
+
+        vm.prank(makeAddr("seller"));
+        vm.expectRevert("NOT_EXPECTED_SENDER");
+        L1ArbitrumExtendedGateway(address(l1Gateway)).transferExitAndCallBatch(
+            exitNums, initialDestinations, makeAddr("desk"), ""
+        );
+    }
+
+    function test_transferExitAndCallBatch_revert_WrongLength() public {
+        vm.expectRevert("WRONG_LENGTH");
+        L1ArbitrumExtendedGateway(address(l1Gateway)).transferExitAndCallBatch(
+            new uint256[](2), new address[](1), makeAddr("desk"), ""
+        );
+    }
+
     /////
     /// Event declarations
     /////
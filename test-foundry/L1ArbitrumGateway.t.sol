@@ -135,6 +135,39 @@ abstract contract L1ArbitrumGatewayTest is Test {
         );
     }
 
+    function test_outboundTransferCustomRefund_revert_HookGasTooHigh() public {
+        bytes memory callHookData = abi.encodePacked(bytes1(0x02), uint256(2_000_001), "hook");
+
+        vm.prank(router);
+        vm.expectRevert("HOOK_GAS_TOO_HIGH");
+        l1Gateway.outboundTransferCustomRefund(
+            address(token),
+            user,
+            user,
+            400,
+            3_000_000,
+            0.01 ether,
+            buildRouterEncodedData(callHookData)
+        );
+    }
+
+    function test_outboundTransferCustomRefund_revert_HookGasExceedsMaxGas() public {
+        // retryable needs gas for the deposit on top of the hook
+        bytes memory callHookData = abi.encodePacked(bytes1(0x02), uint256(200_000), "hook");
+
+        vm.prank(router);
+        vm.expectRevert("HOOK_GAS_EXCEEDS_MAX_GAS");
+        l1Gateway.outboundTransferCustomRefund(
+            address(token),
+            user,
+            user,
+            400,
+            200_000,
+            0.01 ether,
+            buildRouterEncodedData(callHookData)
+        );
+    }
+
     function test_outboundTransferCustomRefund_revert_L1NotContract() public {
         address invalidTokenAddress = address(70);
 
@@ -158,6 +191,13 @@ abstract contract L1ArbitrumGatewayTest is Test {
         );
     }
 
+    function test_outboundTransferBatchCustomRefund_revert_NotFromRouter() public {
+        vm.expectRevert("NOT_FROM_ROUTER");
+        L1ArbitrumGateway(address(l1Gateway)).outboundTransferBatchCustomRefund(
+            new address[](1), user, new address[](1), new uint256[](1), 0.1 ether, 0.01 ether, ""
+        );
+    }
+
     function test_postUpgradeInit() public {
         address proxyAdmin = makeAddr("proxyAdmin");
         vm.store(
@@ -182,6 +222,32 @@ abstract contract L1ArbitrumGatewayTest is Test {
         L1ArbitrumGateway(address(l1Gateway)).postUpgradeInit();
     }
 
+    function test_setPackedL2MsgEnabled() public {
+        assertFalse(
+            L1ArbitrumGateway(address(l1Gateway)).packedL2MsgEnabled(),
+            "Enabled by default"
+        );
+
+        vm.expectEmit(true, true, true, true);
+        emit PackedL2MsgEnabledSet(true);
+        _setPackedL2MsgEnabled(true);
+        assertTrue(L1ArbitrumGateway(address(l1Gateway)).packedL2MsgEnabled(), "Not enabled");
+
+        _setPackedL2MsgEnabled(false);
+        assertFalse(L1ArbitrumGateway(address(l1Gateway)).packedL2MsgEnabled(), "Not disabled");
+    }
+
+    function test_setPackedL2MsgEnabled_revert_OnlyRouterOwner() public {
+        vm.mockCall(
+            router,
+            abi.encodeWithSelector(IL1GatewayRouter.owner.selector),
+            abi.encode(makeAddr("routerOwner"))
+        );
+
+        vm.expectRevert("ONLY_ROUTER_OWNER");
+        L1ArbitrumGateway(address(l1Gateway)).setPackedL2MsgEnabled(true);
+    }
+
     function test_supportsInterface() public {
         bytes4 iface = type(IERC165).interfaceId;
         assertEq(l1Gateway.supportsInterface(iface), true, "Interface should be supported");
@@ -189,6 +255,12 @@ abstract contract L1ArbitrumGatewayTest is Test {
         iface = IL1ArbitrumGateway.outboundTransferCustomRefund.selector;
         assertEq(l1Gateway.supportsInterface(iface), true, "Interface should be supported");
 
+        iface = L1ArbitrumGateway.outboundTransferBatchCustomRefund.selector;
+        assertEq(l1Gateway.supportsInterface(iface), true, "Interface should be supported");
+
+        iface = GatewayMessageHandler.APPENDED_SENDER_INTERFACE_ID;
+        assertEq(l1Gateway.supportsInterface(iface), true, "Interface should be supported");
+
         iface = bytes4(0);
         assertEq(l1Gateway.supportsInterface(iface), false, "Interface shouldn't be supported");
 
@@ -210,6 +282,23 @@ abstract contract L1ArbitrumGatewayTest is Test {
 
         return routerEncodedData;
     }
+
+    /// @dev as the owner of the router, which is mocked since the gateway tests use an EOA router
+    function _setPackedL2MsgEnabled(bool enabled) internal {
+        address routerOwner = makeAddr("routerOwner");
+        vm.mockCall(
+            router,
+            abi.encodeWithSelector(IL1GatewayRouter.owner.selector),
+            abi.encode(routerOwner)
+        );
+        vm.prank(routerOwner);
+        L1ArbitrumGateway(address(l1Gateway)).setPackedL2MsgEnabled(enabled);
+    }
+
+    ////
+    // Event declarations
+    ////
+    event PackedL2MsgEnabledSet(bool enabled);
 }
 
 contract L1ArbitrumGatewayMock is L1ArbitrumGateway {
@@ -9,11 +9,18 @@ import {
     L2DeploymentAddresses,
     TransparentUpgradeableProxy,
     ProxyAdmin,
-    ClonableBeaconProxy,
-    BeaconProxyFactory
+    MinimalBeaconProxy,
+    MinimalBeaconProxyFactory
 } from "contracts/tokenbridge/ethereum/L1AtomicTokenBridgeCreator.sol";
-import {L1TokenBridgeRetryableSender} from
-    "contracts/tokenbridge/ethereum/L1TokenBridgeRetryableSender.sol";
+import {
+    L1TokenBridgeRetryableSender,
+    L2TemplateAddresses
+} from "contracts/tokenbridge/ethereum/L1TokenBridgeRetryableSender.sol";
+import {
+    IL1ImmutableGatewayDeployer,
+    L1ImmutableERC20GatewayDeployer,
+    L1ImmutableOrbitERC20GatewayDeployer
+} from "contracts/tokenbridge/ethereum/L1ImmutableGatewayDeployer.sol";
 import {TestUtil} from "./util/TestUtil.sol";
 import {AddressAliasHelper} from "contracts/tokenbridge/libraries/AddressAliasHelper.sol";
 import {L1GatewayRouter} from "contracts/tokenbridge/ethereum/gateway/L1GatewayRouter.sol";
@@ -197,7 +204,7 @@ contract L1AtomicTokenBridgeCreatorTest is Test {
         assertEq(l1StandardGateway.inbox(), address(inbox), "Wrong l1StandardGateway inbox");
         assertEq(
             l1StandardGateway.cloneableProxyHash(),
-            keccak256(type(ClonableBeaconProxy).creationCode),
+            keccak256(type(MinimalBeaconProxy).creationCode),
             "Wrong l1StandardGateway cloneableProxyHash"
         );
 
@@ -209,7 +216,7 @@ contract L1AtomicTokenBridgeCreatorTest is Test {
                     AddressAliasHelper.applyL1ToL2Alias(address(l1Creator.retryableSender()))
                 )
             ),
-            keccak256(type(BeaconProxyFactory).creationCode),
+            keccak256(type(MinimalBeaconProxyFactory).creationCode),
             l1Creator.canonicalL2FactoryAddress()
         );
         assertEq(
@@ -219,6 +226,45 @@ contract L1AtomicTokenBridgeCreatorTest is Test {
         );
     }
 
+    function test_createTokenBridge_checkL1StandardGateway_GatewayDeployer() public {
+        // prepare
+        _setTemplates();
+        vm.prank(deployer);
+        l1Creator.setGatewayDeployers(
+            new L1ImmutableERC20GatewayDeployer(), IL1ImmutableGatewayDeployer(address(0))
+        );
+        (RollupProxy rollup, Inbox inbox,, UpgradeExecutor upgExecutor) = _createRollup();
+        _createTokenBridge(rollup, inbox, upgExecutor);
+
+        /// check state
+        (address l1RouterAddress, address l1StandardGatewayAddress,,,) =
+            l1Creator.inboxToL1Deployment(address(inbox));
+        (, L1ERC20Gateway standardGatewayTemplate,,,,,,) = l1Creator.l1Templates();
+
+        address logic = address(
+            uint160(
+                uint256(
+                    vm.load(
+                        l1StandardGatewayAddress,
+                        0x360894a13ba1a3210667c828492db98dca3e2076cc3735a920a3ca505d382bbc
+                    )
+                )
+            )
+        );
+        assertTrue(logic != address(standardGatewayTemplate), "Template used as logic");
+        assertTrue(logic.code.length > 0, "Wrong logic code");
+
+        L1ERC20Gateway l1StandardGateway = L1ERC20Gateway(l1StandardGatewayAddress);
+        (, address l2StandardGateway,,,,,,,) = l1Creator.inboxToL2Deployment(address(inbox));
+        assertEq(
+            l1StandardGateway.counterpartGateway(),
+            l2StandardGateway,
+            "Wrong l1StandardGateway counterpartGateway"
+        );
+        assertEq(l1StandardGateway.router(), l1RouterAddress, "Wrong l1StandardGateway router");
+        assertEq(l1StandardGateway.inbox(), address(inbox), "Wrong l1StandardGateway inbox");
+    }
+
     function test_createTokenBridge_checkL1CustomGateway() public {
         // prepare
         _setTemplates();
@@ -893,6 +939,151 @@ contract L1AtomicTokenBridgeCreatorTest is Test {
         );
     }
 
+    function test_setGatewayDeployers() public {
+        IL1ImmutableGatewayDeployer standardDeployer = new L1ImmutableERC20GatewayDeployer();
+        IL1ImmutableGatewayDeployer feeTokenBasedDeployer =
+            new L1ImmutableOrbitERC20GatewayDeployer();
+
+        vm.expectEmit(true, true, true, true);
+        emit OrbitTokenBridgeGatewayDeployersUpdated();
+
+        vm.prank(deployer);
+        l1Creator.setGatewayDeployers(standardDeployer, feeTokenBasedDeployer);
+
+        assertEq(
+            address(l1Creator.standardGatewayDeployer()),
+            address(standardDeployer),
+            "Wrong standardGatewayDeployer"
+        );
+        assertEq(
+            address(l1Creator.feeTokenBasedStandardGatewayDeployer()),
+            address(feeTokenBasedDeployer),
+            "Wrong feeTokenBasedStandardGatewayDeployer"
+        );
+    }
+
+    function test_setGatewayDeployers_revert_OnlyOwner() public {
+        IL1ImmutableGatewayDeployer standardDeployer = new L1ImmutableERC20GatewayDeployer();
+
+        vm.expectRevert("Ownable: caller is not the owner");
+        l1Creator.setGatewayDeployers(standardDeployer, IL1ImmutableGatewayDeployer(address(0)));
+    }
+
+    function test_createTokenBridge_L2DeployedTemplates() public {
+        // prepare
+        _setTemplates();
+        _setL2DeployedTemplates();
+        (RollupProxy rollup, Inbox inbox,, UpgradeExecutor upgExecutor) = _createRollup();
+        l1Creator.setUseL2DeployedTemplates(address(inbox), true);
+
+        // templates are referenced instead of sending their code
+        vm.expectCall(
+            address(l1Creator.retryableSender()),
+            abi.encodeWithSelector(
+                L1TokenBridgeRetryableSender.sendRetryableUsingL2Templates.selector
+            )
+        );
+        _createTokenBridge(rollup, inbox, upgExecutor);
+
+        (address l1Router,,,,) = l1Creator.inboxToL1Deployment(address(inbox));
+        assertTrue(l1Router != address(0), "L1 side not deployed");
+    }
+
+    function test_setL2DeployedTemplates() public {
+        L2TemplateAddresses memory l2Templates = _getL2DeployedTemplateAddresses();
+
+        vm.expectEmit(true, true, true, true);
+        emit OrbitTokenBridgeL2DeployedTemplatesUpdated();
+
+        vm.prank(deployer);
+        l1Creator.setL2DeployedTemplates(l2Templates);
+
+        (
+            address routerTemplate,
+            address standardGatewayTemplate,
+            address customGatewayTemplate,
+            address wethGatewayTemplate,
+            address wethTemplate,
+            address upgradeExecutorTemplate,
+            address multicallTemplate
+        ) = l1Creator.l2DeployedTemplates();
+        assertEq(routerTemplate, l2Templates.routerTemplate, "Wrong routerTemplate");
+        assertEq(
+            standardGatewayTemplate,
+            l2Templates.standardGatewayTemplate,
+            "Wrong standardGatewayTemplate"
+        );
+        assertEq(
+            customGatewayTemplate, l2Templates.customGatewayTemplate, "Wrong customGatewayTemplate"
+        );
+        assertEq(wethGatewayTemplate, l2Templates.wethGatewayTemplate, "Wrong wethGatewayTemplate");
+        assertEq(wethTemplate, l2Templates.wethTemplate, "Wrong wethTemplate");
+        assertEq(
+            upgradeExecutorTemplate,
+            l2Templates.upgradeExecutorTemplate,
+            "Wrong upgradeExecutorTemplate"
+        );
+        assertEq(multicallTemplate, l2Templates.multicallTemplate, "Wrong multicallTemplate");
+    }
+
+    function test_setL2DeployedTemplates_revert_OnlyOwner() public {
+        L2TemplateAddresses memory l2Templates = _getL2DeployedTemplateAddresses();
+
+        vm.expectRevert("Ownable: caller is not the owner");
+        l1Creator.setL2DeployedTemplates(l2Templates);
+    }
+
+    function test_setUseL2DeployedTemplates() public {
+        _setL2DeployedTemplates();
+        (RollupProxy rollup, Inbox inbox,, UpgradeExecutor upgExecutor) = _createRollup();
+
+        // mock owner() => upgExecutor
+        vm.mockCall(
+            address(rollup), abi.encodeWithSignature("owner()"), abi.encode(address(upgExecutor))
+        );
+
+        vm.expectEmit(true, true, true, true);
+        emit OrbitTokenBridgeL2DeployedTemplatesUsed(address(inbox), true);
+
+        vm.prank(address(upgExecutor));
+        l1Creator.setUseL2DeployedTemplates(address(inbox), true);
+        assertTrue(l1Creator.inboxToUseL2DeployedTemplates(address(inbox)), "Not enabled");
+
+        vm.prank(address(upgExecutor));
+        l1Creator.setUseL2DeployedTemplates(address(inbox), false);
+        assertFalse(l1Creator.inboxToUseL2DeployedTemplates(address(inbox)), "Not disabled");
+    }
+
+    function test_setUseL2DeployedTemplates_revert_OnlyRollupOwner() public {
+        _setL2DeployedTemplates();
+        (RollupProxy rollup, Inbox inbox,, UpgradeExecutor upgExecutor) = _createRollup();
+
+        // mock owner() => upgExecutor
+        vm.mockCall(
+            address(rollup), abi.encodeWithSignature("owner()"), abi.encode(address(upgExecutor))
+        );
+
+        vm.expectRevert(
+            abi.encodeWithSelector(
+                L1AtomicTokenBridgeCreator.L1AtomicTokenBridgeCreator_OnlyRollupOwner.selector
+            )
+        );
+        l1Creator.setUseL2DeployedTemplates(address(inbox), true);
+    }
+
+    function test_setUseL2DeployedTemplates_revert_L2DeployedTemplatesNotSet() public {
+        (, Inbox inbox,,) = _createRollup();
+
+        vm.expectRevert(
+            abi.encodeWithSelector(
+                L1AtomicTokenBridgeCreator
+                    .L1AtomicTokenBridgeCreator_L2DeployedTemplatesNotSet
+                    .selector
+            )
+        );
+        l1Creator.setUseL2DeployedTemplates(address(inbox), true);
+    }
+
     function _createRollup()
         internal
         returns (RollupProxy rollup, Inbox inbox, ProxyAdmin pa, UpgradeExecutor upgExecutor)
@@ -1006,6 +1197,23 @@ contract L1AtomicTokenBridgeCreatorTest is Test {
         );
     }
 
+    function _setL2DeployedTemplates() internal {
+        vm.prank(deployer);
+        l1Creator.setL2DeployedTemplates(_getL2DeployedTemplateAddresses());
+    }
+
+    function _getL2DeployedTemplateAddresses() internal returns (L2TemplateAddresses memory) {
+        return L2TemplateAddresses(
+            makeAddr("l2DeployedRouterTemplate"),
+            makeAddr("l2DeployedStandardGatewayTemplate"),
+            makeAddr("l2DeployedCustomGatewayTemplate"),
+            makeAddr("l2DeployedWethGatewayTemplate"),
+            makeAddr("l2DeployedWethTemplate"),
+            makeAddr("l2DeployedUpgradeExecutorTemplate"),
+            makeAddr("l2DeployedMulticallTemplate")
+        );
+    }
+
     ////
     // Event declarations
     ////
@@ -1018,6 +1226,11 @@ contract L1AtomicTokenBridgeCreatorTest is Test {
         address upgradeExecutor
     );
     event OrbitTokenBridgeTemplatesUpdated();
+    event OrbitTokenBridgeGatewayDeployersUpdated();
+    event OrbitTokenBridgeL2DeployedTemplatesUpdated();
+    event OrbitTokenBridgeL2DeployedTemplatesUsed(
+        address indexed inbox, bool useL2DeployedTemplates
+    );
     event OrbitTokenBridgeDeploymentSet(
         address indexed inbox, L1DeploymentAddresses l1, L2DeploymentAddresses l2
     );
@@ -18,6 +18,7 @@ import {InboxMock} from "contracts/tokenbridge/test/InboxMock.sol";
 contract L1CustomGatewayTest is L1ArbitrumExtendedGatewayTest {
     // gateway params
     address public owner = makeAddr("owner");
+    uint256 public registrationDeadline = block.timestamp + 1 days;
 
     function setUp() public virtual {
         inbox = address(new InboxMock());
@@ -530,6 +531,182 @@ contract L1CustomGatewayTest is L1ArbitrumExtendedGatewayTest {
         );
     }
 
+    function test_registerTokensToL2() public virtual {
+        (address[] memory l1Tokens, address[] memory l2Tokens) = _deploySigningTokens();
+        vm.deal(user, 100 ether);
+
+        // expect events
+        vm.expectEmit(true, true, true, true);
+        emit TokenSet(l1Tokens[0], l2Tokens[0]);
+
+        vm.expectEmit(true, true, true, true);
+        emit TokenSet(l1Tokens[1], l2Tokens[1]);
+
+        vm.expectEmit(true, true, true, true);
+        emit TicketData(maxSubmissionCost);
+
+        vm.expectEmit(true, true, true, true);
+        emit RefundAddresses(user, user);
+
+        vm.expectEmit(true, true, true, true);
+        emit InboxRetryableTicket(
+            address(l1Gateway),
+            l2Gateway,
+            0,
+            maxGas,
+            abi.encodeWithSelector(L2CustomGateway.registerTokenFromL1.selector, l1Tokens, l2Tokens)
+        );
+
+        // register tokens to gateway, anyone can send the signed pairs
+        vm.prank(user);
+        uint256 seqNum = L1CustomGateway(address(l1Gateway)).registerTokensToL2{
+            value: retryableCost
+        }(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+
+        ///// checks
+        assertEq(
+            L1CustomGateway(address(l1Gateway)).l1ToL2Token(l1Tokens[0]),
+            l2Tokens[0],
+            "Invalid L2 token"
+        );
+        assertEq(
+            L1CustomGateway(address(l1Gateway)).l1ToL2Token(l1Tokens[1]),
+            l2Tokens[1],
+            "Invalid L2 token"
+        );
+        assertEq(seqNum, 0, "Invalid seqNum");
+    }
+
+    function test_registerTokensToL2_revert_InvalidSignature() public virtual {
+        (address[] memory l1Tokens, address[] memory l2Tokens) = _deploySigningTokens();
+        // the token only signed its pair with the first L2 address
+        l2Tokens[1] = makeAddr("otherL2Token");
+
+        vm.prank(owner);
+        vm.expectRevert("INVALID_SIGNATURE");
+        L1CustomGateway(address(l1Gateway)).registerTokensToL2{value: retryableCost}(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+    }
+
+    function test_registerTokensToL2_revert_NotSignedByToken() public virtual {
+        (address[] memory l1Tokens, address[] memory l2Tokens) = _deploySigningTokens();
+        l1Tokens[1] = makeAddr("eoaToken");
+
+        vm.prank(owner);
+        vm.expectRevert("INVALID_SIGNATURE");
+        L1CustomGateway(address(l1Gateway)).registerTokensToL2{value: retryableCost}(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+    }
+
+    function test_registerTokensToL2_revert_NoUpdateToDifferentAddress() public virtual {
+        (address[] memory l1Tokens, address[] memory l2Tokens) = _deploySigningTokens();
+
+        // set initial address
+        address[] memory initialL2Tokens = new address[](1);
+        initialL2Tokens[0] = makeAddr("initial");
+        vm.prank(owner);
+        L1CustomGateway(address(l1Gateway)).forceRegisterTokenToL2{value: retryableCost}(
+            _single(l1Tokens[0]), initialL2Tokens, maxGas, gasPriceBid, maxSubmissionCost
+        );
+
+        // try to set different one
+        vm.prank(owner);
+        vm.expectRevert("NO_UPDATE_TO_DIFFERENT_ADDR");
+        L1CustomGateway(address(l1Gateway)).registerTokensToL2{value: retryableCost}(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+    }
+
+    function test_registerTokensToL2_revert_InvalidLength() public virtual {
+        vm.prank(owner);
+        vm.expectRevert("INVALID_LENGTHS");
+        L1CustomGateway(address(l1Gateway)).registerTokensToL2{value: retryableCost}(
+            new address[](2),
+            new address[](2),
+            new bytes[](1),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+    }
+
+    function test_registerTokensToL2_revert_SignatureReplayed() public virtual {
+        (address[] memory l1Tokens, address[] memory l2Tokens) = _deploySigningTokens();
+
+        vm.prank(owner);
+        L1CustomGateway(address(l1Gateway)).registerTokensToL2{value: retryableCost}(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+        assertEq(
+            L1CustomGateway(address(l1Gateway)).registrationNonce(l1Tokens[0]), 1, "Invalid nonce"
+        );
+
+        // the nonce is part of the signed hash, so the same signatures can't be sent again
+        vm.prank(owner);
+        vm.expectRevert("INVALID_SIGNATURE");
+        L1CustomGateway(address(l1Gateway)).registerTokensToL2{value: retryableCost}(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+    }
+
+    function test_registerTokensToL2_revert_ExpiredSignature() public virtual {
+        (address[] memory l1Tokens, address[] memory l2Tokens) = _deploySigningTokens();
+        vm.warp(registrationDeadline + 1);
+
+        vm.prank(owner);
+        vm.expectRevert("EXPIRED_SIGNATURE");
+        L1CustomGateway(address(l1Gateway)).registerTokensToL2{value: retryableCost}(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+    }
+
     function test_setOwner(address newOwner) public {
         vm.assume(newOwner != address(0));
 
@@ -555,6 +732,33 @@ contract L1CustomGatewayTest is L1ArbitrumExtendedGatewayTest {
         L1CustomGateway(address(l1Gateway)).setOwner(address(300));
     }
 
+    ////
+    // Helper functions
+    ////
+    function _deploySigningTokens()
+        internal
+        returns (address[] memory l1Tokens, address[] memory l2Tokens)
+    {
+        l1Tokens = new address[](2);
+        l2Tokens = new address[](2);
+        l2Tokens[0] = makeAddr("l2Token1");
+        l2Tokens[1] = makeAddr("l2Token2");
+        for (uint256 i = 0; i < 2; i++) {
+            ERC1271Token l1Token = new ERC1271Token();
+            l1Tokens[i] = address(l1Token);
+            l1Token.approveHash(
+                L1CustomGateway(address(l1Gateway)).getRegistrationHash(
+                    l1Tokens[i], l2Tokens[i], registrationDeadline
+                )
+            );
+        }
+    }
+
+    function _single(address addr) internal pure returns (address[] memory arr) {
+        arr = new address[](1);
+        arr[0] = addr;
+    }
+
     ////
     // Event declarations
     ////
@@ -571,3 +775,18 @@ contract L1CustomGatewayTest is L1ArbitrumExtendedGatewayTest {
     event RefundAddresses(address excessFeeRefundAddress, address callValueRefundAddress);
     event InboxRetryableTicket(address from, address to, uint256 value, uint256 maxGas, bytes data);
 }
+
+/**
+ * @dev token authorizing its registrations through ERC-1271, the signature bytes are ignored
+ */
+contract ERC1271Token {
+    mapping(bytes32 => bool) public approvedHashes;
+
+    function approveHash(bytes32 hash) external {
+        approvedHashes[hash] = true;
+    }
+
+    function isValidSignature(bytes32 hash, bytes memory) external view returns (bytes4) {
+        return approvedHashes[hash] ? this.isValidSignature.selector : bytes4(0);
+    }
+}
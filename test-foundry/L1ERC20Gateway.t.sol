@@ -182,6 +182,174 @@ contract L1ERC20GatewayTest is L1ArbitrumExtendedGatewayTest {
         );
     }
 
+    function test_outboundTransferCustomRefund_DepositMessageSent() public virtual {
+        uint256 depositAmount = 450;
+        vm.prank(user);
+        token.approve(address(l1Gateway), depositAmount);
+
+        // the message hash is the one the L2 gateway emits when the retryable is executed
+        bytes memory l2Calldata =
+            l1Gateway.getOutboundCalldata(address(token), user, user, depositAmount, "");
+        vm.expectEmit(true, true, true, true);
+        emit DepositMessageSent(
+            address(token),
+            0,
+            keccak256(l2Calldata),
+            l1Gateway.calculateL2TokenAddress(address(token))
+        );
+
+        vm.prank(router);
+        l1Gateway.outboundTransferCustomRefund{value: retryableCost}(
+            address(token),
+            address(2000),
+            user,
+            depositAmount,
+            maxGas,
+            gasPriceBid,
+            buildRouterEncodedData("")
+        );
+    }
+
+    function test_outboundTransferCustomRefund_DepositHook() public virtual {
+        uint256 depositAmount = 450;
+        vm.prank(user);
+        token.approve(address(l1Gateway), depositAmount);
+
+        // the hook is sent to the L2 gateway as call hook data
+        bytes memory callHookData = abi.encodePacked(bytes1(0x02), uint256(200_000), "hook");
+        bytes memory l2Calldata =
+            l1Gateway.getOutboundCalldata(address(token), user, user, depositAmount, callHookData);
+        vm.expectEmit(true, true, true, true);
+        emit DepositMessageSent(
+            address(token),
+            0,
+            keccak256(l2Calldata),
+            l1Gateway.calculateL2TokenAddress(address(token))
+        );
+
+        vm.prank(router);
+        l1Gateway.outboundTransferCustomRefund{value: retryableCost}(
+            address(token),
+            address(2000),
+            user,
+            depositAmount,
+            maxGas,
+            gasPriceBid,
+            buildRouterEncodedData(callHookData)
+        );
+    }
+
+    function test_outboundTransferCustomRefund_Packed() public virtual {
+        _setPackedL2MsgEnabled(true);
+
+        // retryable params
+        uint256 depositAmount = 450;
+        address refundTo = address(2000);
+
+        // approve token
+        vm.prank(user);
+        token.approve(address(l1Gateway), depositAmount);
+
+        // the message to L2 uses the packed encoding as well
+        vm.expectEmit(true, true, true, true);
+        emit TxToL2(
+            user,
+            l2Gateway,
+            0,
+            L1ERC20Gateway(address(l1Gateway)).getOutboundCalldataPacked(
+                address(token), user, user, depositAmount, ""
+            )
+        );
+
+        vm.expectEmit(true, true, true, true);
+        emit DepositInitiated(address(token), user, user, 0, depositAmount);
+
+        // trigger deposit
+        vm.prank(router);
+        l1Gateway.outboundTransferCustomRefund{value: retryableCost}(
+            address(token),
+            refundTo,
+            user,
+            depositAmount,
+            maxGas,
+            gasPriceBid,
+            buildPackedRouterEncodedData()
+        );
+
+        assertEq(token.balanceOf(address(l1Gateway)), 100 + depositAmount, "Wrong l1 gateway balance");
+    }
+
+    function test_outboundTransferCustomRefund_Packed_L2MsgDisabled() public virtual {
+        uint256 depositAmount = 450;
+        vm.prank(user);
+        token.approve(address(l1Gateway), depositAmount);
+
+        // the L2 counterpart isn't known to parse packed messages yet, so the user's packed data
+        // is accepted but the L2 gets the abi encoded message
+        vm.expectEmit(true, true, true, true);
+        emit TxToL2(
+            user,
+            l2Gateway,
+            0,
+            l1Gateway.getOutboundCalldata(address(token), user, user, depositAmount, "")
+        );
+
+        vm.prank(router);
+        l1Gateway.outboundTransferCustomRefund{value: retryableCost}(
+            address(token),
+            address(2000),
+            user,
+            depositAmount,
+            maxGas,
+            gasPriceBid,
+            buildPackedRouterEncodedData()
+        );
+    }
+
+    function test_outboundTransferCustomRefund_AppendedSender() public virtual {
+        _setPackedL2MsgEnabled(true);
+
+        uint256 depositAmount = 450;
+        address refundTo = address(2000);
+
+        // approve token
+        vm.prank(user);
+        token.approve(address(l1Gateway), depositAmount);
+
+        vm.expectEmit(true, true, true, true);
+        emit TxToL2(
+            user,
+            l2Gateway,
+            0,
+            L1ERC20Gateway(address(l1Gateway)).getOutboundCalldataPacked(
+                address(token), user, user, depositAmount, ""
+            )
+        );
+        vm.expectEmit(true, true, true, true);
+        emit DepositInitiated(address(token), user, user, 0, depositAmount);
+
+        // trigger deposit, router forwards the user data and appends the sender
+        vm.prank(router);
+        (bool success, bytes memory returnData) = address(l1Gateway).call{value: retryableCost}(
+            abi.encodePacked(
+                abi.encodeWithSelector(
+                    l1Gateway.outboundTransferCustomRefund.selector,
+                    address(token),
+                    refundTo,
+                    user,
+                    depositAmount,
+                    maxGas,
+                    gasPriceBid,
+                    buildPackedUserEncodedData()
+                ),
+                user
+            )
+        );
+        assertTrue(success, "Deposit failed");
+        assertEq(abi.decode(returnData, (bytes)), abi.encode(0), "Invalid seqNum");
+        assertEq(token.balanceOf(address(l1Gateway)), 100 + depositAmount, "Wrong l1 gateway balance");
+    }
+
     function test_outboundTransferCustomRefund_revert_InsufficientAllowance() public {
         uint256 tooManyTokens = 500 ether;
 
@@ -221,6 +389,420 @@ contract L1ERC20GatewayTest is L1ArbitrumExtendedGatewayTest {
         );
     }
 
+    function test_outboundTransferBatchCustomRefund() public virtual {
+        // second token, user already holds the default one
+        IERC20 token2 = IERC20(address(new TestERC20()));
+        vm.prank(user);
+        TestERC20(address(token2)).mint();
+
+        // snapshot state before
+        uint256 userBalanceBefore = token.balanceOf(user);
+        uint256 userBalance2Before = token2.balanceOf(user);
+
+        // batch params
+        address[] memory tokens = new address[](2);
+        tokens[0] = address(token);
+        tokens[1] = address(token2);
+        address[] memory to = new address[](2);
+        to[0] = user;
+        to[1] = address(800);
+        uint256[] memory amounts = new uint256[](2);
+        amounts[0] = 450;
+        amounts[1] = 120;
+        address refundTo = address(2000);
+
+        // approve tokens
+        vm.startPrank(user);
+        token.approve(address(l1Gateway), amounts[0]);
+        token2.approve(address(l1Gateway), amounts[1]);
+        vm.stopPrank();
+
+        // a single retryable carries the whole batch
+        vm.expectEmit(true, true, true, true);
+        emit TicketData(maxSubmissionCost);
+
+        vm.expectEmit(true, true, true, true);
+        emit RefundAddresses(refundTo, user);
+
+        vm.expectEmit(true, true, true, true);
+        emit InboxRetryableTicket(
+            address(l1Gateway),
+            l2Gateway,
+            0,
+            maxGas,
+            L1ERC20Gateway(address(l1Gateway)).getOutboundBatchCalldata(
+                tokens, user, to, amounts, ""
+            )
+        );
+
+        // per token events share the sequence number and the message hash
+        bytes32 messageHash = keccak256(
+            L1ERC20Gateway(address(l1Gateway)).getOutboundBatchCalldata(
+                tokens, user, to, amounts, ""
+            )
+        );
+        vm.expectEmit(true, true, true, true);
+        emit DepositInitiated(address(token), user, user, 0, amounts[0]);
+        vm.expectEmit(true, true, true, true);
+        emit DepositMessageSent(
+            address(token), 0, messageHash, l1Gateway.calculateL2TokenAddress(address(token))
+        );
+        vm.expectEmit(true, true, true, true);
+        emit DepositInitiated(address(token2), user, address(800), 0, amounts[1]);
+        vm.expectEmit(true, true, true, true);
+        emit DepositMessageSent(
+            address(token2), 0, messageHash, l1Gateway.calculateL2TokenAddress(address(token2))
+        );
+
+        // trigger deposit
+        vm.prank(router);
+        bytes memory seqNum = L1ERC20Gateway(address(l1Gateway)).outboundTransferBatchCustomRefund{
+            value: retryableCost
+        }(tokens, refundTo, to, amounts, maxGas, gasPriceBid, buildRouterEncodedData(""));
+
+        assertEq(seqNum, abi.encode(0), "Invalid seqNum");
+
+        // check tokens are escrowed
+        assertEq(userBalanceBefore - token.balanceOf(user), 450, "Wrong user balance");
+        assertEq(userBalance2Before - token2.balanceOf(user), 120, "Wrong user balance 2");
+        assertEq(token2.balanceOf(address(l1Gateway)), 120, "Wrong l1 gateway balance");
+    }
+
+    function test_outboundTransferBatchCustomRefund_revert_WrongLength() public {
+        vm.prank(router);
+        vm.expectRevert("WRONG_LENGTH");
+        L1ERC20Gateway(address(l1Gateway)).outboundTransferBatchCustomRefund(
+            new address[](2),
+            user,
+            new address[](1),
+            new uint256[](2),
+            maxGas,
+            gasPriceBid,
+            buildRouterEncodedData("")
+        );
+    }
+
+    function test_getOutboundBatchCalldata() public {
+        address[] memory tokens = new address[](1);
+        tokens[0] = address(token);
+        address[] memory to = new address[](1);
+        to[0] = address(800);
+        uint256[] memory amounts = new uint256[](1);
+        amounts[0] = 355;
+
+        bytes memory outboundCalldata = L1ERC20Gateway(address(l1Gateway))
+            .getOutboundBatchCalldata(tokens, user, to, amounts, abi.encode("doStuff()"));
+
+        bytes[] memory data = new bytes[](1);
+        data[0] = abi.encode(
+            abi.encode(abi.encode("IntArbTestToken"), abi.encode("IARB"), abi.encode(18)),
+            abi.encode("doStuff()")
+        );
+        bytes memory expectedCalldata = abi.encodeWithSelector(
+            IL2ArbitrumGateway.finalizeInboundTransferBatch.selector,
+            tokens,
+            user,
+            to,
+            amounts,
+            data
+        );
+
+        assertEq(outboundCalldata, expectedCalldata, "Invalid outboundBatchCalldata");
+    }
+
+    function test_confirmL2TokenDeployments() public {
+        address[] memory tokens = new address[](1);
+        tokens[0] = address(token);
+
+        InboxMock(address(inbox)).setL2ToL1Sender(l2Gateway);
+
+        vm.expectEmit(true, true, true, true);
+        emit L2TokenDeployed(address(token));
+
+        vm.prank(address(IInbox(l1Gateway.inbox()).bridge()));
+        L1ERC20Gateway(address(l1Gateway)).confirmL2TokenDeployments(tokens);
+
+        assertTrue(
+            L1ERC20Gateway(address(l1Gateway)).isL2TokenDeployed(address(token)),
+            "Token should be marked as deployed"
+        );
+
+        // deploy data is no longer included
+        bytes memory outboundCalldata = l1Gateway.getOutboundCalldata({
+            _token: address(token),
+            _from: user,
+            _to: address(800),
+            _amount: 355,
+            _data: ""
+        });
+        bytes memory expectedCalldata = abi.encodeWithSelector(
+            ITokenGateway.finalizeInboundTransfer.selector,
+            address(token),
+            user,
+            address(800),
+            355,
+            abi.encode(bytes(""), bytes(""))
+        );
+        assertEq(outboundCalldata, expectedCalldata, "Invalid outboundCalldata");
+    }
+
+    function test_confirmL2TokenDeployments_revert_NotFromBridge() public {
+        vm.expectRevert("NOT_FROM_BRIDGE");
+        L1ERC20Gateway(address(l1Gateway)).confirmL2TokenDeployments(new address[](1));
+    }
+
+    function test_confirmL2TokenDeployments_revert_OnlyCounterpartGateway() public {
+        InboxMock(address(inbox)).setL2ToL1Sender(makeAddr("notCounterpart"));
+
+        vm.prank(address(IInbox(l1Gateway.inbox()).bridge()));
+        vm.expectRevert("ONLY_COUNTERPART_GATEWAY");
+        L1ERC20Gateway(address(l1Gateway)).confirmL2TokenDeployments(new address[](1));
+    }
+
+    function test_finalizeWithdrawalBatch() public {
+        // fund gateway with tokens being withdrawn
+        vm.prank(address(l1Gateway));
+        TestERC20(address(token)).mint();
+
+        address from = address(3000);
+        address otherUser = makeAddr("otherUser");
+        address newDest = makeAddr("newDest");
+
+        // second exit is traded before the batch is executed
+        vm.prank(otherUser);
+        L1ERC20Gateway(address(l1Gateway)).transferExitAndCall(8, otherUser, newDest, "", "");
+
+        address[] memory fromArr = new address[](2);
+        fromArr[0] = from;
+        fromArr[1] = from;
+        address[] memory to = new address[](2);
+        to[0] = user;
+        to[1] = otherUser;
+        uint256[] memory amounts = new uint256[](2);
+        amounts[0] = 25;
+        amounts[1] = 40;
+        uint256[] memory exitNums = new uint256[](2);
+        exitNums[0] = 7;
+        exitNums[1] = 8;
+
+        uint256 userBalanceBefore = token.balanceOf(user);
+        uint256 l1GatewayBalanceBefore = token.balanceOf(address(l1Gateway));
+
+        InboxMock(address(inbox)).setL2ToL1Sender(l2Gateway);
+
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawalFinalized(address(token), from, user, 7, 25);
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawalFinalized(address(token), from, newDest, 8, 40);
+
+        vm.prank(address(IInbox(l1Gateway.inbox()).bridge()));
+        L1ERC20Gateway(address(l1Gateway)).finalizeWithdrawalBatch(
+            address(token), fromArr, to, amounts, exitNums
+        );
+
+        assertEq(token.balanceOf(user) - userBalanceBefore, 25, "Wrong user balance");
+        assertEq(token.balanceOf(newDest), 40, "Wrong redirected balance");
+        assertEq(token.balanceOf(otherUser), 0, "Wrong initial destination balance");
+        assertEq(
+            l1GatewayBalanceBefore - token.balanceOf(address(l1Gateway)),
+            65,
+            "Wrong l1 gateway balance"
+        );
+    }
+
+    function test_finalizeWithdrawalBatch_RedirectedInBatch() public {
+        // fund gateway with tokens being withdrawn
+        vm.prank(address(l1Gateway));
+        TestERC20(address(token)).mint();
+
+        address from = address(3000);
+        address desk = makeAddr("desk");
+
+        address[] memory fromArr = new address[](2);
+        fromArr[0] = from;
+        fromArr[1] = from;
+        address[] memory to = new address[](2);
+        to[0] = user;
+        to[1] = user;
+        uint256[] memory amounts = new uint256[](2);
+        amounts[0] = 25;
+        amounts[1] = 40;
+        uint256[] memory exitNums = new uint256[](2);
+        exitNums[0] = 7;
+        exitNums[1] = 8;
+
+        // both exits are sold in one call
+        vm.prank(user);
+        L1ERC20Gateway(address(l1Gateway)).transferExitAndCallBatch(exitNums, to, desk, "");
+
+        InboxMock(address(inbox)).setL2ToL1Sender(l2Gateway);
+
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawalFinalized(address(token), from, desk, 7, 25);
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawalFinalized(address(token), from, desk, 8, 40);
+
+        // and settled in one call
+        vm.prank(address(IInbox(l1Gateway.inbox()).bridge()));
+        L1ERC20Gateway(address(l1Gateway)).finalizeWithdrawalBatch(
+            address(token), fromArr, to, amounts, exitNums
+        );
+
+        assertEq(token.balanceOf(desk), 65, "Wrong desk balance");
+    }
+
+    function test_finalizeWithdrawalBatch_CreditsFailedTransfer() public {
+        BlacklistERC20 blacklistToken = new BlacklistERC20();
+        vm.prank(address(l1Gateway));
+        blacklistToken.mint();
+
+        address from = address(3000);
+        address blacklisted = makeAddr("blacklisted");
+        blacklistToken.setBlacklisted(blacklisted, true);
+
+        address[] memory fromArr = new address[](2);
+        fromArr[0] = from;
+        fromArr[1] = from;
+        address[] memory to = new address[](2);
+        to[0] = blacklisted;
+        to[1] = user;
+        uint256[] memory amounts = new uint256[](2);
+        amounts[0] = 25;
+        amounts[1] = 40;
+        uint256[] memory exitNums = new uint256[](2);
+        exitNums[0] = 7;
+        exitNums[1] = 8;
+
+        InboxMock(address(inbox)).setL2ToL1Sender(l2Gateway);
+
+        // the blacklisted withdrawal is credited, the other one is still paid out
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawalCredited(address(blacklistToken), from, blacklisted, 7, 25);
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawalFinalized(address(blacklistToken), from, user, 8, 40);
+
+        vm.prank(address(IInbox(l1Gateway.inbox()).bridge()));
+        L1ERC20Gateway(address(l1Gateway)).finalizeWithdrawalBatch(
+            address(blacklistToken), fromArr, to, amounts, exitNums
+        );
+
+        assertEq(blacklistToken.balanceOf(user), 40, "Wrong user balance");
+        assertEq(blacklistToken.balanceOf(blacklisted), 0, "Wrong blacklisted balance");
+        assertEq(
+            L1ERC20Gateway(address(l1Gateway)).claimableWithdrawal(
+                address(blacklistToken), blacklisted
+            ),
+            25,
+            "Wrong claimable amount"
+        );
+
+        // credit is pulled to another account
+        address newDest = makeAddr("newDest");
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawalClaimed(address(blacklistToken), blacklisted, newDest, 25);
+        vm.prank(blacklisted);
+        L1ERC20Gateway(address(l1Gateway)).claimWithdrawal(address(blacklistToken), newDest);
+
+        assertEq(blacklistToken.balanceOf(newDest), 25, "Wrong claimed balance");
+        assertEq(
+            L1ERC20Gateway(address(l1Gateway)).claimableWithdrawal(
+                address(blacklistToken), blacklisted
+            ),
+            0,
+            "Wrong claimable amount after claim"
+        );
+    }
+
+    function test_finalizeWithdrawalBatch_CreditsTransferOutOfGas() public {
+        GasBurnerERC20 gasBurnerToken = new GasBurnerERC20();
+        vm.prank(address(l1Gateway));
+        gasBurnerToken.mint();
+
+        address[] memory fromArr = new address[](1);
+        fromArr[0] = address(3000);
+        address[] memory to = new address[](1);
+        to[0] = user;
+        uint256[] memory amounts = new uint256[](1);
+        amounts[0] = 25;
+        uint256[] memory exitNums = new uint256[](1);
+        exitNums[0] = 7;
+
+        InboxMock(address(inbox)).setL2ToL1Sender(l2Gateway);
+
+        // the transfer used all of its gas, but the batch had enough, so it is credited
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawalCredited(address(gasBurnerToken), address(3000), user, 7, 25);
+
+        vm.prank(address(IInbox(l1Gateway.inbox()).bridge()));
+        L1ERC20Gateway(address(l1Gateway)).finalizeWithdrawalBatch(
+            address(gasBurnerToken), fromArr, to, amounts, exitNums
+        );
+
+        assertEq(
+            L1ERC20Gateway(address(l1Gateway)).claimableWithdrawal(address(gasBurnerToken), user),
+            25,
+            "Wrong claimable amount"
+        );
+    }
+
+    function test_finalizeWithdrawalBatch_revert_InsufficientGas() public {
+        GasBurnerERC20 gasBurnerToken = new GasBurnerERC20();
+        vm.prank(address(l1Gateway));
+        gasBurnerToken.mint();
+
+        address[] memory fromArr = new address[](1);
+        fromArr[0] = address(3000);
+        address[] memory to = new address[](1);
+        to[0] = user;
+        uint256[] memory amounts = new uint256[](1);
+        amounts[0] = 25;
+        uint256[] memory exitNums = new uint256[](1);
+        exitNums[0] = 7;
+
+        InboxMock(address(inbox)).setL2ToL1Sender(l2Gateway);
+
+        // executed with less gas than a transfer gets, the withdrawal isn't credited
+        vm.prank(address(IInbox(l1Gateway.inbox()).bridge()));
+        vm.expectRevert("INSUFFICIENT_GAS");
+        L1ERC20Gateway(address(l1Gateway)).finalizeWithdrawalBatch{ gas: 100_000 }(
+            address(gasBurnerToken), fromArr, to, amounts, exitNums
+        );
+    }
+
+    function test_claimWithdrawal_revert_NothingToClaim() public {
+        vm.prank(user);
+        vm.expectRevert("NOTHING_TO_CLAIM");
+        L1ERC20Gateway(address(l1Gateway)).claimWithdrawal(address(token), user);
+    }
+
+    function test_inboundEscrowTransferFromBatch_revert_OnlySelf() public {
+        vm.prank(user);
+        vm.expectRevert("ONLY_SELF");
+        L1ERC20Gateway(address(l1Gateway)).inboundEscrowTransferFromBatch(
+            address(token), user, 1
+        );
+    }
+
+    function test_finalizeWithdrawalBatch_revert_WrongLength() public {
+        InboxMock(address(inbox)).setL2ToL1Sender(l2Gateway);
+
+        vm.prank(address(IInbox(l1Gateway.inbox()).bridge()));
+        vm.expectRevert("WRONG_LENGTH");
+        L1ERC20Gateway(address(l1Gateway)).finalizeWithdrawalBatch(
+            address(token), new address[](2), new address[](2), new uint256[](1), new uint256[](2)
+        );
+    }
+
+    function test_finalizeWithdrawalBatch_revert_OnlyCounterpartGateway() public {
+        InboxMock(address(inbox)).setL2ToL1Sender(makeAddr("notCounterpart"));
+
+        vm.prank(address(IInbox(l1Gateway.inbox()).bridge()));
+        vm.expectRevert("ONLY_COUNTERPART_GATEWAY");
+        L1ERC20Gateway(address(l1Gateway)).finalizeWithdrawalBatch(
+            address(token), new address[](1), new address[](1), new uint256[](1), new uint256[](1)
+        );
+    }
+
     function test_getOutboundCalldata() public override {
         bytes memory outboundCalldata = l1Gateway.getOutboundCalldata({
             _token: address(token),
@@ -257,6 +839,33 @@ contract L1ERC20GatewayTest is L1ArbitrumExtendedGatewayTest {
         assertEq(l2TokenAddress, expectedL2TokenAddress, "Invalid calculateL2TokenAddress");
     }
 
+    function test_calculateL2TokenAddresses(address[] memory tokenAddresses) public {
+        address[] memory l2TokenAddresses =
+            L1ERC20Gateway(address(l1Gateway)).calculateL2TokenAddresses(tokenAddresses);
+
+        assertEq(l2TokenAddresses.length, tokenAddresses.length, "Invalid length");
+        for (uint256 i = 0; i < tokenAddresses.length; i++) {
+            assertEq(
+                l2TokenAddresses[i],
+                l1Gateway.calculateL2TokenAddress(tokenAddresses[i]),
+                "Invalid calculateL2TokenAddresses"
+            );
+        }
+    }
+
+    ////
+    // Helper functions
+    ////
+    function buildPackedUserEncodedData() internal view virtual returns (bytes memory) {
+        return abi.encodePacked(GatewayMessageHandler.PACKED_MSG_VERSION, maxSubmissionCost);
+    }
+
+    function buildPackedRouterEncodedData() internal view returns (bytes memory) {
+        return abi.encodePacked(
+            GatewayMessageHandler.PACKED_MSG_VERSION, user, buildPackedUserEncodedData()
+        );
+    }
+
     ////
     // Event declarations
     ////
@@ -267,7 +876,55 @@ contract L1ERC20GatewayTest is L1ArbitrumExtendedGatewayTest {
         uint256 indexed _sequenceNumber,
         uint256 _amount
     );
+    event DepositMessageSent(
+        address indexed l1Token,
+        uint256 indexed _sequenceNumber,
+        bytes32 indexed _messageHash,
+        address _l2Token
+    );
+    event L2TokenDeployed(address indexed l1Token);
+    event WithdrawalFinalized(
+        address l1Token,
+        address indexed _from,
+        address indexed _to,
+        uint256 indexed _exitNum,
+        uint256 _amount
+    );
+    event WithdrawalCredited(
+        address l1Token,
+        address indexed _from,
+        address indexed _to,
+        uint256 indexed _exitNum,
+        uint256 _amount
+    );
+    event WithdrawalClaimed(
+        address indexed l1Token,
+        address indexed _account,
+        address indexed _to,
+        uint256 _amount
+    );
+    event TxToL2(address indexed _from, address indexed _to, uint256 indexed _seqNum, bytes _data);
     event TicketData(uint256 maxSubmissionCost);
     event RefundAddresses(address excessFeeRefundAddress, address callValueRefundAddress);
     event InboxRetryableTicket(address from, address to, uint256 value, uint256 maxGas, bytes data);
 }
+
+contract BlacklistERC20 is TestERC20 {
+    mapping(address => bool) public isBlacklisted;
+
+    function setBlacklisted(address account, bool blacklisted) external {
+        isBlacklisted[account] = blacklisted;
+    }
+
+    function transfer(address to, uint256 amount) public override returns (bool) {
+        require(!isBlacklisted[to], "BLACKLISTED");
+        return super.transfer(to, amount);
+    }
+}
+
+contract GasBurnerERC20 is TestERC20 {
+    function transfer(address, uint256) public pure override returns (bool) {
+        // runs out of whatever gas it gets
+        for (;;) {}
+    }
+}
@@ -310,4 +310,45 @@ contract L1ForceOnlyReverseCustomGatewayTest is L1ReverseCustomGatewayTest {
     function test_registerTokenToL2_revert_NotArbEnabled() public virtual override {
         0; // N/A
     }
+
+    function test_registerTokensToL2() public virtual override {
+        vm.expectRevert("REGISTER_TOKEN_ON_L2_DISABLED");
+        L1CustomGateway(address(l1Gateway)).registerTokensToL2{value: retryableCost}(
+            new address[](1),
+            new address[](1),
+            new bytes[](1),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+    }
+
+    function test_registerTokensToL2_revert_InvalidSignature() public virtual override {
+        0; // N/A
+    }
+
+    function test_registerTokensToL2_revert_NotSignedByToken() public virtual override {
+        0; // N/A
+    }
+
+    function test_registerTokensToL2_revert_NoUpdateToDifferentAddress()
+        public
+        virtual
+        override
+    {
+        0; // N/A
+    }
+
+    function test_registerTokensToL2_revert_InvalidLength() public virtual override {
+        0; // N/A
+    }
+
+    function test_registerTokensToL2_revert_SignatureReplayed() public virtual override {
+        0; // N/A
+    }
+
+    function test_registerTokensToL2_revert_ExpiredSignature() public virtual override {
+        0; // N/A
+    }
 }
@@ -3,13 +3,19 @@
 pragma solidity ^0.8.0;
 
 import { GatewayRouterTest } from "./GatewayRouter.t.sol";
+import { GatewayRouter } from "contracts/tokenbridge/libraries/gateway/GatewayRouter.sol";
 import { L1GatewayRouter } from "contracts/tokenbridge/ethereum/gateway/L1GatewayRouter.sol";
 import { L2GatewayRouter } from "contracts/tokenbridge/arbitrum/gateway/L2GatewayRouter.sol";
 import { L1ERC20Gateway } from "contracts/tokenbridge/ethereum/gateway/L1ERC20Gateway.sol";
 import { L1CustomGateway } from "contracts/tokenbridge/ethereum/gateway/L1CustomGateway.sol";
+import { L1WethGateway } from "contracts/tokenbridge/ethereum/gateway/L1WethGateway.sol";
+import { L1ArbitrumMessenger } from "contracts/tokenbridge/ethereum/L1ArbitrumMessenger.sol";
+import { GatewayMessageHandler } from "contracts/tokenbridge/libraries/gateway/GatewayMessageHandler.sol";
 import { InboxMock } from "contracts/tokenbridge/test/InboxMock.sol";
+import { TestWETH9 } from "contracts/tokenbridge/test/TestWETH9.sol";
 import { IERC165 } from "contracts/tokenbridge/libraries/IERC165.sol";
 import { ERC20 } from "@openzeppelin/contracts/token/ERC20/ERC20.sol";
+import { ERC20Permit } from "@openzeppelin/contracts/token/ERC20/extensions/draft-ERC20Permit.sol";
 import { ERC20PresetMinterPauser } from "@openzeppelin/contracts/token/ERC20/presets/ERC20PresetMinterPauser.sol";
 
 contract L1GatewayRouterTest is GatewayRouterTest {
@@ -110,6 +116,105 @@ contract L1GatewayRouterTest is GatewayRouterTest {
         assertEq(gateway, gateways[0], "Invalid gateway");
     }
 
+    function test_getGateway_CustomGateway_StoredAsContract() public virtual {
+        address token = makeAddr("some token");
+
+        address[] memory tokens = new address[](1);
+        tokens[0] = token;
+        address[] memory gateways = new address[](1);
+        gateways[0] = address(new L1ERC20Gateway());
+
+        vm.prank(owner);
+        l1Router.setGateways{ value: retryableCost }(
+            tokens,
+            gateways,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+
+        // l1TokenToGateway is at slot 3, the flag is kept above the gateway address
+        bytes32 entry = vm.load(address(l1Router), keccak256(abi.encode(token, uint256(3))));
+        assertEq(uint256(entry), uint256(uint160(gateways[0])) | (1 << 160), "Invalid entry");
+        assertEq(l1Router.l1TokenToGateway(token), gateways[0], "Invalid l1TokenToGateway");
+        assertEq(router.getGateway(token), gateways[0], "Invalid gateway");
+    }
+
+    function test_getGateways() public {
+        (address[] memory tokens, address[] memory registered) = _registerMixedGateways();
+
+        address[] memory gateways = router.getGateways(tokens);
+
+        assertEq(gateways.length, tokens.length, "Invalid length");
+        for (uint256 i = 0; i < tokens.length; i++) {
+            assertEq(gateways[i], router.getGateway(tokens[i]), "Invalid gateway");
+        }
+        assertEq(gateways[0], registered[0], "Invalid gateway A");
+        assertEq(gateways[1], registered[1], "Invalid gateway B");
+        assertEq(gateways[3], address(0), "Disabled token has gateway");
+        assertEq(gateways[4], defaultGateway, "Invalid default gateway");
+    }
+
+    function test_calculateL2TokenAddresses() public {
+        (address[] memory tokens, address[] memory registered) = _registerMixedGateways();
+
+        // the gateway is called once with all of its tokens, in their order
+        address[] memory gatewayATokens = new address[](2);
+        gatewayATokens[0] = tokens[0];
+        gatewayATokens[1] = tokens[2];
+        vm.expectCall(
+            registered[0],
+            abi.encodeWithSelector(
+                L1ERC20Gateway.calculateL2TokenAddresses.selector,
+                gatewayATokens
+            )
+        );
+        address[] memory l2Tokens = router.calculateL2TokenAddresses(tokens);
+
+        assertEq(l2Tokens.length, tokens.length, "Invalid length");
+        for (uint256 i = 0; i < tokens.length; i++) {
+            assertEq(
+                l2Tokens[i],
+                router.calculateL2TokenAddress(tokens[i]),
+                "Invalid L2 token address"
+            );
+        }
+        assertEq(l2Tokens[3], address(0), "Disabled token has L2 address");
+        assertEq(
+            l2Tokens[5],
+            LegacyGatewayMock(registered[5]).calculateL2TokenAddress(tokens[5]),
+            "Invalid legacy gateway L2 address"
+        );
+    }
+
+    function test_calculateL2TokenAddresses_Empty() public {
+        address[] memory l2Tokens = router.calculateL2TokenAddresses(new address[](0));
+        assertEq(l2Tokens.length, 0, "Invalid length");
+    }
+
+    function test_calculateL2TokenAddresses_UndecodableReturnData() public {
+        address[] memory tokens = new address[](2);
+        address[] memory gateways = new address[](2);
+        for (uint256 i = 0; i < 2; i++) {
+            tokens[i] = address(new ERC20("X", "Y"));
+            gateways[i] = address(new MalformedGatewayMock());
+        }
+        _approveChunkFees(1);
+        vm.prank(owner);
+        _setGatewaysInChunks(tokens, gateways, 0, 2, 2, 1);
+
+        // return data that isn't an address[] falls back to the single token view
+        address[] memory l2Tokens = router.calculateL2TokenAddresses(tokens);
+
+        for (uint256 i = 0; i < 2; i++) {
+            assertEq(
+                l2Tokens[i],
+                LegacyGatewayMock(gateways[i]).calculateL2TokenAddress(tokens[i]),
+                "Invalid L2 token address"
+            );
+        }
+    }
+
     function test_setDefaultGateway() public virtual {
         L1ERC20Gateway newL1DefaultGateway = new L1ERC20Gateway();
         address newDefaultGatewayCounterpart = makeAddr("newDefaultGatewayCounterpart");
@@ -639,6 +744,123 @@ contract L1GatewayRouterTest is GatewayRouterTest {
         l1Router.setGateways{ value: 1000 }(new address[](1), new address[](1), 100, 8, 10);
     }
 
+    function test_setGatewaysInChunks() public virtual {
+        (address[] memory tokens, address[] memory gateways) = _deployChunkedRegistration();
+
+        // expect one retryable for each chunk, the first two tokens share the same gateway
+        vm.expectEmit(true, true, true, true);
+        emit GatewaySet(tokens[0], gateways[0]);
+        vm.expectEmit(true, true, true, true);
+        emit GatewaySet(tokens[1], gateways[1]);
+        vm.expectEmit(true, true, true, true);
+        emit InboxRetryableTicket(
+            address(l1Router),
+            counterpartGateway,
+            0,
+            maxGas,
+            abi.encodeWithSelector(
+                L2GatewayRouter.setGateway.selector,
+                _slice(tokens, 0, 2),
+                _fill(makeAddr("l2GatewayA"), 2)
+            )
+        );
+        vm.expectEmit(true, true, true, true);
+        emit GatewaySet(tokens[2], gateways[2]);
+        vm.expectEmit(true, true, true, true);
+        emit InboxRetryableTicket(
+            address(l1Router),
+            counterpartGateway,
+            0,
+            maxGas,
+            abi.encodeWithSelector(
+                L2GatewayRouter.setGateway.selector,
+                _slice(tokens, 2, 3),
+                _fill(makeAddr("l2GatewayB"), 1)
+            )
+        );
+
+        /// set gateways
+        _approveChunkFees(2);
+        vm.prank(owner);
+        uint256[] memory seqNums = _setGatewaysInChunks(tokens, gateways, 0, 3, 2, 2);
+
+        ///// checks
+
+        assertEq(seqNums.length, 2, "Invalid seqNums length");
+        assertEq(seqNums[0], 0, "Invalid seqNum[0]");
+        assertEq(seqNums[1], 1, "Invalid seqNum[1]");
+        for (uint256 i = 0; i < 3; i++) {
+            assertEq(l1Router.l1TokenToGateway(tokens[i]), gateways[i], "Gateway not set");
+        }
+    }
+
+    function test_setGatewaysInChunks_Resume() public {
+        (address[] memory tokens, address[] memory gateways) = _deployChunkedRegistration();
+
+        /// register the first token, then resume from where the first call stopped
+        _approveChunkFees(3);
+        vm.prank(owner);
+        uint256[] memory seqNums = _setGatewaysInChunks(tokens, gateways, 0, 1, 5, 1);
+        assertEq(seqNums.length, 1, "Invalid first seqNums length");
+        assertEq(l1Router.l1TokenToGateway(tokens[1]), address(0), "Gateway[1] set too early");
+
+        vm.prank(owner);
+        seqNums = _setGatewaysInChunks(tokens, gateways, 1, 3, 1, 2);
+
+        ///// checks
+
+        assertEq(seqNums.length, 2, "Invalid second seqNums length");
+        assertEq(seqNums[1], 2, "Invalid seqNum");
+        for (uint256 i = 0; i < 3; i++) {
+            assertEq(l1Router.l1TokenToGateway(tokens[i]), gateways[i], "Gateway not set");
+        }
+    }
+
+    function test_setGatewaysInChunks_revert_WrongLength() public {
+        vm.prank(owner);
+        vm.expectRevert("WRONG_LENGTH");
+        _setGatewaysInChunks(new address[](2), new address[](1), 0, 1, 1, 1);
+    }
+
+    function test_setGatewaysInChunks_revert_InvalidEnd() public {
+        vm.prank(owner);
+        vm.expectRevert("INVALID_END");
+        _setGatewaysInChunks(new address[](2), new address[](2), 0, 3, 1, 3);
+    }
+
+    function test_setGatewaysInChunks_revert_InvalidChunkSize() public {
+        vm.prank(owner);
+        vm.expectRevert("INVALID_CHUNK_SIZE");
+        _setGatewaysInChunks(new address[](2), new address[](2), 0, 2, 0, 1);
+    }
+
+    function test_setGatewaysInChunks_revert_InvalidStart() public {
+        vm.prank(owner);
+        vm.expectRevert("INVALID_START");
+        _setGatewaysInChunks(new address[](2), new address[](2), 2, 2, 1, 1);
+    }
+
+    function test_setGatewaysInChunks_revert_WrongValue() public virtual {
+        (address[] memory tokens, address[] memory gateways) = _deployChunkedRegistration();
+
+        // fees only cover one of the two chunks
+        vm.prank(owner);
+        vm.expectRevert("WRONG_VALUE");
+        l1Router.setGatewaysInChunks{ value: retryableCost }(
+            tokens,
+            gateways,
+            0,
+            3,
+            2,
+            L1ArbitrumMessenger.L2GasParams(maxSubmissionCost, maxGas, gasPriceBid)
+        );
+    }
+
+    function test_setGatewaysInChunks_revert_NotOwner() public {
+        vm.expectRevert("ONLY_OWNER");
+        _setGatewaysInChunks(new address[](1), new address[](1), 0, 1, 1, 1);
+    }
+
     function test_setOwner(address newOwner) public {
         vm.assume(newOwner != address(0));
 
@@ -671,6 +893,9 @@ contract L1GatewayRouterTest is GatewayRouterTest {
         iface = L1GatewayRouter.outboundTransferCustomRefund.selector;
         assertEq(l1Router.supportsInterface(iface), true, "Interface should be supported");
 
+        iface = L1GatewayRouter.outboundTransferBatchCustomRefund.selector;
+        assertEq(l1Router.supportsInterface(iface), true, "Interface should be supported");
+
         iface = bytes4(0);
         assertEq(l1Router.supportsInterface(iface), false, "Interface shouldn't be supported");
 
@@ -802,6 +1027,526 @@ contract L1GatewayRouterTest is GatewayRouterTest {
         );
     }
 
+    function test_outboundTransferCustomRefund_AppendedSender() public virtual {
+        // init default gateway
+        L1ERC20Gateway(defaultGateway).initialize(
+            makeAddr("defaultGatewayCounterpart"),
+            address(l1Router),
+            inbox,
+            0x0000000000000000000000000000000000000000000000000000000000000001,
+            makeAddr("l2BeaconProxyFactory")
+        );
+
+        // set default gateway
+        vm.prank(owner);
+        l1Router.setDefaultGateway{ value: retryableCost }(
+            address(defaultGateway),
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+
+        // create token
+        ERC20PresetMinterPauser token = new ERC20PresetMinterPauser("X", "Y");
+        token.mint(user, 10000);
+        vm.prank(user);
+        token.approve(defaultGateway, 103);
+
+        /// deposit data, packed user data opts into the new convention
+        address refundTo = address(400);
+        address to = address(401);
+        uint256 amount = 103;
+        bytes memory userEncodedData = abi.encodePacked(
+            GatewayMessageHandler.PACKED_MSG_VERSION,
+            maxSubmissionCost
+        );
+
+        // sender is appended to the gateway call instead of being abi encoded with the data
+        vm.expectCall(
+            defaultGateway,
+            retryableCost,
+            abi.encodePacked(
+                abi.encodeWithSelector(
+                    L1ERC20Gateway.outboundTransferCustomRefund.selector,
+                    address(token),
+                    refundTo,
+                    to,
+                    amount,
+                    maxGas,
+                    gasPriceBid,
+                    userEncodedData
+                ),
+                user
+            )
+        );
+        vm.expectEmit(true, true, true, true);
+        emit TransferRouted(address(token), user, to, address(defaultGateway));
+        vm.expectEmit(true, true, true, true);
+        emit DepositInitiated(address(token), user, to, 1, amount);
+
+        /// deposit it
+        vm.prank(user);
+        bytes memory seqNum = l1Router.outboundTransferCustomRefund{ value: retryableCost }(
+            address(token),
+            refundTo,
+            to,
+            amount,
+            maxGas,
+            gasPriceBid,
+            userEncodedData
+        );
+
+        assertEq(seqNum, abi.encode(1), "Invalid seqNum");
+        assertEq(token.balanceOf(defaultGateway), amount, "Wrong defaultGateway balance");
+    }
+
+    function test_outboundTransferCustomRefundWithPermit() public virtual {
+        // init default gateway
+        L1ERC20Gateway(defaultGateway).initialize(
+            makeAddr("defaultGatewayCounterpart"),
+            address(l1Router),
+            inbox,
+            0x0000000000000000000000000000000000000000000000000000000000000001,
+            makeAddr("l2BeaconProxyFactory")
+        );
+
+        // set default gateway
+        vm.prank(owner);
+        l1Router.setDefaultGateway{ value: retryableCost }(
+            address(defaultGateway),
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+
+        // create token, permit user has no approval
+        (address permitUser, uint256 permitUserKey) = makeAddrAndKey("permitUser");
+        PermitToken token = new PermitToken(permitUser, 10000);
+        vm.deal(permitUser, 100 ether);
+
+        /// deposit data
+        address refundTo = address(400);
+        address to = address(401);
+        uint256 amount = 103;
+        bytes memory userEncodedData = abi.encode(maxSubmissionCost, "");
+        GatewayRouter.PermitData memory permitData = _signPermit(
+            address(token),
+            permitUserKey,
+            defaultGateway,
+            amount,
+            block.timestamp
+        );
+
+        // expect event
+        vm.expectEmit(true, true, true, true);
+        emit TransferRouted(address(token), permitUser, to, address(defaultGateway));
+
+        /// deposit it
+        vm.prank(permitUser);
+        l1Router.outboundTransferCustomRefundWithPermit{ value: retryableCost }(
+            address(token),
+            refundTo,
+            to,
+            amount,
+            maxGas,
+            gasPriceBid,
+            userEncodedData,
+            permitData
+        );
+
+        // check tokens are escrowed
+        assertEq(token.balanceOf(permitUser), 10000 - amount, "Wrong user balance");
+        assertEq(token.balanceOf(defaultGateway), amount, "Wrong defaultGateway balance");
+        assertEq(token.nonces(permitUser), 1, "Permit not used");
+        assertEq(token.allowance(permitUser, defaultGateway), 0, "Wrong allowance");
+    }
+
+    function test_outboundTransferCustomRefundWithPermit_revert_PermitFailed() public {
+        (address permitUser, uint256 permitUserKey) = makeAddrAndKey("permitUser");
+        PermitToken token = new PermitToken(permitUser, 10000);
+
+        // signed for another spender
+        GatewayRouter.PermitData memory permitData = _signPermit(
+            address(token),
+            permitUserKey,
+            makeAddr("spender"),
+            103,
+            block.timestamp
+        );
+
+        vm.prank(permitUser);
+        vm.expectRevert("PERMIT_FAILED");
+        l1Router.outboundTransferCustomRefundWithPermit(
+            address(token),
+            address(400),
+            address(401),
+            103,
+            maxGas,
+            gasPriceBid,
+            abi.encode(maxSubmissionCost, ""),
+            permitData
+        );
+    }
+
+    function test_outboundTransferETHCustomRefund() public virtual {
+        // WETH gateway sends retryables with ETH call value, so it gets its own inbox
+        address weth = address(new TestWETH9("weth", "weth"));
+        address wethInbox = address(new InboxMock());
+        L1WethGateway wethGateway = new L1WethGateway();
+        wethGateway.initialize(
+            makeAddr("l2WethGateway"),
+            address(l1Router),
+            wethInbox,
+            weth,
+            makeAddr("l2Weth")
+        );
+
+        address[] memory tokens = new address[](1);
+        tokens[0] = weth;
+        address[] memory gateways = new address[](1);
+        gateways[0] = address(wethGateway);
+        _approveChunkFees(1);
+        vm.prank(owner);
+        _setGatewaysInChunks(tokens, gateways, 0, 1, 1, 1);
+
+        /// deposit data
+        address refundTo = address(400);
+        address to = address(401);
+        uint256 amount = 2 ether;
+        uint256 wethRetryableCost = 20 + maxGas * gasPriceBid;
+        uint256 userBalanceBefore = user.balance;
+
+        // expect events
+        vm.expectEmit(true, true, true, true);
+        emit TransferRouted(weth, user, to, address(wethGateway));
+        vm.expectEmit(true, true, true, true);
+        emit InboxRetryableTicket(
+            address(wethGateway),
+            makeAddr("l2WethGateway"),
+            amount,
+            maxGas,
+            wethGateway.getOutboundCalldata(weth, user, to, amount, "")
+        );
+        vm.expectEmit(true, true, true, true);
+        emit DepositInitiated(weth, user, to, 0, amount);
+
+        /// deposit it
+        vm.prank(user);
+        l1Router.outboundTransferETHCustomRefund{ value: wethRetryableCost + amount }(
+            weth,
+            refundTo,
+            to,
+            amount,
+            maxGas,
+            gasPriceBid,
+            abi.encode(uint256(20), "")
+        );
+
+        assertEq(
+            userBalanceBefore - user.balance,
+            wethRetryableCost + amount,
+            "Wrong user balance"
+        );
+        assertEq(wethInbox.balance, wethRetryableCost + amount, "Wrong inbox balance");
+    }
+
+    function test_outboundTransferETHCustomRefund_revert_NotWethGateway() public {
+        address token = address(new ERC20("X", "Y"));
+
+        // default gateway doesn't accept ether deposits
+        vm.prank(user);
+        vm.expectRevert();
+        l1Router.outboundTransferETHCustomRefund{ value: 1 ether }(
+            token,
+            user,
+            user,
+            1 ether,
+            maxGas,
+            gasPriceBid,
+            abi.encode(maxSubmissionCost, "")
+        );
+    }
+
+    function test_quoteDeposit() public virtual {
+        address token = address(new ERC20("X", "Y"));
+        bytes memory callHookData = abi.encode("hook");
+        // the quote uses the given base fee, not the one of the block
+        vm.fee(5 gwei);
+
+        L1GatewayRouter.DepositQuote memory quote = l1Router.quoteDeposit(
+            token, user, user, 100, callHookData, maxGas, gasPriceBid, 2 gwei
+        );
+
+        uint256 expectedLength =
+            l1Router.getOutboundCalldata(token, user, user, 100, callHookData).length;
+        uint256 expectedSubmissionFee = (1400 + 6 * expectedLength) * 2 gwei;
+        assertEq(quote.gateway, defaultGateway, "Invalid gateway");
+        assertEq(quote.calldataLength, expectedLength, "Invalid calldata length");
+        assertEq(quote.submissionFee, expectedSubmissionFee, "Invalid submission fee");
+        assertEq(
+            quote.retryableValue,
+            expectedSubmissionFee + maxGas * gasPriceBid,
+            "Invalid retryable value"
+        );
+        assertEq(quote.tokenTotalFeeAmount, 0, "Invalid token fee amount");
+    }
+
+    function test_outboundTransferBatchCustomRefund() public virtual {
+        // init default gateway
+        L1ERC20Gateway(defaultGateway).initialize(
+            makeAddr("defaultGatewayCounterpart"),
+            address(l1Router),
+            inbox,
+            0x0000000000000000000000000000000000000000000000000000000000000001,
+            makeAddr("l2BeaconProxyFactory")
+        );
+
+        // set default gateway
+        vm.prank(owner);
+        l1Router.setDefaultGateway{ value: retryableCost }(
+            address(defaultGateway),
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+
+        // create tokens, the second one is registered to its own gateway
+        address[] memory tokens = new address[](3);
+        for (uint256 i = 0; i < 3; i++) {
+            ERC20PresetMinterPauser token = new ERC20PresetMinterPauser("X", "Y");
+            token.mint(user, 10000);
+            tokens[i] = address(token);
+        }
+
+        L1ERC20Gateway otherGateway = new L1ERC20Gateway();
+        otherGateway.initialize(
+            makeAddr("otherGatewayCounterpart"),
+            address(l1Router),
+            inbox,
+            0x0000000000000000000000000000000000000000000000000000000000000001,
+            makeAddr("l2BeaconProxyFactory")
+        );
+
+        vm.mockCall(
+            tokens[1], abi.encodeWithSignature("isArbitrumEnabled()"), abi.encode(uint8(0xb1))
+        );
+        vm.deal(tokens[1], 100 ether);
+        vm.prank(tokens[1]);
+        l1Router.setGateway{ value: retryableCost }(
+            address(otherGateway),
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+
+        /// deposit data
+        address refundTo = address(400);
+        address[] memory to = new address[](3);
+        to[0] = address(401);
+        to[1] = address(402);
+        to[2] = address(403);
+        uint256[] memory amounts = new uint256[](3);
+        amounts[0] = 103;
+        amounts[1] = 104;
+        amounts[2] = 105;
+
+        vm.startPrank(user);
+        ERC20(tokens[0]).approve(defaultGateway, amounts[0]);
+        ERC20(tokens[1]).approve(address(otherGateway), amounts[1]);
+        ERC20(tokens[2]).approve(defaultGateway, amounts[2]);
+        vm.stopPrank();
+
+        // one entry per gateway group, in order of first appearance
+        uint256[] memory maxGasPerGroup = new uint256[](2);
+        maxGasPerGroup[0] = maxGas;
+        maxGasPerGroup[1] = maxGas;
+        bytes[] memory userEncodedData = new bytes[](2);
+        userEncodedData[0] = abi.encode(maxSubmissionCost, "");
+        userEncodedData[1] = abi.encode(maxSubmissionCost, "");
+        uint256[] memory values = new uint256[](2);
+        values[0] = retryableCost;
+        values[1] = retryableCost;
+
+        // expect events
+        vm.expectEmit(true, true, true, true);
+        emit TransferRouted(tokens[0], user, to[0], address(defaultGateway));
+        vm.expectEmit(true, true, true, true);
+        emit TransferRouted(tokens[1], user, to[1], address(otherGateway));
+        vm.expectEmit(true, true, true, true);
+        emit TransferRouted(tokens[2], user, to[2], address(defaultGateway));
+
+        /// deposit it
+        vm.prank(user);
+        bytes[] memory res = l1Router.outboundTransferBatchCustomRefund{
+            value: 2 * retryableCost
+        }(tokens, refundTo, to, amounts, maxGasPerGroup, gasPriceBid, userEncodedData, values);
+
+        assertEq(res.length, 2, "Wrong number of retryables");
+
+        // check tokens are escrowed in their gateways
+        assertEq(ERC20(tokens[0]).balanceOf(defaultGateway), 103, "Wrong defaultGateway balance");
+        assertEq(ERC20(tokens[1]).balanceOf(address(otherGateway)), 104, "Wrong gateway balance");
+        assertEq(ERC20(tokens[2]).balanceOf(defaultGateway), 105, "Wrong defaultGateway balance");
+    }
+
+    function test_outboundTransferBatchCustomRefund_revert_WrongLength() public {
+        address[] memory tokens = new address[](1);
+        tokens[0] = makeAddr("token");
+
+        vm.prank(user);
+        vm.expectRevert("WRONG_LENGTH");
+        l1Router.outboundTransferBatchCustomRefund(
+            tokens,
+            user,
+            new address[](1),
+            new uint256[](1),
+            new uint256[](0),
+            gasPriceBid,
+            new bytes[](1),
+            new uint256[](1)
+        );
+    }
+
+    function test_outboundTransferBatchCustomRefund_revert_WrongValue() public {
+        address[] memory tokens = new address[](1);
+        tokens[0] = makeAddr("token");
+        uint256[] memory values = new uint256[](1);
+        values[0] = 1;
+
+        vm.prank(user);
+        vm.expectRevert("WRONG_VALUE");
+        l1Router.outboundTransferBatchCustomRefund(
+            tokens,
+            user,
+            new address[](1),
+            new uint256[](1),
+            new uint256[](1),
+            gasPriceBid,
+            new bytes[](1),
+            values
+        );
+    }
+
+    function test_outboundTransferBatchCustomRefund_revert_NoGateway() public {
+        // no default gateway, so the token doesn't resolve to any gateway
+        L1GatewayRouter noDefaultRouter = new L1GatewayRouter();
+        noDefaultRouter.initialize(owner, address(0), address(0), counterpartGateway, inbox);
+        address[] memory tokens = new address[](1);
+        tokens[0] = makeAddr("token");
+
+        vm.prank(user);
+        vm.expectRevert("NO_GATEWAY");
+        noDefaultRouter.outboundTransferBatchCustomRefund(
+            tokens,
+            user,
+            new address[](1),
+            new uint256[](1),
+            new uint256[](1),
+            gasPriceBid,
+            new bytes[](1),
+            new uint256[](1)
+        );
+    }
+
+    ////
+    // Helper functions
+    ////
+    function _deployChunkedRegistration()
+        internal
+        returns (address[] memory tokens, address[] memory gateways)
+    {
+        L1ERC20Gateway gatewayA = new L1ERC20Gateway();
+        gatewayA.initialize(
+            makeAddr("l2GatewayA"),
+            address(l1Router),
+            inbox,
+            0x0000000000000000000000000000000000000000000000000000000000000001,
+            makeAddr("l2BeaconProxyFactory")
+        );
+        L1ERC20Gateway gatewayB = new L1ERC20Gateway();
+        gatewayB.initialize(
+            makeAddr("l2GatewayB"),
+            address(l1Router),
+            inbox,
+            0x0000000000000000000000000000000000000000000000000000000000000001,
+            makeAddr("l2BeaconProxyFactory")
+        );
+
+        tokens = new address[](3);
+        gateways = new address[](3);
+        for (uint256 i = 0; i < 3; i++) {
+            tokens[i] = address(new ERC20("X", "Y"));
+        }
+        gateways[0] = address(gatewayA);
+        gateways[1] = address(gatewayA);
+        gateways[2] = address(gatewayB);
+    }
+
+    /// @dev tokens of gateway A, B, A, a disabled token, a token of the default gateway and a
+    /// token of a gateway without calculateL2TokenAddresses
+    function _registerMixedGateways()
+        internal
+        returns (address[] memory tokens, address[] memory gateways)
+    {
+        (, address[] memory chunkGateways) = _deployChunkedRegistration();
+
+        tokens = new address[](6);
+        gateways = new address[](6);
+        for (uint256 i = 0; i < 6; i++) {
+            tokens[i] = address(new ERC20("X", "Y"));
+        }
+        gateways[0] = chunkGateways[0];
+        gateways[1] = chunkGateways[2];
+        gateways[2] = chunkGateways[0];
+        gateways[3] = address(1);
+        gateways[5] = address(new LegacyGatewayMock());
+
+        _approveChunkFees(1);
+        vm.prank(owner);
+        _setGatewaysInChunks(tokens, gateways, 0, 6, 6, 1);
+    }
+
+    /// @dev allows the router to pull the fees of `numChunks` retryables, only needed by Orbit routers
+    function _approveChunkFees(uint256 numChunks) internal virtual {}
+
+    /// @dev pays the fees of `numChunks` retryables, must directly follow the prank of the owner
+    function _setGatewaysInChunks(
+        address[] memory tokens,
+        address[] memory gateways,
+        uint256 start,
+        uint256 end,
+        uint256 chunkSize,
+        uint256 numChunks
+    ) internal virtual returns (uint256[] memory) {
+        return
+            l1Router.setGatewaysInChunks{ value: retryableCost * numChunks }(
+                tokens,
+                gateways,
+                start,
+                end,
+                chunkSize,
+                L1ArbitrumMessenger.L2GasParams(maxSubmissionCost, maxGas, gasPriceBid)
+            );
+    }
+
+    function _slice(
+        address[] memory arr,
+        uint256 start,
+        uint256 end
+    ) internal pure returns (address[] memory res) {
+        res = new address[](end - start);
+        for (uint256 i = start; i < end; i++) {
+            res[i - start] = arr[i];
+        }
+    }
+
+    function _fill(address addr, uint256 length) internal pure returns (address[] memory res) {
+        res = new address[](length);
+        for (uint256 i = 0; i < length; i++) {
+            res[i] = addr;
+        }
+    }
+
     ////
     // Event declarations
     ////
@@ -825,3 +1570,25 @@ contract L1GatewayRouterTest is GatewayRouterTest {
     event RefundAddresses(address excessFeeRefundAddress, address callValueRefundAddress);
     event InboxRetryableTicket(address from, address to, uint256 value, uint256 maxGas, bytes data);
 }
+
+contract PermitToken is ERC20Permit {
+    constructor(address holder, uint256 supply) ERC20("Permit", "PRMT") ERC20Permit("Permit") {
+        _mint(holder, supply);
+    }
+}
+
+/// @dev gateway deployed before calculateL2TokenAddresses was added to TokenGateway
+contract LegacyGatewayMock {
+    address public counterpartGateway = address(0x1234);
+
+    function calculateL2TokenAddress(address l1ERC20) external pure returns (address) {
+        return address(uint160(l1ERC20) ^ 0xff);
+    }
+}
+
+/// @dev calculateL2TokenAddresses returns data that can't be decoded as address[]
+contract MalformedGatewayMock is LegacyGatewayMock {
+    function calculateL2TokenAddresses(address[] calldata) external pure returns (uint256) {
+        return 1;
+    }
+}
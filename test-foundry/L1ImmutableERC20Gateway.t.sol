@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "./L1ERC20Gateway.t.sol";
+import "contracts/tokenbridge/ethereum/gateway/L1ImmutableERC20Gateway.sol";
+
+contract L1ImmutableERC20GatewayTest is L1ERC20GatewayTest {
+    function setUp() public override {
+        inbox = address(new InboxMock());
+
+        l1Gateway = new L1ImmutableERC20Gateway(
+            l2Gateway, router, inbox, cloneableProxyHash, l2BeaconProxyFactory
+        );
+        L1ERC20Gateway(address(l1Gateway)).initialize(
+            l2Gateway, router, inbox, cloneableProxyHash, l2BeaconProxyFactory
+        );
+
+        token = IERC20(address(new TestERC20()));
+
+        maxSubmissionCost = 70;
+        retryableCost = maxSubmissionCost + gasPriceBid * maxGas;
+
+        // fund user and router
+        vm.prank(user);
+        TestERC20(address(token)).mint();
+        vm.deal(router, 100 ether);
+
+        // move some funds to gateway
+        vm.prank(user);
+        token.transfer(address(l1Gateway), 100);
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_initialize_revert_ImmutableConfigMismatch() public {
+        L1ERC20Gateway gateway = new L1ImmutableERC20Gateway(
+            l2Gateway, router, inbox, cloneableProxyHash, l2BeaconProxyFactory
+        );
+        vm.expectRevert("IMMUTABLE_CONFIG_MISMATCH");
+        gateway.initialize(
+            makeAddr("otherCounterpart"), router, inbox, cloneableProxyHash, l2BeaconProxyFactory
+        );
+
+        vm.expectRevert("IMMUTABLE_CONFIG_MISMATCH");
+        gateway.initialize(
+            l2Gateway, makeAddr("otherRouter"), inbox, cloneableProxyHash, l2BeaconProxyFactory
+        );
+
+        vm.expectRevert("IMMUTABLE_CONFIG_MISMATCH");
+        gateway.initialize(
+            l2Gateway, router, makeAddr("otherInbox"), cloneableProxyHash, l2BeaconProxyFactory
+        );
+
+        vm.expectRevert("IMMUTABLE_CONFIG_MISMATCH");
+        gateway.initialize(
+            l2Gateway, router, inbox, keccak256("otherProxyHash"), l2BeaconProxyFactory
+        );
+
+        vm.expectRevert("IMMUTABLE_CONFIG_MISMATCH");
+        gateway.initialize(
+            l2Gateway, router, inbox, cloneableProxyHash, makeAddr("otherBeaconProxyFactory")
+        );
+    }
+
+    function test_storageLayout_MatchesMutableGateway() public {
+        L1ERC20Gateway mutableGateway = new L1ERC20Gateway();
+        mutableGateway.initialize(
+            l2Gateway, router, inbox, cloneableProxyHash, l2BeaconProxyFactory
+        );
+
+        // the immutables don't take any slot, so a proxy can be upgraded between the two
+        for (uint256 slot = 0; slot < 9; slot++) {
+            assertEq(
+                vm.load(address(l1Gateway), bytes32(slot)),
+                vm.load(address(mutableGateway), bytes32(slot)),
+                "Storage mismatch"
+            );
+        }
+    }
+
+    function test_calculateL2TokenAddress_MatchesMutableGateway(address tokenAddress) public {
+        L1ERC20Gateway mutableGateway = new L1ERC20Gateway();
+        mutableGateway.initialize(
+            l2Gateway, router, inbox, cloneableProxyHash, l2BeaconProxyFactory
+        );
+
+        assertEq(
+            l1Gateway.calculateL2TokenAddress(tokenAddress),
+            mutableGateway.calculateL2TokenAddress(tokenAddress),
+            "Invalid calculateL2TokenAddress"
+        );
+    }
+}
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "./L1OrbitERC20Gateway.t.sol";
+import "contracts/tokenbridge/ethereum/gateway/L1ImmutableOrbitERC20Gateway.sol";
+
+contract L1ImmutableOrbitERC20GatewayTest is L1OrbitERC20GatewayTest {
+    function setUp() public override {
+        inbox = address(new ERC20InboxMock());
+        nativeToken = ERC20(address(new ERC20PresetMinterPauser("X", "Y")));
+        ERC20PresetMinterPauser(address(nativeToken)).mint(user, 1_000_000 ether);
+        ERC20InboxMock(inbox).setMockNativeToken(address(nativeToken));
+
+        l1Gateway = new L1ImmutableOrbitERC20Gateway(
+            l2Gateway, router, inbox, cloneableProxyHash, l2BeaconProxyFactory
+        );
+        L1OrbitERC20Gateway(address(l1Gateway)).initialize(
+            l2Gateway, router, inbox, cloneableProxyHash, l2BeaconProxyFactory
+        );
+
+        token = IERC20(address(new TestERC20()));
+        maxSubmissionCost = 0;
+        nativeTokenTotalFee = maxGas * gasPriceBid;
+
+        // fund user and router
+        vm.prank(user);
+        TestERC20(address(token)).mint();
+        vm.deal(router, 100 ether);
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_initialize_revert_ImmutableConfigMismatch() public {
+        L1ERC20Gateway gateway = new L1ImmutableOrbitERC20Gateway(
+            l2Gateway, router, inbox, cloneableProxyHash, l2BeaconProxyFactory
+        );
+
+        vm.expectRevert("IMMUTABLE_CONFIG_MISMATCH");
+        gateway.initialize(
+            l2Gateway, router, makeAddr("otherInbox"), cloneableProxyHash, l2BeaconProxyFactory
+        );
+
+        vm.expectRevert("IMMUTABLE_CONFIG_MISMATCH");
+        gateway.initialize(
+            l2Gateway, router, inbox, keccak256("otherProxyHash"), l2BeaconProxyFactory
+        );
+
+        vm.expectRevert("IMMUTABLE_CONFIG_MISMATCH");
+        gateway.initialize(
+            l2Gateway, router, inbox, cloneableProxyHash, makeAddr("otherBeaconProxyFactory")
+        );
+    }
+
+    function test_storageLayout_MatchesMutableGateway() public {
+        L1OrbitERC20Gateway mutableGateway = new L1OrbitERC20Gateway();
+        mutableGateway.initialize(
+            l2Gateway, router, inbox, cloneableProxyHash, l2BeaconProxyFactory
+        );
+
+        // the immutables don't take any slot, so a proxy can be upgraded between the two
+        for (uint256 slot = 0; slot < 10; slot++) {
+            assertEq(
+                vm.load(address(l1Gateway), bytes32(slot)),
+                vm.load(address(mutableGateway), bytes32(slot)),
+                "Storage mismatch"
+            );
+        }
+    }
+
+    function test_calculateL2TokenAddress_MatchesMutableGateway(address tokenAddress) public {
+        L1OrbitERC20Gateway mutableGateway = new L1OrbitERC20Gateway();
+        mutableGateway.initialize(
+            l2Gateway, router, inbox, cloneableProxyHash, l2BeaconProxyFactory
+        );
+
+        assertEq(
+            l1Gateway.calculateL2TokenAddress(tokenAddress),
+            mutableGateway.calculateL2TokenAddress(tokenAddress),
+            "Invalid calculateL2TokenAddress"
+        );
+    }
+}
@@ -739,6 +739,235 @@ contract L1OrbitCustomGatewayTest is L1CustomGatewayTest {
         );
     }
 
+    function test_registerTokensToL2() public override {
+        (address[] memory l1Tokens, address[] memory l2Tokens) = _deploySigningTokens();
+
+        // approve fees
+        vm.prank(user);
+        nativeToken.approve(address(l1Gateway), nativeTokenTotalFee);
+
+        // expect events
+        vm.expectEmit(true, true, true, true);
+        emit TokenSet(l1Tokens[0], l2Tokens[0]);
+
+        vm.expectEmit(true, true, true, true);
+        emit TokenSet(l1Tokens[1], l2Tokens[1]);
+
+        vm.expectEmit(true, true, true, true);
+        emit TicketData(maxSubmissionCost);
+
+        vm.expectEmit(true, true, true, true);
+        emit RefundAddresses(user, user);
+
+        vm.expectEmit(true, true, true, true);
+        emit ERC20InboxRetryableTicket(
+            address(l1Gateway),
+            l2Gateway,
+            0,
+            maxGas,
+            gasPriceBid,
+            nativeTokenTotalFee,
+            abi.encodeWithSelector(L2CustomGateway.registerTokenFromL1.selector, l1Tokens, l2Tokens)
+        );
+
+        // register tokens to gateway, anyone can send the signed pairs
+        vm.prank(user);
+        uint256 seqNum = L1OrbitCustomGateway(address(l1Gateway)).registerTokensToL2(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost,
+            nativeTokenTotalFee
+        );
+
+        ///// checks
+        assertEq(
+            L1OrbitCustomGateway(address(l1Gateway)).l1ToL2Token(l1Tokens[0]),
+            l2Tokens[0],
+            "Invalid L2 token"
+        );
+        assertEq(
+            L1OrbitCustomGateway(address(l1Gateway)).l1ToL2Token(l1Tokens[1]),
+            l2Tokens[1],
+            "Invalid L2 token"
+        );
+        assertEq(seqNum, 0, "Invalid seqNum");
+    }
+
+    function test_registerTokensToL2_revert_InvalidSignature() public override {
+        (address[] memory l1Tokens, address[] memory l2Tokens) = _deploySigningTokens();
+        // the token only signed its pair with the first L2 address
+        l2Tokens[1] = makeAddr("otherL2Token");
+
+        vm.prank(owner);
+        vm.expectRevert("INVALID_SIGNATURE");
+        L1OrbitCustomGateway(address(l1Gateway)).registerTokensToL2(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost,
+            nativeTokenTotalFee
+        );
+    }
+
+    function test_registerTokensToL2_revert_NotSignedByToken() public override {
+        (address[] memory l1Tokens, address[] memory l2Tokens) = _deploySigningTokens();
+        l1Tokens[1] = makeAddr("eoaToken");
+
+        vm.prank(owner);
+        vm.expectRevert("INVALID_SIGNATURE");
+        L1OrbitCustomGateway(address(l1Gateway)).registerTokensToL2(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost,
+            nativeTokenTotalFee
+        );
+    }
+
+    function test_registerTokensToL2_revert_NoUpdateToDifferentAddress() public override {
+        (address[] memory l1Tokens, address[] memory l2Tokens) = _deploySigningTokens();
+
+        // set initial address
+        address[] memory initialL2Tokens = new address[](1);
+        initialL2Tokens[0] = makeAddr("initial");
+        vm.prank(owner);
+        nativeToken.approve(address(l1Gateway), nativeTokenTotalFee);
+        vm.prank(owner);
+        L1OrbitCustomGateway(address(l1Gateway)).forceRegisterTokenToL2(
+            _single(l1Tokens[0]),
+            initialL2Tokens,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost,
+            nativeTokenTotalFee
+        );
+
+        // try to set different one
+        vm.prank(owner);
+        vm.expectRevert("NO_UPDATE_TO_DIFFERENT_ADDR");
+        L1OrbitCustomGateway(address(l1Gateway)).registerTokensToL2(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost,
+            nativeTokenTotalFee
+        );
+    }
+
+    function test_registerTokensToL2_revert_InvalidLength() public override {
+        vm.prank(owner);
+        vm.expectRevert("INVALID_LENGTHS");
+        L1OrbitCustomGateway(address(l1Gateway)).registerTokensToL2(
+            new address[](2),
+            new address[](2),
+            new bytes[](1),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost,
+            nativeTokenTotalFee
+        );
+    }
+
+    function test_registerTokensToL2_revert_SignatureReplayed() public override {
+        (address[] memory l1Tokens, address[] memory l2Tokens) = _deploySigningTokens();
+
+        vm.prank(user);
+        nativeToken.approve(address(l1Gateway), nativeTokenTotalFee * 2);
+        vm.prank(user);
+        L1OrbitCustomGateway(address(l1Gateway)).registerTokensToL2(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost,
+            nativeTokenTotalFee
+        );
+        assertEq(
+            L1OrbitCustomGateway(address(l1Gateway)).registrationNonce(l1Tokens[0]),
+            1,
+            "Invalid nonce"
+        );
+
+        // the nonce is part of the signed hash, so the same signatures can't be sent again
+        vm.prank(user);
+        vm.expectRevert("INVALID_SIGNATURE");
+        L1OrbitCustomGateway(address(l1Gateway)).registerTokensToL2(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost,
+            nativeTokenTotalFee
+        );
+    }
+
+    function test_registerTokensToL2_revert_ExpiredSignature() public override {
+        (address[] memory l1Tokens, address[] memory l2Tokens) = _deploySigningTokens();
+        vm.warp(registrationDeadline + 1);
+
+        vm.prank(owner);
+        vm.expectRevert("EXPIRED_SIGNATURE");
+        L1OrbitCustomGateway(address(l1Gateway)).registerTokensToL2(
+            l1Tokens,
+            l2Tokens,
+            new bytes[](2),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost,
+            nativeTokenTotalFee
+        );
+    }
+
+    function test_registerTokensToL2_revert_NotSupportedInOrbit() public {
+        vm.expectRevert("NOT_SUPPORTED_IN_ORBIT");
+        L1OrbitCustomGateway(address(l1Gateway)).registerTokensToL2(
+            new address[](1),
+            new address[](1),
+            new bytes[](1),
+            registrationDeadline,
+            maxGas,
+            gasPriceBid,
+            maxSubmissionCost
+        );
+    }
+
+    function test_initialize_NativeFeeToken() public {
+        assertEq(
+            L1OrbitCustomGateway(address(l1Gateway)).nativeFeeToken(),
+            address(nativeToken),
+            "Invalid nativeFeeToken"
+        );
+    }
+
+    function test_initialize_CodelessInbox() public {
+        // templates are initialized with a placeholder inbox
+        address dead = 0x000000000000000000000000000000000000dEaD;
+        L1OrbitCustomGateway template = new L1OrbitCustomGateway();
+        template.initialize(dead, dead, dead, dead);
+
+        assertEq(template.inbox(), dead, "Invalid inbox");
+        assertEq(template.nativeFeeToken(), address(0), "Invalid nativeFeeToken");
+    }
+
     ///
     // Helper functions
     ///
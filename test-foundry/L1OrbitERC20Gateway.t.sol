@@ -14,7 +14,10 @@ contract L1OrbitERC20GatewayTest is L1ERC20GatewayTest {
     ERC20 public nativeToken;
     uint256 public nativeTokenTotalFee;
 
-    function setUp() public override {
+    // slot of the cached native token, see test/storage/L1OrbitERC20Gateway
+    uint256 public constant NATIVE_FEE_TOKEN_SLOT = 9;
+
+    function setUp() public virtual override {
         inbox = address(new ERC20InboxMock());
         nativeToken = ERC20(address(new ERC20PresetMinterPauser("X", "Y")));
         ERC20PresetMinterPauser(address(nativeToken)).mint(user, 1_000_000 ether);
@@ -45,6 +48,11 @@ contract L1OrbitERC20GatewayTest is L1ERC20GatewayTest {
         assertEq(gateway.inbox(), inbox, "Invalid inbox");
         assertEq(gateway.l2BeaconProxyFactory(), l2BeaconProxyFactory, "Invalid beacon");
         assertEq(gateway.whitelist(), address(0), "Invalid whitelist");
+        assertEq(
+            L1OrbitERC20Gateway(address(gateway)).nativeFeeToken(),
+            address(nativeToken),
+            "Invalid nativeFeeToken"
+        );
     }
 
     function test_outboundTransfer() public override {
@@ -174,6 +182,115 @@ contract L1OrbitERC20GatewayTest is L1ERC20GatewayTest {
         );
     }
 
+    function test_outboundTransferBatchCustomRefund() public override {
+        IERC20 token2 = IERC20(address(new TestERC20()));
+        vm.prank(user);
+        TestERC20(address(token2)).mint();
+
+        // batch params
+        address[] memory tokens = new address[](2);
+        tokens[0] = address(token);
+        tokens[1] = address(token2);
+        address[] memory to = new address[](2);
+        to[0] = user;
+        to[1] = user;
+        uint256[] memory amounts = new uint256[](2);
+        amounts[0] = 700;
+        amounts[1] = 80;
+
+        // fees are paid once for the whole batch
+        vm.startPrank(user);
+        nativeToken.approve(address(l1Gateway), nativeTokenTotalFee);
+        token.approve(address(l1Gateway), amounts[0]);
+        token2.approve(address(l1Gateway), amounts[1]);
+        vm.stopPrank();
+
+        vm.expectEmit(true, true, true, true);
+        emit ERC20InboxRetryableTicket(
+            address(l1Gateway),
+            l2Gateway,
+            0,
+            maxGas,
+            gasPriceBid,
+            nativeTokenTotalFee,
+            L1ERC20Gateway(address(l1Gateway)).getOutboundBatchCalldata(
+                tokens, user, to, amounts, ""
+            )
+        );
+
+        vm.expectEmit(true, true, true, true);
+        emit DepositInitiated(address(token), user, user, 0, amounts[0]);
+        vm.expectEmit(true, true, true, true);
+        emit DepositInitiated(address(token2), user, user, 0, amounts[1]);
+
+        vm.prank(router);
+        L1ERC20Gateway(address(l1Gateway)).outboundTransferBatchCustomRefund(
+            tokens, creditBackAddress, to, amounts, maxGas, gasPriceBid, buildRouterEncodedData("")
+        );
+
+        assertEq(token.balanceOf(address(l1Gateway)), 700, "Wrong l1 gateway balance");
+        assertEq(token2.balanceOf(address(l1Gateway)), 80, "Wrong l1 gateway balance 2");
+    }
+
+    function test_outboundTransferBatchCustomRefund_revert_NotAllowedToBridgeFeeToken() public {
+        address[] memory tokens = new address[](2);
+        tokens[0] = address(token);
+        tokens[1] = address(nativeToken);
+
+        vm.prank(router);
+        vm.expectRevert("NOT_ALLOWED_TO_BRIDGE_FEE_TOKEN");
+        L1ERC20Gateway(address(l1Gateway)).outboundTransferBatchCustomRefund(
+            tokens,
+            user,
+            new address[](2),
+            new uint256[](2),
+            maxGas,
+            gasPriceBid,
+            buildRouterEncodedData("")
+        );
+    }
+
+    function test_outboundTransferCustomRefund_Packed() public override {
+        // fill the gateway the same way as the parent setup does
+        vm.startPrank(user);
+        token.transfer(address(l1Gateway), 100);
+        nativeToken.approve(address(l1Gateway), nativeTokenTotalFee);
+        vm.stopPrank();
+
+        super.test_outboundTransferCustomRefund_Packed();
+    }
+
+    function test_outboundTransferCustomRefund_Packed_L2MsgDisabled() public override {
+        vm.prank(user);
+        nativeToken.approve(address(l1Gateway), nativeTokenTotalFee);
+
+        super.test_outboundTransferCustomRefund_Packed_L2MsgDisabled();
+    }
+
+    function test_outboundTransferCustomRefund_AppendedSender() public override {
+        // fill the gateway the same way as the parent setup does
+        vm.startPrank(user);
+        token.transfer(address(l1Gateway), 100);
+        nativeToken.approve(address(l1Gateway), nativeTokenTotalFee);
+        vm.stopPrank();
+
+        super.test_outboundTransferCustomRefund_AppendedSender();
+    }
+
+    function test_outboundTransferCustomRefund_DepositMessageSent() public override {
+        vm.prank(user);
+        nativeToken.approve(address(l1Gateway), nativeTokenTotalFee);
+
+        super.test_outboundTransferCustomRefund_DepositMessageSent();
+    }
+
+    function test_outboundTransferCustomRefund_DepositHook() public override {
+        vm.prank(user);
+        nativeToken.approve(address(l1Gateway), nativeTokenTotalFee);
+
+        super.test_outboundTransferCustomRefund_DepositHook();
+    }
+
     function test_outboundTransferCustomRefund_InboxPrefunded() public {
         // retryable params
         uint256 depositAmount = 700;
@@ -341,6 +458,46 @@ contract L1OrbitERC20GatewayTest is L1ERC20GatewayTest {
         );
     }
 
+    function test_outboundTransferCustomRefund_revert_NotAllowedToBridgeFeeTokenNotCached() public {
+        // gateways initialized before the native token was cached query the bridge
+        vm.store(address(l1Gateway), bytes32(NATIVE_FEE_TOKEN_SLOT), bytes32(0));
+
+        vm.prank(router);
+        vm.expectRevert("NOT_ALLOWED_TO_BRIDGE_FEE_TOKEN");
+        l1Gateway.outboundTransferCustomRefund(
+            address(nativeToken), creditBackAddress, user, 100, maxGas, gasPriceBid, ""
+        );
+    }
+
+    function test_initialize_CodelessInbox() public {
+        // templates are initialized with a placeholder inbox
+        address dead = 0x000000000000000000000000000000000000dEaD;
+        L1OrbitERC20Gateway template = new L1OrbitERC20Gateway();
+        template.initialize(dead, dead, dead, bytes32(uint256(1)), dead);
+
+        assertEq(template.inbox(), dead, "Invalid inbox");
+        assertEq(template.nativeFeeToken(), address(0), "Invalid nativeFeeToken");
+    }
+
+    function test_postUpgradeInit_NativeFeeToken() public {
+        vm.store(address(l1Gateway), bytes32(NATIVE_FEE_TOKEN_SLOT), bytes32(0));
+        address proxyAdmin = makeAddr("proxyAdmin");
+        vm.store(
+            address(l1Gateway),
+            0xb53127684a568b3173ae13b9f8a6016e243e63b6e8ee1178d6a717850b5d6103,
+            bytes32(uint256(uint160(proxyAdmin)))
+        );
+
+        vm.prank(proxyAdmin);
+        L1OrbitERC20Gateway(address(l1Gateway)).postUpgradeInit();
+
+        assertEq(
+            L1OrbitERC20Gateway(address(l1Gateway)).nativeFeeToken(),
+            address(nativeToken),
+            "Invalid nativeFeeToken"
+        );
+    }
+
     function test_outboundTransferCustomRefund_revert_Reentrancy() public override {
         // approve fees
         vm.prank(user);
@@ -384,6 +541,12 @@ contract L1OrbitERC20GatewayTest is L1ERC20GatewayTest {
         return routerEncodedData;
     }
 
+    function buildPackedUserEncodedData() internal view override returns (bytes memory) {
+        return abi.encodePacked(
+            GatewayMessageHandler.PACKED_MSG_VERSION, maxSubmissionCost, nativeTokenTotalFee
+        );
+    }
+
     event ERC20InboxRetryableTicket(
         address from,
         address to,
@@ -2,13 +2,17 @@
 
 pragma solidity ^0.8.0;
 
-import {L1GatewayRouterTest} from "./L1GatewayRouter.t.sol";
+import {L1GatewayRouterTest, PermitToken} from "./L1GatewayRouter.t.sol";
+import {GatewayRouter} from "contracts/tokenbridge/libraries/gateway/GatewayRouter.sol";
 import {ERC20InboxMock} from "contracts/tokenbridge/test/InboxMock.sol";
 import {L1OrbitERC20Gateway} from "contracts/tokenbridge/ethereum/gateway/L1OrbitERC20Gateway.sol";
 import {L1OrbitGatewayRouter} from "contracts/tokenbridge/ethereum/gateway/L1OrbitGatewayRouter.sol";
 import {L2GatewayRouter} from "contracts/tokenbridge/arbitrum/gateway/L2GatewayRouter.sol";
 import {L1GatewayRouter} from "contracts/tokenbridge/ethereum/gateway/L1GatewayRouter.sol";
+import {L1ArbitrumMessenger} from "contracts/tokenbridge/ethereum/L1ArbitrumMessenger.sol";
 import {L1OrbitCustomGateway} from "contracts/tokenbridge/ethereum/gateway/L1OrbitCustomGateway.sol";
+import {GatewayMessageHandler} from
+    "contracts/tokenbridge/libraries/gateway/GatewayMessageHandler.sol";
 import {ERC20} from "@openzeppelin/contracts/token/ERC20/ERC20.sol";
 import {ERC20PresetMinterPauser} from
     "@openzeppelin/contracts/token/ERC20/presets/ERC20PresetMinterPauser.sol";
@@ -20,6 +24,9 @@ contract L1OrbitGatewayRouterTest is L1GatewayRouterTest {
     ERC20 public nativeToken;
     uint256 public nativeTokenTotalFee;
 
+    // slot of the cached native token and its decimals, see test/storage/L1OrbitGatewayRouter
+    uint256 public constant NATIVE_FEE_TOKEN_SLOT = 7;
+
     function setUp() public override {
         inbox = address(new ERC20InboxMock());
         nativeToken = ERC20(address(new ERC20PresetMinterPauser("X", "Y")));
@@ -60,6 +67,27 @@ contract L1OrbitGatewayRouterTest is L1GatewayRouterTest {
         assertEq(gateway, gateways[0], "Invalid gateway");
     }
 
+    function test_getGateway_CustomGateway_StoredAsContract() public override {
+        address token = makeAddr("some token");
+
+        address[] memory tokens = new address[](1);
+        tokens[0] = token;
+        address[] memory gateways = new address[](1);
+        gateways[0] = address(new L1OrbitERC20Gateway());
+
+        vm.startPrank(owner);
+        nativeToken.approve(address(l1OrbitRouter), nativeTokenTotalFee);
+        l1OrbitRouter.setGateways(
+            tokens, gateways, maxGas, gasPriceBid, maxSubmissionCost, nativeTokenTotalFee
+        );
+
+        // l1TokenToGateway is at slot 3, the flag is kept above the gateway address
+        bytes32 entry = vm.load(address(l1Router), keccak256(abi.encode(token, uint256(3))));
+        assertEq(uint256(entry), uint256(uint160(gateways[0])) | (1 << 160), "Invalid entry");
+        assertEq(l1Router.l1TokenToGateway(token), gateways[0], "Invalid l1TokenToGateway");
+        assertEq(router.getGateway(token), gateways[0], "Invalid gateway");
+    }
+
     function test_getGateway_DisabledGateway() public override {
         address token = makeAddr("some token");
 
@@ -235,6 +263,212 @@ contract L1OrbitGatewayRouterTest is L1GatewayRouterTest {
         );
     }
 
+    function test_outboundTransferCustomRefund_AppendedSender() public override {
+        // init default gateway
+        L1OrbitERC20Gateway(defaultGateway).initialize(
+            makeAddr("defaultGatewayCounterpart"),
+            address(l1Router),
+            inbox,
+            0x0000000000000000000000000000000000000000000000000000000000000001,
+            makeAddr("l2BeaconProxyFactory")
+        );
+
+        // set default gateway
+        vm.startPrank(owner);
+        nativeToken.approve(address(l1OrbitRouter), nativeTokenTotalFee);
+        l1OrbitRouter.setDefaultGateway(
+            address(defaultGateway), maxGas, gasPriceBid, maxSubmissionCost, nativeTokenTotalFee
+        );
+        vm.stopPrank();
+
+        // create token
+        ERC20PresetMinterPauser token = new ERC20PresetMinterPauser("X", "Y");
+        token.mint(user, 10_000);
+
+        /// deposit data, packed user data opts into the new convention
+        address refundTo = address(400);
+        address to = address(401);
+        uint256 amount = 103;
+        bytes memory userEncodedData = abi.encodePacked(
+            GatewayMessageHandler.PACKED_MSG_VERSION, maxSubmissionCost, nativeTokenTotalFee
+        );
+
+        // approve fees and tokens
+        vm.startPrank(user);
+        nativeToken.approve(defaultGateway, nativeTokenTotalFee);
+        token.approve(defaultGateway, amount);
+        vm.stopPrank();
+
+        // sender is appended to the gateway call instead of being abi encoded with the data
+        vm.expectCall(
+            defaultGateway,
+            abi.encodePacked(
+                abi.encodeWithSelector(
+                    L1OrbitERC20Gateway.outboundTransferCustomRefund.selector,
+                    address(token),
+                    refundTo,
+                    to,
+                    amount,
+                    maxGas,
+                    gasPriceBid,
+                    userEncodedData
+                ),
+                user
+            )
+        );
+        vm.expectEmit(true, true, true, true);
+        emit TransferRouted(address(token), user, to, address(defaultGateway));
+
+        /// deposit it
+        vm.prank(user);
+        l1Router.outboundTransferCustomRefund(
+            address(token), refundTo, to, amount, maxGas, gasPriceBid, userEncodedData
+        );
+
+        assertEq(token.balanceOf(defaultGateway), amount, "Wrong defaultGateway balance");
+        assertEq(
+            nativeToken.balanceOf(user),
+            1_000_000 ether - nativeTokenTotalFee,
+            "Wrong user native token balance"
+        );
+    }
+
+    function test_outboundTransferCustomRefundWithPermit() public override {
+        // init default gateway
+        L1OrbitERC20Gateway(defaultGateway).initialize(
+            makeAddr("defaultGatewayCounterpart"),
+            address(l1Router),
+            inbox,
+            0x0000000000000000000000000000000000000000000000000000000000000001,
+            makeAddr("l2BeaconProxyFactory")
+        );
+
+        // set default gateway
+        vm.startPrank(owner);
+        nativeToken.approve(address(l1OrbitRouter), nativeTokenTotalFee);
+        l1OrbitRouter.setDefaultGateway(
+            address(defaultGateway), maxGas, gasPriceBid, maxSubmissionCost, nativeTokenTotalFee
+        );
+        vm.stopPrank();
+
+        // create token, permit user has no approval
+        (address permitUser, uint256 permitUserKey) = makeAddrAndKey("permitUser");
+        PermitToken token = new PermitToken(permitUser, 10_000);
+        ERC20PresetMinterPauser(address(nativeToken)).mint(permitUser, nativeTokenTotalFee);
+
+        /// deposit data
+        address refundTo = address(400);
+        address to = address(401);
+        uint256 amount = 103;
+        bytes memory userEncodedData = abi.encode(maxSubmissionCost, "", nativeTokenTotalFee);
+        GatewayRouter.PermitData memory permitData =
+            _signPermit(address(token), permitUserKey, defaultGateway, amount, block.timestamp);
+
+        // fees are not covered by the permit
+        vm.prank(permitUser);
+        nativeToken.approve(defaultGateway, nativeTokenTotalFee);
+
+        // expect event
+        vm.expectEmit(true, true, true, true);
+        emit TransferRouted(address(token), permitUser, to, address(defaultGateway));
+
+        /// deposit it
+        vm.prank(permitUser);
+        l1Router.outboundTransferCustomRefundWithPermit(
+            address(token),
+            refundTo,
+            to,
+            amount,
+            maxGas,
+            gasPriceBid,
+            userEncodedData,
+            permitData
+        );
+
+        // check tokens are escrowed
+        assertEq(token.balanceOf(permitUser), 10_000 - amount, "Wrong user balance");
+        assertEq(token.balanceOf(defaultGateway), amount, "Wrong defaultGateway balance");
+        assertEq(token.nonces(permitUser), 1, "Permit not used");
+        assertEq(nativeToken.balanceOf(permitUser), 0, "Wrong user native token balance");
+    }
+
+    function test_outboundTransferBatchCustomRefund() public override {
+        // init default gateway
+        L1OrbitERC20Gateway(defaultGateway).initialize(
+            makeAddr("defaultGatewayCounterpart"),
+            address(l1Router),
+            inbox,
+            0x0000000000000000000000000000000000000000000000000000000000000001,
+            makeAddr("l2BeaconProxyFactory")
+        );
+
+        // set default gateway
+        vm.startPrank(owner);
+        nativeToken.approve(address(l1OrbitRouter), nativeTokenTotalFee);
+        l1OrbitRouter.setDefaultGateway(
+            address(defaultGateway), maxGas, gasPriceBid, maxSubmissionCost, nativeTokenTotalFee
+        );
+        vm.stopPrank();
+
+        // create tokens
+        address[] memory tokens = new address[](2);
+        for (uint256 i = 0; i < 2; i++) {
+            ERC20PresetMinterPauser token = new ERC20PresetMinterPauser("X", "Y");
+            token.mint(user, 10_000);
+            tokens[i] = address(token);
+        }
+        uint256 userNativeTokenBalanceBefore = nativeToken.balanceOf(user);
+
+        /// deposit data
+        address[] memory to = new address[](2);
+        to[0] = address(401);
+        to[1] = address(402);
+        uint256[] memory amounts = new uint256[](2);
+        amounts[0] = 103;
+        amounts[1] = 104;
+        uint256[] memory maxGasPerGroup = new uint256[](1);
+        maxGasPerGroup[0] = maxGas;
+        bytes[] memory userEncodedData = new bytes[](1);
+        userEncodedData[0] = abi.encode(maxSubmissionCost, "", nativeTokenTotalFee);
+
+        // approve fees and tokens
+        vm.startPrank(user);
+        nativeToken.approve(defaultGateway, nativeTokenTotalFee);
+        ERC20(tokens[0]).approve(defaultGateway, amounts[0]);
+        ERC20(tokens[1]).approve(defaultGateway, amounts[1]);
+        vm.stopPrank();
+
+        // expect events
+        vm.expectEmit(true, true, true, true);
+        emit TransferRouted(tokens[0], user, to[0], address(defaultGateway));
+        vm.expectEmit(true, true, true, true);
+        emit TransferRouted(tokens[1], user, to[1], address(defaultGateway));
+
+        /// deposit it
+        vm.prank(user);
+        bytes[] memory res = l1Router.outboundTransferBatchCustomRefund(
+            tokens,
+            address(400),
+            to,
+            amounts,
+            maxGasPerGroup,
+            gasPriceBid,
+            userEncodedData,
+            new uint256[](1)
+        );
+
+        assertEq(res.length, 1, "Wrong number of retryables");
+
+        // check tokens are escrowed and fees are paid once
+        assertEq(ERC20(tokens[0]).balanceOf(defaultGateway), 103, "Wrong defaultGateway balance");
+        assertEq(ERC20(tokens[1]).balanceOf(defaultGateway), 104, "Wrong defaultGateway balance");
+        assertEq(
+            userNativeTokenBalanceBefore - nativeToken.balanceOf(user),
+            nativeTokenTotalFee,
+            "Wrong user native token balance"
+        );
+    }
+
     function test_outboundTransferCustomRefund_revert_NotAllowedToBridgeFeeToken() public {
         // init default gateway
         L1OrbitERC20Gateway(defaultGateway).initialize(
@@ -787,6 +1021,16 @@ contract L1OrbitGatewayRouterTest is L1GatewayRouterTest {
         );
     }
 
+    function test_outboundTransferETHCustomRefund() public override {
+        vm.deal(user, 3 ether);
+
+        vm.prank(user);
+        vm.expectRevert("NOT_SUPPORTED_IN_ORBIT");
+        l1OrbitRouter.outboundTransferETHCustomRefund{value: 3 ether}(
+            makeAddr("weth"), user, user, 2 ether, maxGas, gasPriceBid, abi.encode(uint256(20), "")
+        );
+    }
+
     function test_setGateway_revert_NotSupportedInOrbit() public {
         vm.expectRevert("NOT_SUPPORTED_IN_ORBIT");
         l1OrbitRouter.setGateway(address(102), maxGas, gasPriceBid, maxSubmissionCost);
@@ -1014,6 +1258,185 @@ contract L1OrbitGatewayRouterTest is L1GatewayRouterTest {
         );
     }
 
+    function test_setGatewaysInChunks() public override {
+        (address[] memory tokens, address[] memory gateways) = _deployChunkedRegistration();
+
+        // expect one retryable for each chunk, the first two tokens share the same gateway
+        vm.expectEmit(true, true, true, true);
+        emit GatewaySet(tokens[0], gateways[0]);
+        vm.expectEmit(true, true, true, true);
+        emit GatewaySet(tokens[1], gateways[1]);
+        vm.expectEmit(true, true, true, true);
+        emit ERC20InboxRetryableTicket(
+            address(l1OrbitRouter),
+            counterpartGateway,
+            0,
+            maxGas,
+            gasPriceBid,
+            nativeTokenTotalFee,
+            abi.encodeWithSelector(
+                L2GatewayRouter.setGateway.selector,
+                _slice(tokens, 0, 2),
+                _fill(makeAddr("l2GatewayA"), 2)
+            )
+        );
+        vm.expectEmit(true, true, true, true);
+        emit GatewaySet(tokens[2], gateways[2]);
+        vm.expectEmit(true, true, true, true);
+        emit ERC20InboxRetryableTicket(
+            address(l1OrbitRouter),
+            counterpartGateway,
+            0,
+            maxGas,
+            gasPriceBid,
+            nativeTokenTotalFee,
+            abi.encodeWithSelector(
+                L2GatewayRouter.setGateway.selector,
+                _slice(tokens, 2, 3),
+                _fill(makeAddr("l2GatewayB"), 1)
+            )
+        );
+
+        /// set gateways
+        _approveChunkFees(2);
+        vm.prank(owner);
+        uint256[] memory seqNums = _setGatewaysInChunks(tokens, gateways, 0, 3, 2, 2);
+
+        ///// checks
+
+        assertEq(seqNums.length, 2, "Invalid seqNums length");
+        assertEq(seqNums[1], 1, "Invalid seqNum");
+        for (uint256 i = 0; i < 3; i++) {
+            assertEq(l1Router.l1TokenToGateway(tokens[i]), gateways[i], "Gateway not set");
+        }
+    }
+
+    function test_setGatewaysInChunks_revert_WrongValue() public override {
+        vm.prank(owner);
+        vm.expectRevert("NOT_SUPPORTED_IN_ORBIT");
+        l1OrbitRouter.setGatewaysInChunks{value: retryableCost}(
+            new address[](2),
+            new address[](2),
+            0,
+            2,
+            1,
+            L1ArbitrumMessenger.L2GasParams(maxSubmissionCost, maxGas, gasPriceBid)
+        );
+    }
+
+    function test_quoteDeposit() public override {
+        address token = address(new ERC20("X", "Y"));
+        bytes memory callHookData = abi.encode("hook");
+        vm.fee(2 gwei);
+
+        L1GatewayRouter.DepositQuote memory quote = l1OrbitRouter.quoteDeposit(
+            token, user, user, 100, callHookData, maxGas, gasPriceBid, 2 gwei
+        );
+
+        assertEq(quote.gateway, defaultGateway, "Invalid gateway");
+        assertEq(
+            quote.calldataLength,
+            l1OrbitRouter.getOutboundCalldata(token, user, user, 100, callHookData).length,
+            "Invalid calldata length"
+        );
+        assertEq(quote.submissionFee, 0, "Invalid submission fee");
+        assertEq(quote.retryableValue, 0, "Invalid retryable value");
+        assertEq(quote.tokenTotalFeeAmount, maxGas * gasPriceBid, "Invalid token fee amount");
+    }
+
+    function test_quoteDeposit_ScaledFeeToken() public {
+        vm.mockCall(
+            address(nativeToken), abi.encodeWithSignature("decimals()"), abi.encode(uint8(6))
+        );
+        // decimals are cached when the router is initialized
+        L1OrbitGatewayRouter scaledRouter = new L1OrbitGatewayRouter();
+        scaledRouter.initialize(owner, defaultGateway, address(0), counterpartGateway, inbox);
+
+        L1GatewayRouter.DepositQuote memory quote = scaledRouter.quoteDeposit(
+            address(new ERC20("X", "Y")), user, user, 100, "", 1e6, 1e12 + 1, 2 gwei
+        );
+
+        // fees are converted from 18 to 6 decimals, rounding up
+        assertEq(quote.tokenTotalFeeAmount, 1e6 + 1, "Invalid token fee amount");
+    }
+
+    function test_initialize_NativeFeeToken() public {
+        assertEq(l1OrbitRouter.nativeFeeToken(), address(nativeToken), "Invalid nativeFeeToken");
+        assertEq(l1OrbitRouter.nativeFeeTokenDecimals(), 18, "Invalid nativeFeeTokenDecimals");
+    }
+
+    function test_initialize_CodelessInbox() public {
+        // templates are initialized with a placeholder inbox
+        address dead = 0x000000000000000000000000000000000000dEaD;
+        L1OrbitGatewayRouter template = new L1OrbitGatewayRouter();
+        template.initialize(dead, dead, dead, dead, dead);
+
+        assertEq(template.inbox(), dead, "Invalid inbox");
+        assertEq(template.nativeFeeToken(), address(0), "Invalid nativeFeeToken");
+        assertEq(template.nativeFeeTokenDecimals(), 0, "Invalid nativeFeeTokenDecimals");
+    }
+
+    function test_postUpgradeInit_NativeFeeToken() public {
+        // routers initialized before the native token was cached
+        vm.store(address(l1OrbitRouter), bytes32(NATIVE_FEE_TOKEN_SLOT), bytes32(0));
+        address proxyAdmin = makeAddr("proxyAdmin");
+        vm.store(
+            address(l1OrbitRouter),
+            0xb53127684a568b3173ae13b9f8a6016e243e63b6e8ee1178d6a717850b5d6103,
+            bytes32(uint256(uint160(proxyAdmin)))
+        );
+
+        vm.prank(proxyAdmin);
+        l1OrbitRouter.postUpgradeInit();
+
+        assertEq(l1OrbitRouter.nativeFeeToken(), address(nativeToken), "Invalid nativeFeeToken");
+        assertEq(l1OrbitRouter.nativeFeeTokenDecimals(), 18, "Invalid nativeFeeTokenDecimals");
+    }
+
+    function test_quoteDeposit_NativeFeeTokenNotCached() public {
+        vm.store(address(l1OrbitRouter), bytes32(NATIVE_FEE_TOKEN_SLOT), bytes32(0));
+        vm.mockCall(
+            address(nativeToken), abi.encodeWithSignature("decimals()"), abi.encode(uint8(6))
+        );
+
+        L1GatewayRouter.DepositQuote memory quote = l1OrbitRouter.quoteDeposit(
+            address(new ERC20("X", "Y")), user, user, 100, "", 1e6, 1e12 + 1, 2 gwei
+        );
+
+        // decimals are queried from the native token
+        assertEq(quote.tokenTotalFeeAmount, 1e6 + 1, "Invalid token fee amount");
+    }
+
+    ////
+    // Helper functions
+    ////
+    function _approveChunkFees(uint256 numChunks) internal override {
+        vm.prank(owner);
+        nativeToken.approve(address(l1OrbitRouter), nativeTokenTotalFee * numChunks);
+    }
+
+    function _setGatewaysInChunks(
+        address[] memory tokens,
+        address[] memory gateways,
+        uint256 start,
+        uint256 end,
+        uint256 chunkSize,
+        uint256 /* numChunks */
+    ) internal override returns (uint256[] memory) {
+        return l1OrbitRouter.setGatewaysInChunks(
+            tokens,
+            gateways,
+            start,
+            end,
+            chunkSize,
+            L1ArbitrumMessenger.L2GasParams(maxSubmissionCost, maxGas, gasPriceBid),
+            nativeTokenTotalFee
+        );
+    }
+
+    ////
+    // Event declarations
+    ////
     event ERC20InboxRetryableTicket(
         address from,
         address to,
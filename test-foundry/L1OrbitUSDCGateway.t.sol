@@ -316,6 +316,14 @@ contract L1OrbitUSDCGatewayTest is L1USDCGatewayTest {
         assertEq(seqNum, abi.encode(0), "Invalid seqNum");
     }
 
+    function test_initialize_NativeFeeToken() public {
+        assertEq(
+            L1OrbitUSDCGateway(address(l1Gateway)).nativeFeeToken(),
+            address(nativeToken),
+            "Invalid nativeFeeToken"
+        );
+    }
+
     ///
     // Helper functions
     ///
@@ -137,6 +137,24 @@ contract L1WethGatewayTest is L1ArbitrumExtendedGatewayTest {
         // N/A
     }
 
+    function test_transferExitAndCallBatch() public override {
+        address seller = makeAddr("seller");
+        uint256[] memory exitNums = new uint256[](1);
+        exitNums[0] = 10;
+        address[] memory initialDestinations = new address[](1);
+        initialDestinations[0] = seller;
+
+        vm.prank(seller);
+        vm.expectRevert("TRADABLE_EXIT_TEMP_DISABLED");
+        L1ArbitrumExtendedGateway(address(l1Gateway)).transferExitAndCallBatch(
+            exitNums, initialDestinations, makeAddr("desk"), ""
+        );
+    }
+
+    function test_transferExitAndCallBatch_NonEmptyData() public override {
+        // N/A
+    }
+
     function test_calculateL2TokenAddress() public virtual {
         assertEq(l1Gateway.calculateL2TokenAddress(L1_WETH), L2_WETH, "Invalid L2 token address");
     }
@@ -730,6 +748,109 @@ contract L1WethGatewayTest is L1ArbitrumExtendedGatewayTest {
     //     L1WethGateway(address(l1Gateway)).setOwner(address(300));
     // }
 
+    function test_outboundTransferETHCustomRefund() public {
+        uint256 depositAmount = 3 ether;
+        bytes memory l2Calldata =
+            l1Gateway.getOutboundCalldata(L1_WETH, user, user, depositAmount, "");
+        uint256 bridgeBalanceBefore = address(IInbox(l1Gateway.inbox()).bridge()).balance;
+        uint256 routerBalanceBefore = router.balance;
+
+        vm.expectEmit(true, true, true, true);
+        emit TicketData(maxSubmissionCost);
+        vm.expectEmit(true, true, true, true);
+        emit RefundAddresses(creditBackAddress, user);
+        vm.expectEmit(true, true, true, true);
+        emit InboxRetryableTicket(address(l1Gateway), l2Gateway, depositAmount, maxGas, l2Calldata);
+        vm.expectEmit(true, true, true, true);
+        emit DepositInitiated(L1_WETH, user, user, 0, depositAmount);
+        vm.expectEmit(true, true, true, true);
+        emit DepositMessageSent(L1_WETH, 0, keccak256(l2Calldata), L2_WETH);
+
+        // trigger deposit, no WETH is involved
+        vm.prank(router);
+        bytes memory seqNum0 = L1WethGateway(payable(address(l1Gateway)))
+            .outboundTransferETHCustomRefund{value: retryableCost + depositAmount}(
+            L1_WETH,
+            creditBackAddress,
+            user,
+            depositAmount,
+            maxGas,
+            gasPriceBid,
+            buildRouterEncodedData("")
+        );
+
+        // whole msg.value is forwarded to the bridge
+        assertEq(
+            address(IInbox(l1Gateway.inbox()).bridge()).balance - bridgeBalanceBefore,
+            retryableCost + depositAmount,
+            "Wrong bridge balance"
+        );
+        assertEq(
+            routerBalanceBefore - router.balance,
+            retryableCost + depositAmount,
+            "Wrong router balance"
+        );
+        assertEq(address(l1Gateway).balance, 0, "Wrong gateway balance");
+        assertEq(ERC20(L1_WETH).totalSupply(), 0, "WETH minted");
+        assertEq(seqNum0, abi.encode(0), "Invalid seqNum0");
+    }
+
+    function test_outboundTransferETHCustomRefund_revert_NotFromRouter() public {
+        vm.expectRevert("NOT_FROM_ROUTER");
+        L1WethGateway(payable(address(l1Gateway))).outboundTransferETHCustomRefund(
+            L1_WETH, creditBackAddress, user, 1 ether, maxGas, gasPriceBid, ""
+        );
+    }
+
+    function test_outboundTransferETHCustomRefund_revert_NotWeth() public {
+        vm.prank(router);
+        vm.expectRevert("NOT_WETH");
+        L1WethGateway(payable(address(l1Gateway))).outboundTransferETHCustomRefund{value: 1 ether}(
+            makeAddr("token"), creditBackAddress, user, 1 ether, maxGas, gasPriceBid, ""
+        );
+    }
+
+    function test_outboundTransferETHCustomRefund_revert_InsufficientValue() public {
+        vm.prank(router);
+        vm.expectRevert("INSUFFICIENT_VALUE");
+        L1WethGateway(payable(address(l1Gateway))).outboundTransferETHCustomRefund{
+            value: 1 ether - 1
+        }(L1_WETH, creditBackAddress, user, 1 ether, maxGas, gasPriceBid, "");
+    }
+
+    function test_outboundTransferETHCustomRefund_revert_InsufficientRetryableValue() public {
+        // deposited ether can't be used to pay for the retryable
+        vm.prank(router);
+        vm.expectRevert("WRONG_ETH_VALUE");
+        L1WethGateway(payable(address(l1Gateway))).outboundTransferETHCustomRefund{
+            value: 1 ether + retryableCost - 1
+        }(
+            L1_WETH,
+            creditBackAddress,
+            user,
+            1 ether,
+            maxGas,
+            gasPriceBid,
+            buildRouterEncodedData("")
+        );
+    }
+
+    function test_outboundTransferETHCustomRefund_revert_ExtraDataDisabled() public {
+        vm.prank(router);
+        vm.expectRevert("EXTRA_DATA_DISABLED");
+        L1WethGateway(payable(address(l1Gateway))).outboundTransferETHCustomRefund{
+            value: 1 ether + retryableCost
+        }(
+            L1_WETH,
+            creditBackAddress,
+            user,
+            1 ether,
+            maxGas,
+            gasPriceBid,
+            buildRouterEncodedData(abi.encode("hook"))
+        );
+    }
+
     ////
     // Event declarations
     ////
@@ -742,6 +863,12 @@ contract L1WethGatewayTest is L1ArbitrumExtendedGatewayTest {
         uint256 indexed _sequenceNumber,
         uint256 _amount
     );
+    event DepositMessageSent(
+        address indexed l1Token,
+        uint256 indexed _sequenceNumber,
+        bytes32 indexed _messageHash,
+        address _l2Token
+    );
     event TicketData(uint256 maxSubmissionCost);
     event RefundAddresses(address excessFeeRefundAddress, address callValueRefundAddress);
     event InboxRetryableTicket(address from, address to, uint256 value, uint256 maxGas, bytes data);
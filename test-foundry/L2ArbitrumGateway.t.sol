@@ -7,6 +7,8 @@ import "forge-std/Test.sol";
 import {L2ArbitrumGateway} from "contracts/tokenbridge/arbitrum/gateway/L2ArbitrumGateway.sol";
 import {ArbSysMock} from "contracts/tokenbridge/test/ArbSysMock.sol";
 import {ITokenGateway} from "contracts/tokenbridge/libraries/gateway/ITokenGateway.sol";
+import {GatewayMessageHandler} from "contracts/tokenbridge/libraries/gateway/GatewayMessageHandler.sol";
+import {IERC165} from "contracts/tokenbridge/libraries/IERC165.sol";
 
 abstract contract L2ArbitrumGatewayTest is Test {
     L2ArbitrumGateway public l2Gateway;
@@ -66,6 +68,17 @@ abstract contract L2ArbitrumGatewayTest is Test {
         l2Gateway.outboundTransfer(token, address(101), 200, 0, 0, new bytes(0));
     }
 
+    function test_supportsInterface() public {
+        bytes4 iface = type(IERC165).interfaceId;
+        assertEq(l2Gateway.supportsInterface(iface), true, "Interface should be supported");
+
+        iface = GatewayMessageHandler.APPENDED_SENDER_INTERFACE_ID;
+        assertEq(l2Gateway.supportsInterface(iface), true, "Interface should be supported");
+
+        iface = bytes4(0);
+        assertEq(l2Gateway.supportsInterface(iface), false, "Interface shouldn't be supported");
+    }
+
     ////
     // Event declarations
     ////
@@ -73,6 +86,12 @@ abstract contract L2ArbitrumGatewayTest is Test {
         address indexed l1Token, address indexed _from, address indexed _receiver, uint256 _amount
     );
 
+    event DepositMessageFinalized(
+        address indexed l1Token, bytes32 indexed _messageHash, address _l2Token
+    );
+
+    event DepositHookExecuted(address indexed l1Token, address indexed _to, bool _success);
+
     event WithdrawalInitiated(
         address l1Token,
         address indexed _from,
@@ -6,8 +6,10 @@ import "forge-std/Test.sol";
 import {
     L2AtomicTokenBridgeFactory,
     L2RuntimeCode,
+    L2DeployedTemplate,
+    L2DeployedTemplates,
     ProxyAdmin,
-    BeaconProxyFactory,
+    MinimalBeaconProxyFactory,
     StandardArbERC20,
     UpgradeableBeacon,
     aeWETH
@@ -48,7 +50,7 @@ contract L2AtomicTokenBridgeFactoryTest is Test {
 
     address private constant ADDRESS_DEAD = address(0x000000000000000000000000000000000000dEaD);
 
-    function setUp() public {
+    function setUp() public virtual {
         l2Factory = new L2AtomicTokenBridgeFactory();
 
         // set templates
@@ -154,7 +156,7 @@ contract L2AtomicTokenBridgeFactoryTest is Test {
         // beacon proxy stuff
         address expectedL2BeaconProxyFactoryAddress = Create2.computeAddress(
             keccak256(abi.encodePacked(bytes("L2BPF"), block.chainid, address(this))),
-            keccak256(type(BeaconProxyFactory).creationCode),
+            keccak256(type(MinimalBeaconProxyFactory).creationCode),
             address(l2Factory)
         );
         assertEq(
@@ -179,13 +181,14 @@ contract L2AtomicTokenBridgeFactoryTest is Test {
         );
 
         assertEq(
-            UpgradeableBeacon(BeaconProxyFactory(expectedL2BeaconProxyFactoryAddress).beacon())
-                .implementation(),
+            UpgradeableBeacon(
+                MinimalBeaconProxyFactory(expectedL2BeaconProxyFactoryAddress).beacon()
+            ).implementation(),
             expectedStandardArbERC20Address,
             "Wrong implementation"
         );
         assertEq(
-            BeaconProxyFactory(expectedL2BeaconProxyFactoryAddress).beacon(),
+            MinimalBeaconProxyFactory(expectedL2BeaconProxyFactoryAddress).beacon(),
             expectedBeaconAddress,
             "Wrong beacon"
         );
@@ -469,27 +472,22 @@ contract L2AtomicTokenBridgeFactoryTest is Test {
     }
 
     function _deployL2Contracts() internal {
-        address l2StandardGatewayCanonicalAddress;
-
-        /// expected L2 standard gateway address needs to be provided to 'deployL2Contracts' call as well
-        address expectedProxyAdminAddress = Create2.computeAddress(
-            keccak256(abi.encodePacked(bytes("L2PA"), block.chainid, address(this))),
-            keccak256(type(ProxyAdmin).creationCode),
-            address(l2Factory)
-        );
-        address expectedL2ERC20GwAddress = _computeAddress(
-            keccak256(abi.encodePacked(bytes("L2SGW"), block.chainid, address(this))),
-            expectedProxyAdminAddress
-        );
-        l2StandardGatewayCanonicalAddress = expectedL2ERC20GwAddress;
+        address l2StandardGatewayCanonicalAddress = _expectedL2StandardGatewayAddress();
 
         /// do the call
+        _callDeployL2Contracts(l1WethGateway, l2StandardGatewayCanonicalAddress);
+    }
+
+    function _callDeployL2Contracts(
+        address _l1WethGateway,
+        address l2StandardGatewayCanonicalAddress
+    ) internal virtual {
         l2Factory.deployL2Contracts(
             runtimeCode,
             l1Router,
             l1StandardGateway,
             l1CustomGateway,
-            l1WethGateway,
+            _l1WethGateway,
             l1Weth,
             l2StandardGatewayCanonicalAddress,
             rollupOwner,
@@ -497,6 +495,20 @@ contract L2AtomicTokenBridgeFactoryTest is Test {
         );
     }
 
+    function _expectedL2StandardGatewayAddress() internal view returns (address) {
+        /// expected L2 standard gateway address needs to be provided to 'deployL2Contracts' call as well
+        address expectedProxyAdminAddress = Create2.computeAddress(
+            keccak256(abi.encodePacked(bytes("L2PA"), block.chainid, address(this))),
+            keccak256(type(ProxyAdmin).creationCode),
+            address(l2Factory)
+        );
+        address expectedL2ERC20GwAddress = _computeAddress(
+            keccak256(abi.encodePacked(bytes("L2SGW"), block.chainid, address(this))),
+            expectedProxyAdminAddress
+        );
+        return expectedL2ERC20GwAddress;
+    }
+
     function _computeAddress(bytes32 salt, address proxyAdmin) internal view returns (address) {
         return Create2.computeAddress(
             salt,
@@ -510,3 +522,94 @@ contract L2AtomicTokenBridgeFactoryTest is Test {
         );
     }
 }
+
+/**
+ * @dev runs all the checks of L2AtomicTokenBridgeFactoryTest with logic contracts copied from the templates
+ */
+contract L2AtomicTokenBridgeFactoryFromTemplatesTest is L2AtomicTokenBridgeFactoryTest {
+    L2DeployedTemplates public l2Templates;
+
+    function setUp() public override {
+        super.setUp();
+        l2Templates = L2DeployedTemplates(
+            L2DeployedTemplate(router, router.codehash),
+            L2DeployedTemplate(standardGateway, standardGateway.codehash),
+            L2DeployedTemplate(customGateway, customGateway.codehash),
+            L2DeployedTemplate(wethGateway, wethGateway.codehash),
+            L2DeployedTemplate(weth, weth.codehash),
+            L2DeployedTemplate(upgradeExecutor, upgradeExecutor.codehash),
+            L2DeployedTemplate(multicall, multicall.codehash)
+        );
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_deployL2ContractsFromTemplates_CreationCode() public {
+        assertEq(
+            CreationCodeHelper.getCreationCodeForDeployedCode(router),
+            CreationCodeHelper.getCreationCodeFor(router.code),
+            "Wrong creation code"
+        );
+    }
+
+    function test_deployL2ContractsFromTemplates_NoWeth() public {
+        l2Templates.wethGateway = L2DeployedTemplate(address(0), bytes32(0));
+        l2Templates.aeWeth = L2DeployedTemplate(address(0), bytes32(0));
+
+        _callDeployL2Contracts(address(0), _expectedL2StandardGatewayAddress());
+
+        address expectedProxyAdminAddress = Create2.computeAddress(
+            keccak256(abi.encodePacked(bytes("L2PA"), block.chainid, address(this))),
+            keccak256(type(ProxyAdmin).creationCode),
+            address(l2Factory)
+        );
+        address expectedL2WethGatewayAddress = _computeAddress(
+            keccak256(abi.encodePacked(bytes("L2WGW"), block.chainid, address(this))),
+            expectedProxyAdminAddress
+        );
+        assertEq(expectedL2WethGatewayAddress.code.length, 0, "WETH gateway deployed");
+    }
+
+    function test_deployL2ContractsFromTemplates_revert_InvalidTemplate() public {
+        l2Templates.customGateway.codeHash = keccak256("wrong code");
+
+        address l2StandardGatewayCanonicalAddress = _expectedL2StandardGatewayAddress();
+        vm.expectRevert(
+            abi.encodeWithSelector(
+                L2AtomicTokenBridgeFactory.L2AtomicTokenBridgeFactory_InvalidTemplate.selector,
+                customGateway
+            )
+        );
+        _callDeployL2Contracts(l1WethGateway, l2StandardGatewayCanonicalAddress);
+    }
+
+    function test_deployL2ContractsFromTemplates_revert_TemplateNotDeployed() public {
+        address notDeployed = makeAddr("notDeployed");
+        l2Templates.router = L2DeployedTemplate(notDeployed, router.codehash);
+
+        address l2StandardGatewayCanonicalAddress = _expectedL2StandardGatewayAddress();
+        vm.expectRevert(
+            abi.encodeWithSelector(
+                L2AtomicTokenBridgeFactory.L2AtomicTokenBridgeFactory_InvalidTemplate.selector,
+                notDeployed
+            )
+        );
+        _callDeployL2Contracts(l1WethGateway, l2StandardGatewayCanonicalAddress);
+    }
+
+    function _callDeployL2Contracts(
+        address _l1WethGateway,
+        address l2StandardGatewayCanonicalAddress
+    ) internal override {
+        l2Factory.deployL2ContractsFromTemplates(
+            l2Templates,
+            l1Router,
+            l1StandardGateway,
+            l1CustomGateway,
+            _l1WethGateway,
+            l1Weth,
+            l2StandardGatewayCanonicalAddress,
+            rollupOwner,
+            aliasedL1UpgradeExecutor
+        );
+    }
+}
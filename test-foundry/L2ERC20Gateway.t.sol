@@ -5,12 +5,16 @@ pragma solidity ^0.8.0;
 import "./L2ArbitrumGateway.t.sol";
 import {L2ERC20Gateway} from "contracts/tokenbridge/arbitrum/gateway/L2ERC20Gateway.sol";
 import {StandardArbERC20} from "contracts/tokenbridge/arbitrum/StandardArbERC20.sol";
+import {L1ERC20Gateway} from "contracts/tokenbridge/ethereum/gateway/L1ERC20Gateway.sol";
 import {
     BeaconProxyFactory,
-    ClonableBeaconProxy
+    ClonableBeaconProxy,
+    MinimalBeaconProxy,
+    MinimalBeaconProxyFactory
 } from "contracts/tokenbridge/libraries/ClonableBeaconProxy.sol";
 import {UpgradeableBeacon} from "@openzeppelin/contracts/proxy/beacon/UpgradeableBeacon.sol";
 import {AddressAliasHelper} from "contracts/tokenbridge/libraries/AddressAliasHelper.sol";
+import {L2DepositHookReceiver} from "contracts/tokenbridge/test/TestPostDepositCall.sol";
 
 contract L2ERC20GatewayTest is L2ArbitrumGatewayTest {
     L2ERC20Gateway public l2StandardGateway;
@@ -40,7 +44,7 @@ contract L2ERC20GatewayTest is L2ArbitrumGatewayTest {
         );
     }
 
-    function test_cloneableProxyHash() public {
+    function test_cloneableProxyHash() public virtual {
         assertEq(
             l2StandardGateway.cloneableProxyHash(),
             keccak256(type(ClonableBeaconProxy).creationCode),
@@ -100,6 +104,33 @@ contract L2ERC20GatewayTest is L2ArbitrumGatewayTest {
         );
     }
 
+    function test_finalizeInboundTransfer_Packed() public {
+        /// deposit params
+        bytes memory gatewayData = abi.encode(
+            abi.encode(bytes("Name")), abi.encode(bytes("Symbol")), abi.encode(uint256(18))
+        );
+
+        /// events
+        vm.expectEmit(true, true, true, true);
+        emit DepositFinalized(l1Token, sender, receiver, amount);
+
+        /// finalize deposit
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(l1Counterpart));
+        l2StandardGateway.finalizeInboundTransfer(
+            l1Token,
+            sender,
+            receiver,
+            amount,
+            abi.encodePacked(bytes1(0x01), uint32(gatewayData.length), gatewayData)
+        );
+
+        /// check tokens have been minted to receiver
+        StandardArbERC20 l2Token =
+            StandardArbERC20(l2StandardGateway.calculateL2TokenAddress(l1Token));
+        assertEq(l2Token.balanceOf(receiver), amount, "Invalid receiver balance");
+        assertEq(l2Token.symbol(), "Symbol", "Invalid symbol");
+    }
+
     function test_finalizeInboundTransfer_ShouldHalt() public {
         /// deposit params
         bytes memory gatewayData = abi.encode(
@@ -132,6 +163,402 @@ contract L2ERC20GatewayTest is L2ArbitrumGatewayTest {
 
         /// check L2 token hasn't been creted
         assertEq(address(notL2Token).code.length, 0, "L2 token isn't supposed to be created");
+        assertEq(l2StandardGateway.validatedL2Token(l1Token), address(0), "Token validated");
+    }
+
+    function test_finalizeInboundTransfer_ValidatedToken() public {
+        /// deposit params
+        bytes memory gatewayData = abi.encode(
+            abi.encode(bytes("Name")), abi.encode(bytes("Symbol")), abi.encode(uint256(18))
+        );
+        bytes memory callHookData = new bytes(0);
+
+        /// first deposit deploys and validates the token
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(l1Counterpart));
+        l2StandardGateway.finalizeInboundTransfer(
+            l1Token, sender, receiver, amount, abi.encode(gatewayData, callHookData)
+        );
+
+        address expectedL2Address = l2StandardGateway.calculateL2TokenAddress(l1Token);
+        assertEq(
+            l2StandardGateway.validatedL2Token(l1Token),
+            expectedL2Address,
+            "Invalid validatedL2Token"
+        );
+
+        // later deposits don't compute the L2 address again
+        vm.mockCall(
+            address(l2BeaconProxyFactory),
+            abi.encodeWithSignature(
+                "calculateExpectedAddress(address,bytes32)",
+                address(l2StandardGateway),
+                l2StandardGateway.getUserSalt(l1Token)
+            ),
+            abi.encode(makeAddr("notL2Token"))
+        );
+
+        vm.expectEmit(true, true, true, true);
+        emit DepositFinalized(l1Token, sender, receiver, amount);
+
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(l1Counterpart));
+        l2StandardGateway.finalizeInboundTransfer(
+            l1Token, sender, receiver, amount, abi.encode(bytes(""), callHookData)
+        );
+
+        assertEq(
+            StandardArbERC20(expectedL2Address).balanceOf(receiver),
+            amount * 2,
+            "Invalid receiver balance"
+        );
+    }
+
+    function test_finalizeInboundTransferBatch() public {
+        /// deposit params
+        address l1Token2 = makeAddr("l1Token2");
+        address[] memory tokens = new address[](2);
+        tokens[0] = l1Token;
+        tokens[1] = l1Token2;
+        address[] memory to = new address[](2);
+        to[0] = receiver;
+        to[1] = sender;
+        uint256[] memory amounts = new uint256[](2);
+        amounts[0] = amount;
+        amounts[1] = 7;
+        bytes[] memory data = new bytes[](2);
+        data[0] = abi.encode(
+            abi.encode(abi.encode(bytes("Name")), abi.encode(bytes("Symbol")), abi.encode(18)),
+            ""
+        );
+        data[1] = abi.encode(
+            abi.encode(abi.encode(bytes("Name2")), abi.encode(bytes("Sym2")), abi.encode(6)),
+            ""
+        );
+
+        /// events
+        vm.expectEmit(true, true, true, true);
+        emit DepositFinalized(l1Token, sender, receiver, amount);
+        vm.expectEmit(true, true, true, true);
+        emit DepositFinalized(l1Token2, sender, sender, 7);
+
+        /// finalize deposit
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(l1Counterpart));
+        l2StandardGateway.finalizeInboundTransferBatch(tokens, sender, to, amounts, data);
+
+        /// check both tokens have been deployed and minted
+        StandardArbERC20 l2Token = StandardArbERC20(l2StandardGateway.calculateL2TokenAddress(l1Token));
+        assertEq(l2Token.balanceOf(receiver), amount, "Invalid receiver balance");
+
+        StandardArbERC20 l2Token2 =
+            StandardArbERC20(l2StandardGateway.calculateL2TokenAddress(l1Token2));
+        assertEq(l2Token2.balanceOf(sender), 7, "Invalid sender balance");
+        assertEq(l2Token2.decimals(), 6, "Invalid decimals");
+    }
+
+    function test_finalizeInboundTransfer_DepositMessageFinalized() public {
+        bytes memory gatewayData = abi.encode(
+            abi.encode(bytes("Name")), abi.encode(bytes("Symbol")), abi.encode(uint256(18))
+        );
+        // retryable calldata, as built by the L1 gateway
+        bytes memory message = abi.encodeWithSelector(
+            ITokenGateway.finalizeInboundTransfer.selector,
+            l1Token,
+            sender,
+            receiver,
+            amount,
+            abi.encode(gatewayData, bytes(""))
+        );
+
+        vm.expectEmit(true, true, true, true);
+        emit DepositMessageFinalized(
+            l1Token, keccak256(message), l2StandardGateway.calculateL2TokenAddress(l1Token)
+        );
+
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(l1Counterpart));
+        (bool success,) = address(l2StandardGateway).call(message);
+        assertTrue(success, "Deposit failed");
+    }
+
+    function test_finalizeInboundTransfer_DepositHook() public {
+        L2DepositHookReceiver hookReceiver = new L2DepositHookReceiver();
+        address l2Token = l2StandardGateway.calculateL2TokenAddress(l1Token);
+        bytes memory hookData = abi.encode(uint256(5));
+
+        /// events
+        vm.expectEmit(true, true, true, true, address(hookReceiver));
+        emit DepositHookCalled(l1Token, l2Token, sender, amount, amount, hookData);
+        vm.expectEmit(true, true, true, true, address(l2StandardGateway));
+        emit DepositHookExecuted(l1Token, address(hookReceiver), true);
+
+        /// finalize deposit
+        _finalizeDepositWithHook(address(hookReceiver), 100_000, hookData);
+        assertEq(
+            StandardArbERC20(l2Token).balanceOf(address(hookReceiver)),
+            amount,
+            "Invalid receiver balance"
+        );
+    }
+
+    function test_finalizeInboundTransfer_DepositHookReverts() public {
+        L2DepositHookReceiver hookReceiver = new L2DepositHookReceiver();
+
+        vm.expectEmit(true, true, true, true, address(l2StandardGateway));
+        emit DepositHookExecuted(l1Token, address(hookReceiver), false);
+        _finalizeDepositWithHook(address(hookReceiver), 100_000, abi.encode(uint256(7)));
+
+        // tokens stay credited to the receiver
+        address l2Token = l2StandardGateway.calculateL2TokenAddress(l1Token);
+        assertEq(
+            StandardArbERC20(l2Token).balanceOf(address(hookReceiver)),
+            amount,
+            "Invalid receiver balance"
+        );
+    }
+
+    function test_finalizeInboundTransfer_DepositHookOutOfGas() public {
+        L2DepositHookReceiver hookReceiver = new L2DepositHookReceiver();
+
+        vm.expectEmit(true, true, true, true, address(l2StandardGateway));
+        emit DepositHookExecuted(l1Token, address(hookReceiver), false);
+        _finalizeDepositWithHook(address(hookReceiver), 100_000, abi.encode(uint256(9)));
+
+        address l2Token = l2StandardGateway.calculateL2TokenAddress(l1Token);
+        assertEq(
+            StandardArbERC20(l2Token).balanceOf(address(hookReceiver)),
+            amount,
+            "Invalid receiver balance"
+        );
+    }
+
+    function test_finalizeInboundTransfer_DepositHookNoCode() public {
+        vm.expectEmit(true, true, true, true, address(l2StandardGateway));
+        emit DepositHookExecuted(l1Token, receiver, false);
+        _finalizeDepositWithHook(receiver, 100_000, abi.encode(uint256(5)));
+
+        address l2Token = l2StandardGateway.calculateL2TokenAddress(l1Token);
+        assertEq(StandardArbERC20(l2Token).balanceOf(receiver), amount, "Invalid receiver balance");
+    }
+
+    function test_finalizeInboundTransfer_revert_InsufficientHookGas() public {
+        L2DepositHookReceiver hookReceiver = new L2DepositHookReceiver();
+
+        // redeem has to be retried with enough gas for the hook
+        vm.expectRevert("INSUFFICIENT_HOOK_GAS");
+        _finalizeDepositWithHook(address(hookReceiver), type(uint64).max, abi.encode(uint256(5)));
+    }
+
+    function test_finalizeInboundTransferBatch_DepositMessageFinalized() public {
+        address l1Token2 = makeAddr("l1Token2");
+        address[] memory tokens = new address[](2);
+        tokens[0] = l1Token;
+        tokens[1] = l1Token2;
+        address[] memory to = new address[](2);
+        to[0] = receiver;
+        to[1] = sender;
+        uint256[] memory amounts = new uint256[](2);
+        amounts[0] = amount;
+        amounts[1] = 7;
+        bytes[] memory data = new bytes[](2);
+        data[0] = abi.encode(
+            abi.encode(abi.encode(bytes("Name")), abi.encode(bytes("Symbol")), abi.encode(18)),
+            ""
+        );
+        data[1] = abi.encode(
+            abi.encode(abi.encode(bytes("Name2")), abi.encode(bytes("Sym2")), abi.encode(6)),
+            ""
+        );
+        bytes memory message = abi.encodeWithSelector(
+            L2ArbitrumGateway.finalizeInboundTransferBatch.selector,
+            tokens,
+            sender,
+            to,
+            amounts,
+            data
+        );
+
+        // tokens of the batch share the message hash
+        vm.expectEmit(true, true, true, true);
+        emit DepositMessageFinalized(
+            l1Token, keccak256(message), l2StandardGateway.calculateL2TokenAddress(l1Token)
+        );
+        vm.expectEmit(true, true, true, true);
+        emit DepositMessageFinalized(
+            l1Token2, keccak256(message), l2StandardGateway.calculateL2TokenAddress(l1Token2)
+        );
+
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(l1Counterpart));
+        (bool success,) = address(l2StandardGateway).call(message);
+        assertTrue(success, "Deposit failed");
+    }
+
+    function test_finalizeInboundTransferBatch_revert_WrongLength() public {
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(l1Counterpart));
+        vm.expectRevert("WRONG_LENGTH");
+        l2StandardGateway.finalizeInboundTransferBatch(
+            new address[](2), sender, new address[](2), new uint256[](2), new bytes[](1)
+        );
+    }
+
+    function test_finalizeInboundTransferBatch_revert_OnlyCounterpart() public {
+        vm.expectRevert("ONLY_COUNTERPART_GATEWAY");
+        l2StandardGateway.finalizeInboundTransferBatch(
+            new address[](1), sender, new address[](1), new uint256[](1), new bytes[](1)
+        );
+    }
+
+    function test_reportDeployedTokens() public {
+        // create and init standard l2Token
+        bytes32 salt = keccak256(abi.encode(l1Token));
+        vm.startPrank(address(l2Gateway));
+        address l2Token = BeaconProxyFactory(l2BeaconProxyFactory).createProxy(salt);
+        StandardArbERC20(l2Token).bridgeInit(
+            l1Token,
+            abi.encode(
+                abi.encode(bytes("Name")), abi.encode(bytes("Symbol")), abi.encode(uint256(18))
+            )
+        );
+        vm.stopPrank();
+
+        address[] memory tokens = new address[](1);
+        tokens[0] = l1Token;
+
+        // events
+        vm.expectEmit(true, true, true, true);
+        emit TxToL1(
+            sender,
+            l1Counterpart,
+            0,
+            abi.encodeWithSelector(L1ERC20Gateway.confirmL2TokenDeployments.selector, tokens)
+        );
+
+        // report
+        vm.etch(0x0000000000000000000000000000000000000064, address(arbSysMock).code);
+        vm.prank(sender);
+        l2StandardGateway.reportDeployedTokens(tokens);
+    }
+
+    function test_reportDeployedTokens_revert_TokenNotDeployed() public {
+        address[] memory tokens = new address[](1);
+        tokens[0] = l1Token;
+
+        vm.expectRevert("TOKEN_NOT_DEPLOYED");
+        l2StandardGateway.reportDeployedTokens(tokens);
+    }
+
+    function test_queueWithdrawal() public {
+        address l2Token = _deployStandardToken();
+        deal(l2Token, sender, 100 ether);
+
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawalQueued(l1Token, sender, receiver, 0, amount);
+
+        vm.prank(sender);
+        uint256 queuedExitNum = l2StandardGateway.queueWithdrawal(l1Token, receiver, amount);
+
+        assertEq(queuedExitNum, 0, "Invalid exitNum");
+        assertEq(l2StandardGateway.exitNum(), 1, "Invalid exitNum counter");
+        assertEq(StandardArbERC20(l2Token).balanceOf(sender), 100 ether - amount, "Invalid balance");
+        assertEq(l2StandardGateway.queuedWithdrawalsCount(l1Token), 1, "Invalid queue length");
+
+        (address from, uint96 exitNum, address to, uint256 queuedAmount) =
+            l2StandardGateway.withdrawalQueue(l1Token, 0);
+        assertEq(from, sender, "Invalid from");
+        assertEq(exitNum, 0, "Invalid queued exitNum");
+        assertEq(to, receiver, "Invalid to");
+        assertEq(queuedAmount, amount, "Invalid amount");
+    }
+
+    function test_queueWithdrawal_revert_TokenNotDeployed() public {
+        vm.expectRevert("TOKEN_NOT_DEPLOYED");
+        l2StandardGateway.queueWithdrawal(l1Token, receiver, amount);
+    }
+
+    function test_flushWithdrawals() public {
+        address l2Token = _deployStandardToken();
+        deal(l2Token, sender, 100 ether);
+
+        address otherReceiver = makeAddr("otherReceiver");
+        vm.startPrank(sender);
+        l2StandardGateway.queueWithdrawal(l1Token, receiver, amount);
+        l2StandardGateway.queueWithdrawal(l1Token, otherReceiver, amount * 2);
+        l2StandardGateway.queueWithdrawal(l1Token, receiver, amount * 3);
+        vm.stopPrank();
+
+        // the oldest 2 withdrawals are sent
+        address[] memory from = new address[](2);
+        from[0] = sender;
+        from[1] = sender;
+        address[] memory to = new address[](2);
+        to[0] = receiver;
+        to[1] = otherReceiver;
+        uint256[] memory amounts = new uint256[](2);
+        amounts[0] = amount;
+        amounts[1] = amount * 2;
+        uint256[] memory exitNums = new uint256[](2);
+        exitNums[0] = 0;
+        exitNums[1] = 1;
+
+        // events
+        uint256 expectedId = 0;
+        vm.expectEmit(true, true, true, true);
+        emit TxToL1(
+            address(this),
+            l1Counterpart,
+            expectedId,
+            abi.encodeWithSelector(
+                L1ERC20Gateway.finalizeWithdrawalBatch.selector,
+                l1Token,
+                from,
+                to,
+                amounts,
+                exitNums
+            )
+        );
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawalInitiated(l1Token, sender, receiver, expectedId, 0, amount);
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawalInitiated(l1Token, sender, otherReceiver, expectedId, 1, amount * 2);
+
+        // flush
+        vm.etch(0x0000000000000000000000000000000000000064, address(arbSysMock).code);
+        uint256 id = l2StandardGateway.flushWithdrawals(l1Token, 2);
+
+        assertEq(id, expectedId, "Invalid id");
+        assertEq(l2StandardGateway.queuedWithdrawalsCount(l1Token), 1, "Invalid queue length");
+        assertEq(l2StandardGateway.withdrawalQueueHead(l1Token), 2, "Invalid queue head");
+        assertEq(l2StandardGateway.exitNum(), 3, "Invalid exitNum counter");
+    }
+
+    function test_flushWithdrawals_OldestFirst() public {
+        address l2Token = _deployStandardToken();
+        deal(l2Token, sender, 100 ether);
+
+        vm.prank(sender);
+        l2StandardGateway.queueWithdrawal(l1Token, receiver, amount);
+
+        // withdrawals queued after the first flush don't overtake the remaining ones
+        vm.etch(0x0000000000000000000000000000000000000064, address(arbSysMock).code);
+        vm.startPrank(sender);
+        l2StandardGateway.queueWithdrawal(l1Token, receiver, amount * 2);
+        l2StandardGateway.flushWithdrawals(l1Token, 1);
+        l2StandardGateway.queueWithdrawal(l1Token, receiver, amount * 3);
+        vm.stopPrank();
+
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawalInitiated(l1Token, sender, receiver, 1, 1, amount * 2);
+        l2StandardGateway.flushWithdrawals(l1Token, 1);
+
+        vm.expectEmit(true, true, true, true);
+        emit WithdrawalInitiated(l1Token, sender, receiver, 2, 2, amount * 3);
+        l2StandardGateway.flushWithdrawals(l1Token, 10);
+
+        assertEq(l2StandardGateway.queuedWithdrawalsCount(l1Token), 0, "Invalid queue length");
+        vm.expectRevert("NO_QUEUED_WITHDRAWALS");
+        l2StandardGateway.flushWithdrawals(l1Token, 10);
+    }
+
+    function test_flushWithdrawals_revert_NoQueuedWithdrawals() public {
+        vm.expectRevert("NO_QUEUED_WITHDRAWALS");
+        l2StandardGateway.flushWithdrawals(l1Token, 10);
     }
 
     function test_getUserSalt() public {
@@ -268,4 +695,146 @@ contract L2ERC20GatewayTest is L2ArbitrumGatewayTest {
         vm.expectRevert("NOT_EXPECTED_L1_TOKEN");
         l2Gateway.outboundTransfer(l1Token, address(101), 200, 0, 0, new bytes(0));
     }
+
+    ////
+    // Helper functions
+    ////
+    function _finalizeDepositWithHook(address to, uint256 hookGasLimit, bytes memory hookData)
+        internal
+    {
+        bytes memory gatewayData = abi.encode(
+            abi.encode(bytes("Name")), abi.encode(bytes("Symbol")), abi.encode(uint256(18))
+        );
+        bytes memory callHookData = abi.encodePacked(bytes1(0x02), hookGasLimit, hookData);
+
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(l1Counterpart));
+        l2StandardGateway.finalizeInboundTransfer(
+            l1Token, sender, to, amount, abi.encode(gatewayData, callHookData)
+        );
+    }
+
+    function _deployStandardToken() internal returns (address l2Token) {
+        bytes32 salt = keccak256(abi.encode(l1Token));
+        vm.startPrank(address(l2Gateway));
+        l2Token = BeaconProxyFactory(l2BeaconProxyFactory).createProxy(salt);
+        StandardArbERC20(l2Token).bridgeInit(
+            l1Token,
+            abi.encode(
+                abi.encode(bytes("Name")), abi.encode(bytes("Symbol")), abi.encode(uint256(18))
+            )
+        );
+        vm.stopPrank();
+    }
+
+    ////
+    // Event declarations
+    ////
+    event DepositHookCalled(
+        address l1Token,
+        address l2Token,
+        address from,
+        uint256 amount,
+        uint256 balance,
+        bytes data
+    );
+
+    event WithdrawalQueued(
+        address l1Token,
+        address indexed _from,
+        address indexed _to,
+        uint256 indexed _exitNum,
+        uint256 _amount
+    );
+}
+
+/**
+ * @dev runs the L2ERC20Gateway tests with tokens deployed by MinimalBeaconProxyFactory
+ */
+contract L2ERC20GatewayMinimalBeaconProxyTest is L2ERC20GatewayTest {
+    UpgradeableBeacon public beacon;
+
+    function setUp() public override {
+        l2StandardGateway = new L2ERC20Gateway();
+        l2Gateway = L2ArbitrumGateway(address(l2StandardGateway));
+
+        // create beacon
+        beacon = new UpgradeableBeacon(address(new StandardArbERC20()));
+        l2BeaconProxyFactory = address(new MinimalBeaconProxyFactory());
+        MinimalBeaconProxyFactory(l2BeaconProxyFactory).initialize(address(beacon));
+
+        L2ERC20Gateway(l2StandardGateway).initialize(l1Counterpart, router, l2BeaconProxyFactory);
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_cloneableProxyHash() public override {
+        assertEq(
+            l2StandardGateway.cloneableProxyHash(),
+            keccak256(type(MinimalBeaconProxy).creationCode),
+            "Invalid proxy hash"
+        );
+    }
+
+    function test_finalizeInboundTransfer_MatchesL1Address() public {
+        L1ERC20Gateway l1StandardGateway = new L1ERC20Gateway();
+        l1StandardGateway.initialize(
+            address(l2StandardGateway),
+            makeAddr("l1Router"),
+            makeAddr("inbox"),
+            l2StandardGateway.cloneableProxyHash(),
+            l2BeaconProxyFactory
+        );
+
+        bytes memory gatewayData = abi.encode(
+            abi.encode(bytes("Name")), abi.encode(bytes("Symbol")), abi.encode(uint256(18))
+        );
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(l1Counterpart));
+        l2StandardGateway.finalizeInboundTransfer(
+            l1Token, sender, receiver, amount, abi.encode(gatewayData, bytes(""))
+        );
+
+        address l2Token = l1StandardGateway.calculateL2TokenAddress(l1Token);
+        assertGt(l2Token.code.length, 0, "Token not deployed at the L1 computed address");
+        assertEq(StandardArbERC20(l2Token).balanceOf(receiver), amount, "Invalid receiver balance");
+        assertEq(StandardArbERC20(l2Token).l1Address(), l1Token, "Invalid l1Address");
+    }
+
+    function test_finalizeInboundTransfer_BeaconUpgrade() public {
+        bytes memory gatewayData = abi.encode(
+            abi.encode(bytes("Name")), abi.encode(bytes("Symbol")), abi.encode(uint256(18))
+        );
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(l1Counterpart));
+        l2StandardGateway.finalizeInboundTransfer(
+            l1Token, sender, receiver, amount, abi.encode(gatewayData, bytes(""))
+        );
+        address l2Token = l2StandardGateway.calculateL2TokenAddress(l1Token);
+
+        // upgrades apply to deployed tokens right away
+        beacon.upgradeTo(address(new UpgradedArbERC20()));
+        assertEq(UpgradedArbERC20(l2Token).version(), 2, "Upgrade not applied");
+        assertEq(StandardArbERC20(l2Token).balanceOf(receiver), amount, "Invalid receiver balance");
+    }
+
+    function test_finalizeInboundTransfer_NoStorageWritten() public {
+        bytes memory gatewayData = abi.encode(
+            abi.encode(bytes("Name")), abi.encode(bytes("Symbol")), abi.encode(uint256(18))
+        );
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(l1Counterpart));
+        l2StandardGateway.finalizeInboundTransfer(
+            l1Token, sender, receiver, amount, abi.encode(gatewayData, bytes(""))
+        );
+
+        // ERC1967 beacon slot
+        bytes32 beaconSlot = 0xa3f0ad74e5423aebfd80d3ef4346578335a9a72aeaee59ff6cb3582b35133d50;
+        assertEq(
+            vm.load(l2StandardGateway.calculateL2TokenAddress(l1Token), beaconSlot),
+            bytes32(0),
+            "Beacon stored"
+        );
+    }
+}
+
+contract UpgradedArbERC20 is StandardArbERC20 {
+    function version() external pure returns (uint256) {
+        return 2;
+    }
 }
@@ -10,6 +10,9 @@ import {StandardArbERC20} from "contracts/tokenbridge/arbitrum/StandardArbERC20.
 import {BeaconProxyFactory} from "contracts/tokenbridge/libraries/ClonableBeaconProxy.sol";
 import {UpgradeableBeacon} from "@openzeppelin/contracts/proxy/beacon/UpgradeableBeacon.sol";
 import {ArbSysMock} from "contracts/tokenbridge/test/ArbSysMock.sol";
+import {GatewayMessageHandler} from "contracts/tokenbridge/libraries/gateway/GatewayMessageHandler.sol";
+import {ITokenGateway} from "contracts/tokenbridge/libraries/gateway/ITokenGateway.sol";
+import {IERC165} from "contracts/tokenbridge/libraries/IERC165.sol";
 
 contract L2GatewayRouterTest is GatewayRouterTest {
     L2GatewayRouter public l2Router;
@@ -81,6 +84,99 @@ contract L2GatewayRouterTest is GatewayRouterTest {
         l2Router.outboundTransfer(l1Token, to, amount, data);
     }
 
+    function test_outboundTransfer_AppendedSender() public {
+        address l1Token = makeAddr("l1Token");
+        address l2Token = _deployStandardToken(l1Token);
+        deal(l2Token, user, 100 ether);
+
+        // withdrawal params, packed user data without call hook data
+        address to = makeAddr("to");
+        uint256 amount = 2400;
+        bytes memory data = abi.encodePacked(GatewayMessageHandler.PACKED_MSG_VERSION);
+
+        // sender is appended to the gateway call instead of being abi encoded with the data
+        vm.expectCall(
+            defaultGateway,
+            abi.encodePacked(
+                abi.encodeWithSelector(
+                    ITokenGateway.outboundTransfer.selector, l1Token, to, amount, 0, 0, data
+                ),
+                user
+            )
+        );
+        vm.expectEmit(true, true, true, true);
+        emit TransferRouted(l1Token, user, to, defaultGateway);
+
+        // withdraw
+        vm.etch(0x0000000000000000000000000000000000000064, address(arbSysMock).code);
+        vm.prank(user);
+        l2Router.outboundTransfer(l1Token, to, amount, data);
+
+        assertEq(StandardArbERC20(l2Token).balanceOf(user), 100 ether - amount, "Not burned");
+    }
+
+    function test_outboundTransfer_PackedToGatewayWithoutAppendedSender() public {
+        address l1Token = makeAddr("l1Token");
+        address l2Token = _deployStandardToken(l1Token);
+        deal(l2Token, user, 100 ether);
+
+        // gateway doesn't advertise the appended sender convention when it is set
+        vm.mockCall(
+            defaultGateway,
+            abi.encodeWithSelector(
+                IERC165.supportsInterface.selector,
+                GatewayMessageHandler.APPENDED_SENDER_INTERFACE_ID
+            ),
+            abi.encode(false)
+        );
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(counterpartGateway));
+        l2Router.setDefaultGateway(defaultGateway);
+        vm.clearMockedCalls();
+
+        address to = makeAddr("to");
+        uint256 amount = 2400;
+        bytes memory data = abi.encodePacked(GatewayMessageHandler.PACKED_MSG_VERSION);
+
+        // so the router encodes the sender with the user data instead
+        vm.expectCall(
+            defaultGateway,
+            abi.encodeWithSelector(
+                ITokenGateway.outboundTransfer.selector,
+                l1Token,
+                to,
+                amount,
+                0,
+                0,
+                abi.encodePacked(GatewayMessageHandler.PACKED_MSG_VERSION, user, data)
+            )
+        );
+        vm.expectEmit(true, true, true, true);
+        emit TransferRouted(l1Token, user, to, defaultGateway);
+
+        // withdraw
+        vm.etch(0x0000000000000000000000000000000000000064, address(arbSysMock).code);
+        vm.prank(user);
+        l2Router.outboundTransfer(l1Token, to, amount, data);
+
+        assertEq(StandardArbERC20(l2Token).balanceOf(user), 100 ether - amount, "Not burned");
+    }
+
+    function test_outboundTransfer_revert_AppendedSenderExtraData() public {
+        address l1Token = makeAddr("l1Token");
+        address l2Token = _deployStandardToken(l1Token);
+        deal(l2Token, user, 100 ether);
+
+        vm.etch(0x0000000000000000000000000000000000000064, address(arbSysMock).code);
+        vm.prank(user);
+        vm.expectRevert("EXTRA_DATA_DISABLED");
+        l2Router.outboundTransfer(
+            l1Token,
+            makeAddr("to"),
+            2400,
+            abi.encodePacked(GatewayMessageHandler.PACKED_MSG_VERSION, bytes("hook"))
+        );
+    }
+
     function test_setDefaultGateway() public {
         address newDefaultGateway = makeAddr("newDefaultGateway");
 
@@ -113,6 +209,21 @@ contract L2GatewayRouterTest is GatewayRouterTest {
         assertEq(l2Router.l1TokenToGateway(tokens[0]), gateways[0], "Gateway[0] not set");
     }
 
+    function test_setGateway_GatewayDeployedAfterRegistration() public {
+        address[] memory tokens = new address[](1);
+        tokens[0] = makeAddr("l1Token");
+        address[] memory gateways = new address[](1);
+        gateways[0] = makeAddr("gateway");
+
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(counterpartGateway));
+        l2Router.setGateway(tokens, gateways);
+        assertEq(l2Router.getGateway(tokens[0]), address(0), "Gateway without code returned");
+
+        // the gateway is checked again once deployed
+        vm.etch(gateways[0], address(defaultGateway).code);
+        assertEq(l2Router.getGateway(tokens[0]), gateways[0], "Deployed gateway not returned");
+    }
+
     function test_setGateway_revert_OnlyCounterpart() public {
         vm.expectRevert("ONLY_COUNTERPART_GATEWAY");
         l2Router.setGateway(new address[](1), new address[](1));
@@ -124,6 +235,22 @@ contract L2GatewayRouterTest is GatewayRouterTest {
         l2Router.setGateway(new address[](1), new address[](2));
     }
 
+    ////
+    // Helper functions
+    ////
+    function _deployStandardToken(address l1Token) internal returns (address l2Token) {
+        vm.startPrank(defaultGateway);
+        l2Token =
+            BeaconProxyFactory(beaconProxyFactory).createProxy(keccak256(abi.encode(l1Token)));
+        StandardArbERC20(l2Token).bridgeInit(
+            l1Token,
+            abi.encode(
+                abi.encode(bytes("Name")), abi.encode(bytes("Symbol")), abi.encode(uint256(18))
+            )
+        );
+        vm.stopPrank();
+    }
+
     ////
     // Event declarations
     ////
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "forge-std/Test.sol";
+import {L2TokenAddress} from "contracts/tokenbridge/libraries/L2TokenAddress.sol";
+import {
+    BeaconProxyFactory,
+    ClonableBeaconProxy
+} from "contracts/tokenbridge/libraries/ClonableBeaconProxy.sol";
+import {L1ERC20Gateway} from "contracts/tokenbridge/ethereum/gateway/L1ERC20Gateway.sol";
+import {L2ERC20Gateway} from "contracts/tokenbridge/arbitrum/gateway/L2ERC20Gateway.sol";
+import {StandardArbERC20} from "contracts/tokenbridge/arbitrum/StandardArbERC20.sol";
+import {UpgradeableBeacon} from "@openzeppelin/contracts/proxy/beacon/UpgradeableBeacon.sol";
+import {Create2} from "@openzeppelin/contracts/utils/Create2.sol";
+
+contract L2TokenAddressTest is Test {
+    BeaconProxyFactory public beaconProxyFactory;
+    address public l2Gateway = makeAddr("l2Gateway");
+
+    function setUp() public {
+        UpgradeableBeacon beacon = new UpgradeableBeacon(address(new StandardArbERC20()));
+        beaconProxyFactory = new BeaconProxyFactory();
+        beaconProxyFactory.initialize(address(beacon));
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_getUserSalt(address l1Token) public {
+        assertEq(
+            L2TokenAddress.getUserSalt(l1Token), keccak256(abi.encode(l1Token)), "Invalid user salt"
+        );
+    }
+
+    function test_getSalt(address gateway, bytes32 userSalt) public {
+        assertEq(
+            L2TokenAddress.getSalt(gateway, userSalt),
+            keccak256(abi.encode(gateway, userSalt)),
+            "Invalid salt"
+        );
+    }
+
+    function test_computeAddress(address deployer, bytes32 salt, bytes32 codeHash) public {
+        assertEq(
+            L2TokenAddress.computeAddress(deployer, salt, codeHash),
+            Create2.computeAddress(salt, codeHash, deployer),
+            "Invalid address"
+        );
+    }
+
+    function test_computeAddress_DirtyAddressBits(address deployer, address l1Token) public {
+        address dirtyDeployer;
+        address dirtyL1Token;
+        assembly {
+            dirtyDeployer := or(shl(160, 0xabcdef), deployer)
+            dirtyL1Token := or(shl(200, 0x123456), l1Token)
+        }
+
+        assertEq(
+            L2TokenAddress.calculateL2TokenAddress(
+                dirtyDeployer, bytes32(0), l2Gateway, dirtyL1Token
+            ),
+            L2TokenAddress.calculateL2TokenAddress(deployer, bytes32(0), l2Gateway, l1Token),
+            "Upper bits not cleaned"
+        );
+    }
+
+    function test_calculateL2TokenAddress_NoMemoryAllocated(address l1Token) public {
+        uint256 freeMemoryPointerBefore;
+        assembly {
+            freeMemoryPointerBefore := mload(0x40)
+        }
+
+        L2TokenAddress.calculateL2TokenAddress(
+            address(beaconProxyFactory), bytes32(0), l2Gateway, l1Token
+        );
+
+        uint256 freeMemoryPointerAfter;
+        assembly {
+            freeMemoryPointerAfter := mload(0x40)
+        }
+        assertEq(freeMemoryPointerAfter, freeMemoryPointerBefore, "Memory allocated");
+    }
+
+    function test_calculateL2TokenAddress_MatchesPreviousDerivation(address l1Token) public {
+        bytes32 salt = keccak256(abi.encode(l2Gateway, keccak256(abi.encode(l1Token))));
+        address expected = Create2.computeAddress(
+            salt, keccak256(type(ClonableBeaconProxy).creationCode), address(beaconProxyFactory)
+        );
+
+        assertEq(
+            L2TokenAddress.calculateL2TokenAddress(
+                address(beaconProxyFactory),
+                beaconProxyFactory.cloneableProxyHash(),
+                l2Gateway,
+                l1Token
+            ),
+            expected,
+            "Invalid L2 token address"
+        );
+    }
+
+    function test_calculateL2TokenAddress_MatchesDeployment(address l1Token) public {
+        vm.prank(l2Gateway);
+        address created = beaconProxyFactory.createProxy(L2TokenAddress.getUserSalt(l1Token));
+
+        assertEq(
+            L2TokenAddress.calculateL2TokenAddress(
+                address(beaconProxyFactory),
+                beaconProxyFactory.cloneableProxyHash(),
+                l2Gateway,
+                l1Token
+            ),
+            created,
+            "Invalid L2 token address"
+        );
+    }
+
+    function test_calculateL2TokenAddress_L1AndL2GatewaysMatch(address l1Token) public {
+        L2ERC20Gateway l2StandardGateway = new L2ERC20Gateway();
+        L1ERC20Gateway l1StandardGateway = new L1ERC20Gateway();
+
+        l1StandardGateway.initialize(
+            address(l2StandardGateway),
+            makeAddr("l1Router"),
+            makeAddr("inbox"),
+            beaconProxyFactory.cloneableProxyHash(),
+            address(beaconProxyFactory)
+        );
+        l2StandardGateway.initialize(
+            address(l1StandardGateway), makeAddr("l2Router"), address(beaconProxyFactory)
+        );
+
+        address l2TokenAddress = l2StandardGateway.calculateL2TokenAddress(l1Token);
+        assertEq(
+            l1StandardGateway.calculateL2TokenAddress(l1Token),
+            l2TokenAddress,
+            "L1 and L2 gateways don't match"
+        );
+        assertEq(
+            beaconProxyFactory.calculateExpectedAddress(
+                address(l2StandardGateway), keccak256(abi.encode(l1Token))
+            ),
+            l2TokenAddress,
+            "Factory doesn't match"
+        );
+    }
+}
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "forge-std/Test.sol";
+import {Multicall2, ArbMulticall2} from "contracts/rpc-utils/MulticallV2.sol";
+
+contract MulticallV2Test is Test {
+    Multicall2 public multicall;
+    ArbMulticall2 public arbMulticall;
+    MulticallTarget public target;
+
+    function setUp() public {
+        multicall = new Multicall2();
+        arbMulticall = new ArbMulticall2();
+        target = new MulticallTarget();
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_aggregate3() public {
+        Multicall2.Call3[] memory calls = new Multicall2.Call3[](3);
+        calls[0] = Multicall2.Call3(
+            address(target), false, 0, abi.encodeWithSelector(MulticallTarget.value.selector)
+        );
+        calls[1] = Multicall2.Call3(
+            address(target), true, 0, abi.encodeWithSelector(MulticallTarget.fail.selector)
+        );
+        calls[2] = Multicall2.Call3(
+            address(target), true, 50_000, abi.encodeWithSelector(MulticallTarget.burn.selector)
+        );
+
+        Multicall2.Result[] memory results = multicall.aggregate3(calls);
+
+        assertEq(results.length, 3, "Invalid results length");
+        assertTrue(results[0].success, "Call 0 should succeed");
+        assertEq(abi.decode(results[0].returnData, (uint256)), 42, "Invalid return data");
+        assertFalse(results[1].success, "Call 1 should fail");
+        assertEq(
+            results[1].returnData,
+            abi.encodeWithSignature("Error(string)", "FAIL"),
+            "Invalid revert data"
+        );
+        // the gas cap stops the call instead of consuming the whole batch
+        assertFalse(results[2].success, "Call 2 should run out of gas");
+    }
+
+    function test_aggregate3_revert_CallFailed() public {
+        Multicall2.Call3[] memory calls = new Multicall2.Call3[](2);
+        calls[0] = Multicall2.Call3(
+            address(target), true, 0, abi.encodeWithSelector(MulticallTarget.fail.selector)
+        );
+        calls[1] = Multicall2.Call3(
+            address(target), false, 0, abi.encodeWithSelector(MulticallTarget.fail.selector)
+        );
+
+        vm.expectRevert("Multicall2 aggregate: call failed");
+        multicall.aggregate3(calls);
+    }
+
+    function test_aggregate3_ArbMulticall2() public {
+        ArbMulticall2.Call3[] memory calls = new ArbMulticall2.Call3[](2);
+        calls[0] = ArbMulticall2.Call3(
+            address(target), false, 30_000, abi.encodeWithSelector(MulticallTarget.value.selector)
+        );
+        calls[1] = ArbMulticall2.Call3(
+            address(target), true, 50_000, abi.encodeWithSelector(MulticallTarget.burn.selector)
+        );
+
+        ArbMulticall2.Result[] memory results = arbMulticall.aggregate3(calls);
+
+        assertTrue(results[0].success, "Call 0 should succeed");
+        assertEq(abi.decode(results[0].returnData, (uint256)), 42, "Invalid return data");
+        assertFalse(results[1].success, "Call 1 should run out of gas");
+    }
+
+    function test_aggregate3_revert_ArbMulticall2CallFailed() public {
+        ArbMulticall2.Call3[] memory calls = new ArbMulticall2.Call3[](1);
+        calls[0] = ArbMulticall2.Call3(
+            address(target), false, 0, abi.encodeWithSelector(MulticallTarget.fail.selector)
+        );
+
+        vm.expectRevert("Multicall2 aggregate: call failed");
+        arbMulticall.aggregate3(calls);
+    }
+}
+
+contract MulticallTarget {
+    uint256 public counter;
+
+    function value() external pure returns (uint256) {
+        return 42;
+    }
+
+    function fail() external pure {
+        revert("FAIL");
+    }
+
+    function burn() external {
+        while (true) {
+            counter++;
+        }
+    }
+}
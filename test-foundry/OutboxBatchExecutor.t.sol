@@ -0,0 +1,238 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "forge-std/Test.sol";
+import {OutboxBatchExecutor} from "contracts/tokenbridge/ethereum/OutboxBatchExecutor.sol";
+import {IOutbox} from "@arbitrum/nitro-contracts/src/bridge/IOutbox.sol";
+
+contract OutboxBatchExecutorTest is Test {
+    OutboxBatchExecutor public executor;
+    OutboxMock public outbox;
+    OutboxMessageReceiverMock public receiver;
+
+    address public l2Sender = makeAddr("l2Sender");
+    address public relayer = makeAddr("relayer");
+
+    function setUp() public {
+        executor = new OutboxBatchExecutor();
+        outbox = new OutboxMock();
+        receiver = new OutboxMessageReceiverMock();
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_executeTransactions() public {
+        OutboxBatchExecutor.OutboxMessage[] memory messages =
+            new OutboxBatchExecutor.OutboxMessage[](3);
+        for (uint256 i = 0; i < messages.length; i++) {
+            messages[i] = _message(i + 10, i + 1);
+        }
+
+        for (uint256 i = 0; i < messages.length; i++) {
+            vm.expectEmit(true, true, true, true);
+            emit MessageReceived(address(outbox), l2Sender, i + 1);
+        }
+        vm.prank(relayer);
+        bool[] memory success = executor.executeTransactions(
+            IOutbox(address(outbox)), messages, _gasLimits(messages.length)
+        );
+
+        for (uint256 i = 0; i < messages.length; i++) {
+            assertTrue(success[i], "Message failed");
+            assertTrue(outbox.spent(i + 10), "Message not spent");
+        }
+        assertEq(receiver.received(), 3, "Invalid received messages");
+    }
+
+    function test_executeTransactions_MessageFails() public {
+        OutboxBatchExecutor.OutboxMessage[] memory messages =
+            new OutboxBatchExecutor.OutboxMessage[](3);
+        messages[0] = _message(0, 1);
+        // receiver reverts on 0
+        messages[1] = _message(1, 0);
+        messages[2] = _message(2, 3);
+
+        vm.expectEmit(true, true, true, true);
+        emit TransactionFailed(address(outbox), 1);
+        bool[] memory success = executor.executeTransactions(
+            IOutbox(address(outbox)), messages, _gasLimits(messages.length)
+        );
+
+        assertTrue(success[0], "First message failed");
+        assertFalse(success[1], "Second message executed");
+        assertTrue(success[2], "Third message failed");
+        assertFalse(outbox.spent(1), "Failed message spent");
+        assertEq(receiver.received(), 2, "Invalid received messages");
+    }
+
+    function test_executeTransactions_GasLimit() public {
+        OutboxBatchExecutor.OutboxMessage[] memory messages =
+            new OutboxBatchExecutor.OutboxMessage[](2);
+        messages[0] = _message(0, 1);
+        // runs out of its gas limit
+        messages[0].data = abi.encodeWithSelector(OutboxMessageReceiverMock.burnGas.selector);
+        messages[1] = _message(1, 2);
+
+        bool[] memory success = executor.executeTransactions(
+            IOutbox(address(outbox)), messages, _gasLimits(messages.length)
+        );
+
+        // the next message still has gas
+        assertFalse(success[0], "First message executed");
+        assertTrue(success[1], "Second message failed");
+        assertFalse(outbox.spent(0), "Failed message spent");
+        assertEq(receiver.received(), 1, "Invalid received messages");
+    }
+
+    function test_executeTransactions_AlreadySpent() public {
+        OutboxBatchExecutor.OutboxMessage[] memory messages =
+            new OutboxBatchExecutor.OutboxMessage[](2);
+        messages[0] = _message(5, 1);
+        messages[1] = _message(5, 1);
+
+        bool[] memory success = executor.executeTransactions(
+            IOutbox(address(outbox)), messages, _gasLimits(messages.length)
+        );
+
+        assertTrue(success[0], "First message failed");
+        assertFalse(success[1], "Message executed twice");
+        assertEq(receiver.received(), 1, "Invalid received messages");
+    }
+
+    function test_executeTransactions_ForwardsMessage() public {
+        OutboxBatchExecutor.OutboxMessage[] memory messages =
+            new OutboxBatchExecutor.OutboxMessage[](1);
+        messages[0] = _message(7, 1);
+        messages[0].proof = new bytes32[](2);
+        messages[0].proof[0] = keccak256("node0");
+        messages[0].proof[1] = keccak256("node1");
+
+        executor.executeTransactions(
+            IOutbox(address(outbox)), messages, _gasLimits(messages.length)
+        );
+
+        // every field reaches the outbox as when calling it directly
+        assertEq(
+            outbox.lastMessageHash(),
+            keccak256(abi.encode(messages[0])),
+            "Invalid message"
+        );
+    }
+
+    function test_executeTransactions_revert_NotContract() public {
+        vm.expectRevert("NOT_CONTRACT");
+        executor.executeTransactions(
+            IOutbox(makeAddr("notOutbox")),
+            new OutboxBatchExecutor.OutboxMessage[](0),
+            new uint256[](0)
+        );
+    }
+
+    function test_executeTransactions_revert_InvalidInput() public {
+        vm.expectRevert("INVALID_INPUT");
+        executor.executeTransactions(
+            IOutbox(address(outbox)), new OutboxBatchExecutor.OutboxMessage[](2), _gasLimits(1)
+        );
+    }
+
+    function test_executeTransactions_revert_InsufficientGas() public {
+        OutboxBatchExecutor.OutboxMessage[] memory messages =
+            new OutboxBatchExecutor.OutboxMessage[](1);
+        messages[0] = _message(0, 1);
+        messages[0].data = abi.encodeWithSelector(OutboxMessageReceiverMock.burnGas.selector);
+        uint256[] memory gasLimits = new uint256[](1);
+        gasLimits[0] = 5_000_000;
+
+        // the message would get less than its limit
+        vm.expectRevert("INSUFFICIENT_GAS");
+        executor.executeTransactions{gas: 1_000_000}(
+            IOutbox(address(outbox)), messages, gasLimits
+        );
+    }
+
+    ////
+    // Helper functions
+    ////
+    function _message(uint256 index, uint256 num)
+        internal
+        view
+        returns (OutboxBatchExecutor.OutboxMessage memory)
+    {
+        return
+            OutboxBatchExecutor.OutboxMessage({
+                proof: new bytes32[](0),
+                index: index,
+                l2Sender: l2Sender,
+                to: address(receiver),
+                l2Block: 100,
+                l1Block: 200,
+                l2Timestamp: 300,
+                value: 0,
+                data: abi.encodeWithSelector(
+                    OutboxMessageReceiverMock.receiveMessage.selector,
+                    num
+                )
+            });
+    }
+
+    function _gasLimits(uint256 length) internal pure returns (uint256[] memory gasLimits) {
+        gasLimits = new uint256[](length);
+        for (uint256 i = 0; i < length; i++) {
+            gasLimits[i] = 200_000;
+        }
+    }
+
+    ////
+    // Event declarations
+    ////
+    event TransactionFailed(address indexed outbox, uint256 indexed index);
+    event MessageReceived(address sender, address l2Sender, uint256 num);
+}
+
+/// @dev executes messages without checking their proof
+contract OutboxMock {
+    mapping(uint256 => bool) public spent;
+    address public l2ToL1Sender;
+    bytes32 public lastMessageHash;
+
+    function executeTransaction(
+        bytes32[] calldata, /* proof */
+        uint256 index,
+        address l2Sender,
+        address to,
+        uint256, /* l2Block */
+        uint256, /* l1Block */
+        uint256, /* l2Timestamp */
+        uint256 value,
+        bytes calldata data
+    ) external {
+        require(!spent[index], "ALREADY_SPENT");
+        spent[index] = true;
+        // hash of the parameters abi encoded as OutboxBatchExecutor.OutboxMessage
+        lastMessageHash = keccak256(abi.encodePacked(uint256(0x20), msg.data[4:]));
+
+        l2ToL1Sender = l2Sender;
+        (bool success, ) = to.call{value: value}(data);
+        require(success, "BRIDGE_CALL_FAILED");
+        l2ToL1Sender = address(0);
+    }
+}
+
+contract OutboxMessageReceiverMock {
+    uint256 public received;
+
+    event MessageReceived(address sender, address l2Sender, uint256 num);
+
+    function receiveMessage(uint256 num) external {
+        require(num != 0, "INVALID_NUM");
+        received++;
+        emit MessageReceived(msg.sender, OutboxMock(msg.sender).l2ToL1Sender(), num);
+    }
+
+    /// @dev runs out of gas
+    function burnGas() external {
+        while (gasleft() > 0) {
+            received = received;
+        }
+    }
+}
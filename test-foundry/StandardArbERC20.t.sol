@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "forge-std/Test.sol";
+import {StandardArbERC20} from "contracts/tokenbridge/arbitrum/StandardArbERC20.sol";
+import {TokenMetadataCodec} from "contracts/tokenbridge/libraries/TokenMetadataCodec.sol";
+import {BeaconProxyFactory} from "contracts/tokenbridge/libraries/ClonableBeaconProxy.sol";
+import {UpgradeableBeacon} from "@openzeppelin/contracts/proxy/beacon/UpgradeableBeacon.sol";
+
+contract StandardArbERC20Test is Test {
+    BeaconProxyFactory public beaconProxyFactory;
+    address public l2Gateway = makeAddr("l2Gateway");
+    address public l1Token = makeAddr("l1Token");
+
+    // slots of ERC20Upgradeable and StandardArbERC20 metadata, see test/storage/StandardArbERC20
+    uint256 public constant NAME_SLOT = 54;
+    uint256 public constant SYMBOL_SLOT = 55;
+    uint256 public constant DECIMALS_SLOT = 56;
+    uint256 public constant AVAILABLE_GETTERS_SLOT = 206;
+
+    function setUp() public {
+        UpgradeableBeacon beacon = new UpgradeableBeacon(address(new StandardArbERC20()));
+        beaconProxyFactory = new BeaconProxyFactory();
+        beaconProxyFactory.initialize(address(beacon));
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_bridgeInit(string memory name, string memory symbol, uint8 decimals) public {
+        StandardArbERC20 token = _deployToken(
+            abi.encode(name), abi.encode(symbol), abi.encode(decimals)
+        );
+
+        assertEq(token.name(), name, "Invalid name");
+        assertEq(token.symbol(), symbol, "Invalid symbol");
+        assertEq(token.decimals(), decimals, "Invalid decimals");
+        assertEq(token.l2Gateway(), l2Gateway, "Invalid l2Gateway");
+        assertEq(token.l1Address(), l1Token, "Invalid l1Address");
+    }
+
+    function test_bridgeInit_Layout() public {
+        StandardArbERC20 token = _deployToken(
+            abi.encode("Wrapped Ether"), abi.encode("WETH"), abi.encode(uint256(18))
+        );
+
+        assertEq(token.name(), "Wrapped Ether", "Invalid name");
+        assertEq(token.symbol(), "WETH", "Invalid symbol");
+        assertEq(token.decimals(), 18, "Invalid decimals");
+
+        // deployed proxies share this implementation, so the metadata stays in ERC20Upgradeable
+        assertEq(
+            _load(token, NAME_SLOT),
+            bytes32(abi.encodePacked(bytes13("Wrapped Ether"), bytes18(0), uint8(13 * 2))),
+            "Invalid name slot"
+        );
+        assertEq(
+            _load(token, SYMBOL_SLOT),
+            bytes32(abi.encodePacked(bytes4("WETH"), bytes27(0), uint8(4 * 2))),
+            "Invalid symbol slot"
+        );
+        assertEq(uint256(_load(token, DECIMALS_SLOT)), 18, "Invalid decimals slot");
+        assertEq(_load(token, AVAILABLE_GETTERS_SLOT), bytes32(0), "Invalid getters slot");
+    }
+
+    function test_bridgeInit_LongName() public {
+        string memory name = "abcdefghijklmnopqrstuvwxyz012345";
+        StandardArbERC20 token = _deployToken(
+            abi.encode(name), abi.encode("SYM"), abi.encode(uint256(6))
+        );
+
+        assertEq(token.name(), name, "Invalid name");
+        assertEq(token.symbol(), "SYM", "Invalid symbol");
+        assertEq(token.decimals(), 6, "Invalid decimals");
+    }
+
+    function test_bridgeInit_LongSymbol() public {
+        string memory symbol = "abcdefghijklmnopqrstuvwxyz01234";
+        StandardArbERC20 token = _deployToken(
+            abi.encode("Name"), abi.encode(symbol), abi.encode(uint256(6))
+        );
+
+        assertEq(token.name(), "Name", "Invalid name");
+        assertEq(token.symbol(), symbol, "Invalid symbol");
+        assertEq(token.decimals(), 6, "Invalid decimals");
+    }
+
+    function test_bridgeInit_Bytes32Metadata() public {
+        // tokens like MKR return bytes32 instead of string
+        StandardArbERC20 token = _deployToken(
+            abi.encode(bytes32("Maker")), abi.encode(bytes32("MKR")), abi.encode(uint256(18))
+        );
+
+        assertEq(token.name(), "Maker", "Invalid name");
+        assertEq(token.symbol(), "MKR", "Invalid symbol");
+        assertEq(token.decimals(), 18, "Invalid decimals");
+    }
+
+    function test_bridgeInit_EmptyMetadata() public {
+        StandardArbERC20 token =
+            _deployToken(abi.encode(""), abi.encode(""), abi.encode(uint256(0)));
+
+        assertEq(token.name(), "", "Invalid name");
+        assertEq(token.symbol(), "", "Invalid symbol");
+        assertEq(token.decimals(), 0, "Invalid decimals");
+    }
+
+    function test_bridgeInit_GettersNotAvailable() public {
+        StandardArbERC20 token = _deployToken("", "", "");
+
+        vm.expectRevert();
+        token.name();
+        vm.expectRevert();
+        token.symbol();
+        vm.expectRevert();
+        token.decimals();
+    }
+
+    function test_bridgeInit_DecimalsNotAvailable() public {
+        StandardArbERC20 token = _deployToken(abi.encode("Name"), abi.encode("SYM"), "");
+
+        assertEq(token.name(), "Name", "Invalid name");
+        assertEq(token.symbol(), "SYM", "Invalid symbol");
+        vm.expectRevert();
+        token.decimals();
+    }
+
+    function test_bridgeInit_LongNameGettersNotAvailable() public {
+        StandardArbERC20 token =
+            _deployToken(abi.encode("abcdefghijklmnopqrstuvwxyz012345"), "", "");
+
+        vm.expectRevert();
+        token.symbol();
+        vm.expectRevert();
+        token.decimals();
+    }
+
+    function test_bridgeInit_CompactMetadata() public {
+        // metadata normalized by the L1 gateway for packed deposits
+        vm.startPrank(l2Gateway);
+        StandardArbERC20 token =
+            StandardArbERC20(beaconProxyFactory.createProxy(keccak256(abi.encode(l1Token))));
+        token.bridgeInit(
+            l1Token,
+            TokenMetadataCodec.encode(
+                abi.encode(bytes32("Maker")), abi.encode("MKR"), abi.encode(uint256(18))
+            )
+        );
+        vm.stopPrank();
+
+        assertEq(token.name(), "Maker", "Invalid name");
+        assertEq(token.symbol(), "MKR", "Invalid symbol");
+        assertEq(token.decimals(), 18, "Invalid decimals");
+    }
+
+    function test_bridgeInit_InvalidAbiString() public {
+        // previously reverted since the string can't be decoded, now treated as not available
+        StandardArbERC20 token = _deployToken(
+            abi.encode(uint256(64), uint256(0)), abi.encode("SYM"), abi.encode(uint256(6))
+        );
+
+        vm.expectRevert();
+        token.name();
+        assertEq(token.symbol(), "SYM", "Invalid symbol");
+        assertEq(token.decimals(), 6, "Invalid decimals");
+    }
+
+    function test_bridgeInit_PermitDomain() public {
+        StandardArbERC20 token = _deployToken(
+            abi.encode("Wrapped Ether"), abi.encode("WETH"), abi.encode(uint256(18))
+        );
+
+        bytes32 expectedDomainSeparator = keccak256(
+            abi.encode(
+                keccak256(
+                    "EIP712Domain(string name,string version,uint256 chainId,address verifyingContract)"
+                ),
+                keccak256(bytes("Wrapped Ether")),
+                keccak256(bytes("1")),
+                block.chainid,
+                address(token)
+            )
+        );
+        assertEq(token.DOMAIN_SEPARATOR(), expectedDomainSeparator, "Invalid domain separator");
+    }
+
+    function test_bridgeInit_revert_AlreadyInit() public {
+        StandardArbERC20 token = _deployToken(
+            abi.encode("Name"), abi.encode("SYM"), abi.encode(uint256(18))
+        );
+
+        vm.prank(l2Gateway);
+        vm.expectRevert("ALREADY_INIT");
+        token.bridgeInit(
+            l1Token,
+            abi.encode(abi.encode("Name"), abi.encode("SYM"), abi.encode(uint256(18)))
+        );
+    }
+
+    ////
+    // Helper functions
+    ////
+    function _deployToken(
+        bytes memory name,
+        bytes memory symbol,
+        bytes memory decimals
+    ) internal returns (StandardArbERC20 token) {
+        vm.startPrank(l2Gateway);
+        token = StandardArbERC20(beaconProxyFactory.createProxy(keccak256(abi.encode(l1Token))));
+        token.bridgeInit(l1Token, abi.encode(name, symbol, decimals));
+        vm.stopPrank();
+    }
+
+    function _load(StandardArbERC20 token, uint256 slot) internal view returns (bytes32) {
+        return vm.load(address(token), bytes32(slot));
+    }
+}
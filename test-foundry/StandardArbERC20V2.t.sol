@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "forge-std/Test.sol";
+import {StandardArbERC20V2} from "contracts/tokenbridge/arbitrum/StandardArbERC20V2.sol";
+import {TokenMetadataCodec} from "contracts/tokenbridge/libraries/TokenMetadataCodec.sol";
+import {BeaconProxyFactory} from "contracts/tokenbridge/libraries/ClonableBeaconProxy.sol";
+import {UpgradeableBeacon} from "@openzeppelin/contracts/proxy/beacon/UpgradeableBeacon.sol";
+
+contract StandardArbERC20V2Test is Test {
+    BeaconProxyFactory public beaconProxyFactory;
+    address public l2Gateway = makeAddr("l2Gateway");
+    address public l1Token = makeAddr("l1Token");
+    address public user = makeAddr("user");
+
+    // see test/storage/StandardArbERC20V2
+    uint256 public constant NAME_SLOT = 54;
+    uint256 public constant SYMBOL_SLOT = 55;
+    uint256 public constant DECIMALS_SLOT = 56;
+    uint256 public constant GATEWAY_SLOT = 204;
+    uint256 public constant L1_ADDRESS_SLOT = 205;
+    uint256 public constant PACKED_NAME_SLOT = 206;
+    uint256 public constant PACKED_SYMBOL_SLOT = 207;
+
+    function setUp() public {
+        UpgradeableBeacon beacon = new UpgradeableBeacon(address(new StandardArbERC20V2()));
+        beaconProxyFactory = new BeaconProxyFactory();
+        beaconProxyFactory.initialize(address(beacon));
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_bridgeInit(string memory name, string memory symbol, uint8 decimals) public {
+        StandardArbERC20V2 token = _deployToken(
+            abi.encode(abi.encode(name), abi.encode(symbol), abi.encode(decimals))
+        );
+
+        assertEq(token.name(), name, "Invalid name");
+        assertEq(token.symbol(), symbol, "Invalid symbol");
+        assertEq(token.decimals(), decimals, "Invalid decimals");
+        assertEq(token.l2Gateway(), l2Gateway, "Invalid l2Gateway");
+        assertEq(token.l1Address(), l1Token, "Invalid l1Address");
+        assertFalse(token.isMaster(), "Is master");
+    }
+
+    function test_bridgeInit_PackedLayout() public {
+        StandardArbERC20V2 token = _deployToken(
+            abi.encode(abi.encode("Wrapped Ether"), abi.encode("WETH"), abi.encode(uint256(18)))
+        );
+
+        // isMasterCopy | l2Gateway
+        assertEq(
+            uint256(_load(token, GATEWAY_SLOT)),
+            uint256(uint160(l2Gateway)) << 8,
+            "Invalid gateway slot"
+        );
+        assertEq(
+            uint256(_load(token, L1_ADDRESS_SLOT)),
+            uint256(uint160(l1Token)),
+            "Invalid l1Address slot"
+        );
+        // name | length + 1
+        assertEq(
+            _load(token, PACKED_NAME_SLOT),
+            bytes32("Wrapped Ether") | bytes32(uint256(14)),
+            "Invalid packed name slot"
+        );
+        // symbol | decimals | ignored getters | length + 1
+        assertEq(
+            _load(token, PACKED_SYMBOL_SLOT),
+            bytes32("WETH") | bytes32((18 << 16) | 5),
+            "Invalid packed symbol slot"
+        );
+        assertEq(_load(token, NAME_SLOT), bytes32(0), "Name stored in ERC20Upgradeable");
+        assertEq(_load(token, SYMBOL_SLOT), bytes32(0), "Symbol stored in ERC20Upgradeable");
+        assertEq(_load(token, DECIMALS_SLOT), bytes32(0), "Decimals stored in ERC20Upgradeable");
+    }
+
+    function test_bridgeInit_MaxPackedLength() public {
+        string memory name = "Thirty One Bytes Long Token Nam";
+        string memory symbol = "TWENTY-NINE-BYTES-LONG-SYMBOL";
+        StandardArbERC20V2 token = _deployToken(
+            abi.encode(abi.encode(name), abi.encode(symbol), abi.encode(uint256(6)))
+        );
+
+        assertEq(token.name(), name, "Invalid name");
+        assertEq(token.symbol(), symbol, "Invalid symbol");
+        assertEq(token.decimals(), 6, "Invalid decimals");
+        assertEq(_load(token, NAME_SLOT), bytes32(0), "Name stored in ERC20Upgradeable");
+        assertEq(_load(token, SYMBOL_SLOT), bytes32(0), "Symbol stored in ERC20Upgradeable");
+    }
+
+    function test_bridgeInit_LongMetadata() public {
+        string memory name = "Thirty Two Bytes Long Token Name";
+        string memory symbol = "THIRTY-BYTES-LONG-TOKEN-SYMBOL";
+        StandardArbERC20V2 token = _deployToken(
+            abi.encode(abi.encode(name), abi.encode(symbol), abi.encode(uint256(6)))
+        );
+
+        assertEq(token.name(), name, "Invalid name");
+        assertEq(token.symbol(), symbol, "Invalid symbol");
+        assertEq(token.decimals(), 6, "Invalid decimals");
+        // too long to be packed, so stored in ERC20Upgradeable
+        assertEq(_load(token, PACKED_NAME_SLOT), bytes32(0), "Name packed");
+        assertEq(
+            _load(token, PACKED_SYMBOL_SLOT),
+            bytes32(uint256(6 << 16)),
+            "Invalid packed symbol slot"
+        );
+        assertTrue(_load(token, NAME_SLOT) != bytes32(0), "Name not stored in ERC20Upgradeable");
+        assertTrue(
+            _load(token, SYMBOL_SLOT) != bytes32(0),
+            "Symbol not stored in ERC20Upgradeable"
+        );
+    }
+
+    function test_bridgeInit_LongNameShortSymbol() public {
+        string memory name = "A token name which doesn't fit in a single slot";
+        StandardArbERC20V2 token = _deployToken(
+            abi.encode(abi.encode(name), abi.encode("SYM"), abi.encode(uint256(18)))
+        );
+
+        assertEq(token.name(), name, "Invalid name");
+        assertEq(token.symbol(), "SYM", "Invalid symbol");
+        assertEq(token.decimals(), 18, "Invalid decimals");
+        assertEq(_load(token, SYMBOL_SLOT), bytes32(0), "Symbol stored in ERC20Upgradeable");
+    }
+
+    function test_bridgeInit_CompactMetadata() public {
+        StandardArbERC20V2 token = _deployToken(
+            TokenMetadataCodec.encode(
+                abi.encode(bytes32("Maker")), abi.encode("MKR"), abi.encode(uint256(18))
+            )
+        );
+
+        assertEq(token.name(), "Maker", "Invalid name");
+        assertEq(token.symbol(), "MKR", "Invalid symbol");
+        assertEq(token.decimals(), 18, "Invalid decimals");
+    }
+
+    function test_bridgeInit_EmptyMetadata() public {
+        StandardArbERC20V2 token =
+            _deployToken(abi.encode(abi.encode(""), abi.encode(""), abi.encode(uint256(0))));
+
+        assertEq(token.name(), "", "Invalid name");
+        assertEq(token.symbol(), "", "Invalid symbol");
+        assertEq(token.decimals(), 0, "Invalid decimals");
+    }
+
+    function test_bridgeInit_GettersNotAvailable() public {
+        StandardArbERC20V2 token = _deployToken(abi.encode(bytes(""), bytes(""), bytes("")));
+
+        // empty name and symbol, all getters ignored
+        assertEq(_load(token, PACKED_NAME_SLOT), bytes32(uint256(1)), "Invalid packed name slot");
+        assertEq(
+            _load(token, PACKED_SYMBOL_SLOT),
+            bytes32(uint256((7 << 8) | 1)),
+            "Invalid packed symbol slot"
+        );
+        vm.expectRevert();
+        token.name();
+        vm.expectRevert();
+        token.symbol();
+        vm.expectRevert();
+        token.decimals();
+    }
+
+    function test_bridgeInit_DecimalsNotAvailable() public {
+        StandardArbERC20V2 token =
+            _deployToken(abi.encode(abi.encode("Name"), abi.encode("SYM"), bytes("")));
+
+        assertEq(token.name(), "Name", "Invalid name");
+        assertEq(token.symbol(), "SYM", "Invalid symbol");
+        vm.expectRevert();
+        token.decimals();
+    }
+
+    function test_bridgeInit_revert_AlreadyInit() public {
+        bytes memory data =
+            abi.encode(abi.encode("Name"), abi.encode("SYM"), abi.encode(uint256(18)));
+        StandardArbERC20V2 token = _deployToken(data);
+
+        vm.prank(l2Gateway);
+        vm.expectRevert("ALREADY_INIT");
+        token.bridgeInit(l1Token, data);
+    }
+
+    function test_bridgeMint() public {
+        StandardArbERC20V2 token = _deployToken(
+            abi.encode(abi.encode("Name"), abi.encode("SYM"), abi.encode(uint256(18)))
+        );
+
+        vm.prank(l2Gateway);
+        token.bridgeMint(user, 100);
+        assertEq(token.balanceOf(user), 100, "Invalid balance");
+        assertEq(token.totalSupply(), 100, "Invalid supply");
+
+        vm.prank(l2Gateway);
+        token.bridgeBurn(user, 40);
+        assertEq(token.balanceOf(user), 60, "Invalid balance");
+        assertEq(token.totalSupply(), 60, "Invalid supply");
+    }
+
+    function test_bridgeMint_revert_OnlyGateway() public {
+        StandardArbERC20V2 token = _deployToken(
+            abi.encode(abi.encode("Name"), abi.encode("SYM"), abi.encode(uint256(18)))
+        );
+
+        vm.expectRevert("ONLY_GATEWAY");
+        token.bridgeMint(user, 100);
+        vm.expectRevert("ONLY_GATEWAY");
+        token.bridgeBurn(user, 100);
+    }
+
+    ////
+    // Helper functions
+    ////
+    function _deployToken(bytes memory data) internal returns (StandardArbERC20V2 token) {
+        vm.startPrank(l2Gateway);
+        token = StandardArbERC20V2(beaconProxyFactory.createProxy(keccak256(abi.encode(l1Token))));
+        token.bridgeInit(l1Token, data);
+        vm.stopPrank();
+    }
+
+    function _load(StandardArbERC20V2 token, uint256 slot) internal view returns (bytes32) {
+        return vm.load(address(token), bytes32(slot));
+    }
+}
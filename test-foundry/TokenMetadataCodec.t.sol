@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "forge-std/Test.sol";
+import {TokenMetadataCodec} from "contracts/tokenbridge/libraries/TokenMetadataCodec.sol";
+import {TestBytesParser} from "contracts/tokenbridge/test/TestBytesParser.sol";
+
+contract TokenMetadataCodecTest is Test {
+    TokenMetadataCodecHarness public codec;
+    TestBytesParser public parser;
+
+    function setUp() public {
+        codec = new TokenMetadataCodecHarness();
+        parser = new TestBytesParser();
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_decodeString_EquivalentToBytesParser(bytes memory input) public {
+        _assertStringEquivalent(input);
+    }
+
+    function test_decodeString_EquivalentToBytesParser_Bytes32(bytes32 input) public {
+        _assertStringEquivalent(abi.encode(input));
+    }
+
+    function test_decodeString_EquivalentToBytesParser_String(string memory input) public {
+        _assertStringEquivalent(abi.encode(input));
+    }
+
+    function test_decodeString_InvalidAbiString() public {
+        // BytesParser reverts on these, the codec reports them as not available
+        bytes memory outOfBoundsOffset = abi.encode(uint256(64), uint256(0));
+        bytes memory outOfBoundsLength = abi.encode(uint256(32), uint256(1));
+        bytes memory hugeLength = abi.encode(uint256(32), type(uint256).max);
+
+        (bool success, ) = codec.decodeString(outOfBoundsOffset);
+        assertFalse(success, "Out of bounds offset");
+        (success, ) = codec.decodeString(outOfBoundsLength);
+        assertFalse(success, "Out of bounds length");
+        (success, ) = codec.decodeString(hugeLength);
+        assertFalse(success, "Huge length");
+        (success, ) = codec.decodeString(hex"1234");
+        assertFalse(success, "Short input");
+    }
+
+    function test_decodeString_Bytes32() public {
+        (bool success, string memory res) = codec.decodeString(abi.encode(bytes32("Maker")));
+        assertTrue(success, "Not parsed");
+        assertEq(res, "Maker", "Invalid string");
+
+        // only trailing null bytes are dropped
+        (success, res) = codec.decodeString(abi.encode(bytes32(hex"610062")));
+        assertTrue(success, "Not parsed");
+        assertEq(bytes(res), hex"610062", "Invalid string");
+
+        (success, res) = codec.decodeString(abi.encode(bytes32(0)));
+        assertTrue(success, "Not parsed");
+        assertEq(res, "", "Invalid empty string");
+    }
+
+    function test_decodeUint8_EquivalentToBytesParser(bytes memory input) public {
+        _assertUint8Equivalent(input);
+    }
+
+    function test_decodeUint8_EquivalentToBytesParser_Uint256(uint256 input) public {
+        _assertUint8Equivalent(abi.encode(input % 512));
+    }
+
+    function test_encode(string memory name, string memory symbol, uint8 decimals) public {
+        vm.assume(bytes(name).length <= type(uint8).max);
+
+        assertEq(
+            codec.encode(abi.encode(name), abi.encode(symbol), abi.encode(decimals)),
+            abi.encodePacked(
+                TokenMetadataCodec.COMPACT_VERSION,
+                uint8(0),
+                decimals,
+                uint8(bytes(name).length),
+                name,
+                symbol
+            ),
+            "Invalid encoding"
+        );
+    }
+
+    function test_encode_NotAvailable() public {
+        bytes memory data = codec.encode("", abi.encode(bytes32("MKR")), "");
+        assertEq(
+            data,
+            abi.encodePacked(
+                TokenMetadataCodec.COMPACT_VERSION,
+                uint8(
+                    TokenMetadataCodec.NAME_NOT_AVAILABLE |
+                        TokenMetadataCodec.DECIMALS_NOT_AVAILABLE
+                ),
+                uint8(0),
+                uint8(0),
+                "MKR"
+            ),
+            "Invalid encoding"
+        );
+    }
+
+    function test_encode_LongName() public {
+        bytes memory name = abi.encode(string(new bytes(256)));
+        bytes memory symbol = abi.encode("SYM");
+        bytes memory decimals = abi.encode(uint256(18));
+
+        // falls back to the raw encoding
+        assertEq(
+            codec.encode(name, symbol, decimals),
+            abi.encode(name, symbol, decimals),
+            "Invalid encoding"
+        );
+    }
+
+    function test_decode_EquivalentEncodings(
+        bytes memory name,
+        bytes memory symbol,
+        bytes memory decimals
+    ) public {
+        TokenMetadataCodecHarness.Metadata memory raw = codec.decode(
+            abi.encode(name, symbol, decimals)
+        );
+        TokenMetadataCodecHarness.Metadata memory compact = codec.decode(
+            codec.encode(name, symbol, decimals)
+        );
+
+        assertEq(compact.nameSuccess, raw.nameSuccess, "Invalid name success");
+        assertEq(compact.name, raw.name, "Invalid name");
+        assertEq(compact.symbolSuccess, raw.symbolSuccess, "Invalid symbol success");
+        assertEq(compact.symbol, raw.symbol, "Invalid symbol");
+        assertEq(compact.decimalsSuccess, raw.decimalsSuccess, "Invalid decimals success");
+        assertEq(compact.decimals, raw.decimals, "Invalid decimals");
+    }
+
+    function test_decode(string memory name, string memory symbol, uint8 decimals) public {
+        TokenMetadataCodecHarness.Metadata memory metadata = codec.decode(
+            codec.encode(abi.encode(name), abi.encode(symbol), abi.encode(decimals))
+        );
+
+        assertTrue(metadata.nameSuccess, "Name not available");
+        assertEq(metadata.name, name, "Invalid name");
+        assertTrue(metadata.symbolSuccess, "Symbol not available");
+        assertEq(metadata.symbol, symbol, "Invalid symbol");
+        assertTrue(metadata.decimalsSuccess, "Decimals not available");
+        assertEq(metadata.decimals, decimals, "Invalid decimals");
+    }
+
+    function test_decode_revert_InvalidMetadata() public {
+        vm.expectRevert("INVALID_METADATA");
+        // name length is past the end of the data
+        codec.decode(
+            abi.encodePacked(
+                TokenMetadataCodec.COMPACT_VERSION,
+                uint8(0),
+                uint8(18),
+                uint8(5),
+                "abc"
+            )
+        );
+    }
+
+    ////
+    // Helper functions
+    ////
+    function _assertStringEquivalent(bytes memory input) internal {
+        (bool success, string memory res) = codec.decodeString(input);
+        try parser.bytesToString(input) returns (bool expectedSuccess, string memory expectedRes) {
+            assertEq(success, expectedSuccess, "Invalid success");
+            assertEq(res, expectedRes, "Invalid string");
+        } catch {
+            assertFalse(success, "Parsed input BytesParser reverts on");
+        }
+    }
+
+    function _assertUint8Equivalent(bytes memory input) internal {
+        (bool success, uint8 res) = codec.decodeUint8(input);
+        (bool expectedSuccess, uint8 expectedRes) = parser.bytesToUint8(input);
+        assertEq(success, expectedSuccess, "Invalid success");
+        assertEq(res, expectedRes, "Invalid uint8");
+    }
+}
+
+contract TokenMetadataCodecHarness {
+    struct Metadata {
+        bool nameSuccess;
+        string name;
+        bool symbolSuccess;
+        string symbol;
+        bool decimalsSuccess;
+        uint8 decimals;
+    }
+
+    function encode(
+        bytes memory name,
+        bytes memory symbol,
+        bytes memory decimals
+    ) external pure returns (bytes memory) {
+        return TokenMetadataCodec.encode(name, symbol, decimals);
+    }
+
+    function decode(bytes memory data) external pure returns (Metadata memory metadata) {
+        (
+            metadata.nameSuccess,
+            metadata.name,
+            metadata.symbolSuccess,
+            metadata.symbol,
+            metadata.decimalsSuccess,
+            metadata.decimals
+        ) = TokenMetadataCodec.decode(data);
+    }
+
+    function decodeString(bytes memory input) external pure returns (bool, string memory) {
+        return TokenMetadataCodec.decodeString(input);
+    }
+
+    function decodeUint8(bytes memory input) external pure returns (bool, uint8) {
+        return TokenMetadataCodec.decodeUint8(input);
+    }
+}
@@ -0,0 +1,266 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "forge-std/Test.sol";
+import {
+    MerkleWhitelist,
+    Whitelist,
+    WhitelistConsumer
+} from "contracts/tokenbridge/libraries/Whitelist.sol";
+
+contract MerkleWhitelistTest is Test {
+    MerkleWhitelist public whitelist;
+    WhitelistConsumerMock public consumer;
+
+    address public owner = makeAddr("owner");
+    address[] public members;
+    bytes32[] public leaves;
+    bytes32 public root;
+
+    function setUp() public {
+        vm.prank(owner);
+        whitelist = new MerkleWhitelist();
+        consumer = new WhitelistConsumerMock(address(whitelist));
+
+        // tree of 4 members, leaves and pairs are hashed as in OpenZeppelin's StandardMerkleTree
+        for (uint256 i = 0; i < 4; i++) {
+            members.push(makeAddr(string(abi.encodePacked("member", vm.toString(i)))));
+            leaves.push(keccak256(bytes.concat(keccak256(abi.encode(members[i])))));
+        }
+        root = _hashPair(_hashPair(leaves[0], leaves[1]), _hashPair(leaves[2], leaves[3]));
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_addCohort() public {
+        vm.expectEmit(true, true, true, true);
+        emit CohortAdded(3, root);
+
+        vm.prank(owner);
+        whitelist.addCohort(3, root);
+
+        assertEq(whitelist.cohortRoots(3), root, "Invalid root");
+        assertEq(whitelist.activeCohorts(), 1 << 3, "Invalid active cohorts");
+    }
+
+    function test_addCohort_revert_OnlyOwner() public {
+        vm.expectRevert("ONLY_OWNER");
+        whitelist.addCohort(0, root);
+    }
+
+    function test_addCohort_revert_InvalidCohort() public {
+        vm.prank(owner);
+        vm.expectRevert("INVALID_COHORT");
+        whitelist.addCohort(256, root);
+    }
+
+    function test_addCohort_revert_CohortExists() public {
+        vm.startPrank(owner);
+        whitelist.addCohort(0, root);
+
+        vm.expectRevert("COHORT_EXISTS");
+        whitelist.addCohort(0, keccak256("newRoot"));
+        vm.stopPrank();
+    }
+
+    function test_addCohort_ReuseRemovedCohort() public {
+        vm.prank(owner);
+        whitelist.addCohort(0, root);
+        whitelist.proveMembership(members[0], 0, _proof(0));
+        whitelist.proveMembership(members[1], 0, _proof(1));
+
+        // the cohort is corrected to only contain the first member
+        vm.startPrank(owner);
+        whitelist.removeCohort(0);
+        whitelist.addCohort(0, leaves[0]);
+        vm.stopPrank();
+
+        assertEq(whitelist.cohortRoots(0), leaves[0], "Invalid root");
+        assertEq(whitelist.cohortEpochs(0), 1, "Invalid epoch");
+        assertFalse(whitelist.isAllowed(members[0]), "Proof of old epoch used");
+        assertFalse(whitelist.isAllowed(members[1]), "Proof of old root used");
+
+        whitelist.proveMembership(members[0], 0, new bytes32[](0));
+        assertTrue(whitelist.isAllowed(members[0]), "Not allowed");
+        vm.expectRevert("INVALID_PROOF");
+        whitelist.proveMembership(members[1], 0, _proof(1));
+    }
+
+    function test_addCohort_revert_InvalidRoot() public {
+        vm.prank(owner);
+        vm.expectRevert("INVALID_ROOT");
+        whitelist.addCohort(0, bytes32(0));
+    }
+
+    function test_proveMembership() public {
+        vm.prank(owner);
+        whitelist.addCohort(1, root);
+        assertFalse(whitelist.isAllowed(members[2]), "Allowed before proof");
+
+        vm.expectEmit(true, true, true, true);
+        emit MembershipProven(members[2], 1);
+        whitelist.proveMembership(members[2], 1, _proof(2));
+
+        assertTrue(whitelist.isAllowed(members[2]), "Not allowed");
+        assertEq(whitelist.provenCohorts(members[2]), 1 << 1, "Invalid proven cohorts");
+
+        // consumers only read the cached membership
+        vm.prank(members[2]);
+        consumer.gated();
+    }
+
+    function test_proveMembership_revert_InvalidProof() public {
+        vm.prank(owner);
+        whitelist.addCohort(0, root);
+
+        vm.expectRevert("INVALID_PROOF");
+        whitelist.proveMembership(makeAddr("notMember"), 0, _proof(2));
+    }
+
+    function test_proveMembership_revert_CohortNotActive() public {
+        vm.expectRevert("INVALID_PROOF");
+        whitelist.proveMembership(members[0], 0, _proof(0));
+    }
+
+    function test_isAllowedWithProof() public {
+        vm.prank(owner);
+        whitelist.addCohort(0, root);
+
+        for (uint256 i = 0; i < members.length; i++) {
+            assertTrue(whitelist.isAllowedWithProof(members[i], 0, _proof(i)), "Invalid proof");
+            assertFalse(whitelist.isAllowed(members[i]), "Proof was cached");
+        }
+        assertFalse(whitelist.isAllowedWithProof(members[0], 0, _proof(1)), "Wrong proof");
+        assertFalse(whitelist.isAllowedWithProof(members[0], 1, _proof(0)), "Wrong cohort");
+        assertFalse(whitelist.isAllowedWithProof(members[0], 256, _proof(0)), "Invalid cohort");
+    }
+
+    function test_removeCohort() public {
+        vm.prank(owner);
+        whitelist.addCohort(0, root);
+        whitelist.proveMembership(members[0], 0, _proof(0));
+
+        vm.expectEmit(true, true, true, true);
+        emit CohortRemoved(0);
+        vm.prank(owner);
+        whitelist.removeCohort(0);
+
+        assertEq(whitelist.activeCohorts(), 0, "Invalid active cohorts");
+        assertEq(whitelist.cohortRoots(0), bytes32(0), "Root not cleared");
+        assertFalse(whitelist.isAllowed(members[0]), "Still allowed");
+        vm.prank(members[0]);
+        vm.expectRevert("NOT_WHITELISTED");
+        consumer.gated();
+    }
+
+    function test_removeCohort_MemberOfOtherCohort() public {
+        vm.startPrank(owner);
+        whitelist.addCohort(0, root);
+        whitelist.addCohort(1, leaves[0]);
+        vm.stopPrank();
+
+        // single leaf tree has an empty proof
+        whitelist.proveMembership(members[0], 0, _proof(0));
+        whitelist.proveMembership(members[0], 1, new bytes32[](0));
+
+        vm.prank(owner);
+        whitelist.removeCohort(0);
+        assertTrue(whitelist.isAllowed(members[0]), "Not allowed");
+    }
+
+    function test_removeCohort_revert_CohortNotActive() public {
+        vm.prank(owner);
+        vm.expectRevert("COHORT_NOT_ACTIVE");
+        whitelist.removeCohort(0);
+    }
+
+    function test_setDenied() public {
+        vm.prank(owner);
+        whitelist.addCohort(0, root);
+        whitelist.proveMembership(members[0], 0, _proof(0));
+        whitelist.proveMembership(members[1], 0, _proof(1));
+
+        vm.expectEmit(true, true, true, true);
+        emit DeniedUpdated(members[0], true);
+        vm.prank(owner);
+        whitelist.setDenied(_single(members[0]), _singleBool(true));
+
+        // the rest of the cohort stays allowed
+        assertFalse(whitelist.isAllowed(members[0]), "Denied user allowed");
+        assertFalse(whitelist.isAllowedWithProof(members[0], 0, _proof(0)), "Denied proof valid");
+        assertTrue(whitelist.isAllowed(members[1]), "Not allowed");
+
+        vm.prank(owner);
+        whitelist.setDenied(_single(members[0]), _singleBool(false));
+        assertTrue(whitelist.isAllowed(members[0]), "Not allowed after undeny");
+    }
+
+    function test_setDenied_revert_OnlyOwner() public {
+        vm.expectRevert("ONLY_OWNER");
+        whitelist.setDenied(_single(members[0]), _singleBool(true));
+    }
+
+    function test_setDenied_revert_InvalidInput() public {
+        vm.prank(owner);
+        vm.expectRevert("INVALID_INPUT");
+        whitelist.setDenied(_single(members[0]), new bool[](2));
+    }
+
+    function test_triggerConsumers() public {
+        // consumers are switched from a storage based whitelist in one call
+        vm.startPrank(owner);
+        Whitelist oldWhitelist = new Whitelist();
+        WhitelistConsumerMock oldConsumer = new WhitelistConsumerMock(address(oldWhitelist));
+        address[] memory targets = new address[](1);
+        targets[0] = address(oldConsumer);
+
+        vm.expectEmit(true, true, true, true);
+        emit WhitelistUpgraded(address(whitelist), targets);
+        oldWhitelist.triggerConsumers(address(whitelist), targets);
+        vm.stopPrank();
+
+        assertEq(oldConsumer.whitelist(), address(whitelist), "Invalid whitelist");
+    }
+
+    ////
+    // Helper functions
+    ////
+    function _proof(uint256 index) internal view returns (bytes32[] memory proof) {
+        proof = new bytes32[](2);
+        proof[0] = leaves[index ^ 1];
+        proof[1] = index < 2
+            ? _hashPair(leaves[2], leaves[3])
+            : _hashPair(leaves[0], leaves[1]);
+    }
+
+    function _hashPair(bytes32 a, bytes32 b) internal pure returns (bytes32) {
+        return a < b ? keccak256(abi.encode(a, b)) : keccak256(abi.encode(b, a));
+    }
+
+    function _single(address addr) internal pure returns (address[] memory arr) {
+        arr = new address[](1);
+        arr[0] = addr;
+    }
+
+    function _singleBool(bool val) internal pure returns (bool[] memory arr) {
+        arr = new bool[](1);
+        arr[0] = val;
+    }
+
+    ////
+    // Event declarations
+    ////
+    event CohortAdded(uint256 indexed cohort, bytes32 root);
+    event CohortRemoved(uint256 indexed cohort);
+    event MembershipProven(address indexed user, uint256 indexed cohort);
+    event DeniedUpdated(address indexed user, bool denied);
+    event WhitelistUpgraded(address newWhitelist, address[] targets);
+}
+
+contract WhitelistConsumerMock is WhitelistConsumer {
+    constructor(address _whitelist) {
+        whitelist = _whitelist;
+    }
+
+    function gated() external view onlyWhitelisted {}
+}
@@ -0,0 +1,455 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "forge-std/Test.sol";
+import {IL1ArbitrumGateway} from "contracts/tokenbridge/ethereum/gateway/IL1ArbitrumGateway.sol";
+import {L1GatewayRouter} from "contracts/tokenbridge/ethereum/gateway/L1GatewayRouter.sol";
+import {L1OrbitGatewayRouter} from "contracts/tokenbridge/ethereum/gateway/L1OrbitGatewayRouter.sol";
+import {L1ERC20Gateway} from "contracts/tokenbridge/ethereum/gateway/L1ERC20Gateway.sol";
+import {L1OrbitERC20Gateway} from "contracts/tokenbridge/ethereum/gateway/L1OrbitERC20Gateway.sol";
+import {L1CustomGateway} from "contracts/tokenbridge/ethereum/gateway/L1CustomGateway.sol";
+import {L1WethGateway} from "contracts/tokenbridge/ethereum/gateway/L1WethGateway.sol";
+import {L1USDCGateway} from "contracts/tokenbridge/ethereum/gateway/L1USDCGateway.sol";
+import {TestERC20} from "contracts/tokenbridge/test/TestERC20.sol";
+import {TestWETH9} from "contracts/tokenbridge/test/TestWETH9.sol";
+import {InboxMock, ERC20InboxMock} from "contracts/tokenbridge/test/InboxMock.sol";
+import {MockUsdc} from "../L1USDCGateway.t.sol";
+import {IERC20} from "@openzeppelin/contracts/token/ERC20/IERC20.sol";
+import {ERC20PresetMinterPauser} from
+    "@openzeppelin/contracts/token/ERC20/presets/ERC20PresetMinterPauser.sol";
+
+/**
+ * @notice Gas benchmarks of the L1 gateway hot paths, recorded in .gas-snapshot by `yarn gas:snapshot`
+ * and checked against it by `yarn test:gas`.
+ * @dev every test only makes the measured call, all the setup happens in setUp. The base contracts measure
+ * the first deposit and withdrawal of the accounts involved, the Warm variants measure the same paths after
+ * a full round trip, when balances and counters are already non zero.
+ */
+abstract contract L1GatewayBenchmark is Test {
+    L1GatewayRouter public l1Router;
+    IL1ArbitrumGateway public l1Gateway;
+    address public token;
+    address public inbox;
+
+    address public owner = makeAddr("owner");
+    address public user = makeAddr("user");
+    address public recipient = makeAddr("recipient");
+    address public l2Gateway = makeAddr("l2Gateway");
+    address public l2Router = makeAddr("l2Router");
+
+    // deposit params
+    uint256 public amount = 300;
+    uint256 public maxGas = 1_000_000;
+    uint256 public gasPriceBid = 100_000_000;
+    uint256 public maxSubmissionCost = 0.0001 ether;
+
+    function setUp() public virtual {
+        inbox = _deployInbox();
+        l1Router = _deployRouter();
+        (l1Gateway, token) = _deployGateway();
+        l1Router.initialize(owner, address(l1Gateway), address(0), l2Router, inbox);
+
+        _fundUser(amount * 10);
+        _fundEscrow(amount * 10);
+        vm.deal(user, 100 ether);
+        vm.deal(address(l1Router), 100 ether);
+
+        InboxMock(inbox).setL2ToL1Sender(l2Gateway);
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_outboundTransferCustomRefund_Router() public {
+        vm.prank(user);
+        l1Router.outboundTransferCustomRefund{value: _retryableValue()}(
+            token, user, recipient, amount, maxGas, gasPriceBid, _userData()
+        );
+    }
+
+    function test_outboundTransferCustomRefund_Direct() public {
+        vm.prank(address(l1Router));
+        l1Gateway.outboundTransferCustomRefund{value: _retryableValue()}(
+            token, user, recipient, amount, maxGas, gasPriceBid, abi.encode(user, _userData())
+        );
+    }
+
+    function test_finalizeInboundTransfer() public {
+        _finalizeWithdrawal(recipient, amount);
+    }
+
+    function test_l2CalldataBytes() public {
+        uint256 calldataBytes =
+            l1Gateway.getOutboundCalldata(token, user, recipient, amount, "").length;
+        emit log_named_uint("finalizeInboundTransfer calldata bytes", calldataBytes);
+        assertEq(calldataBytes, _expectedL2CalldataBytes(), "L2 calldata size changed");
+    }
+
+    ////
+    // Helper functions
+    ////
+    function _warmUp() internal {
+        vm.prank(user);
+        l1Router.outboundTransferCustomRefund{value: _retryableValue()}(
+            token, user, recipient, amount, maxGas, gasPriceBid, _userData()
+        );
+        _finalizeWithdrawal(recipient, amount);
+    }
+
+    function _finalizeWithdrawal(address _to, uint256 _amount) internal {
+        // the inbox mock is also the bridge
+        vm.prank(inbox);
+        l1Gateway.finalizeInboundTransfer(token, user, _to, _amount, abi.encode(7, bytes("")));
+    }
+
+    function _deployInbox() internal virtual returns (address) {
+        return address(new InboxMock());
+    }
+
+    function _deployRouter() internal virtual returns (L1GatewayRouter) {
+        return new L1GatewayRouter();
+    }
+
+    function _deployGateway() internal virtual returns (IL1ArbitrumGateway, address);
+
+    function _fundUser(uint256 _amount) internal virtual {
+        vm.prank(user);
+        TestERC20(token).mint();
+        vm.prank(user);
+        IERC20(token).approve(address(l1Gateway), _amount);
+    }
+
+    function _fundEscrow(uint256 _amount) internal virtual {
+        // tokens escrowed by earlier deposits
+        deal(token, address(l1Gateway), _amount);
+    }
+
+    function _retryableValue() internal view virtual returns (uint256) {
+        return maxSubmissionCost + maxGas * gasPriceBid;
+    }
+
+    function _userData() internal view virtual returns (bytes memory) {
+        return abi.encode(maxSubmissionCost, bytes(""));
+    }
+
+    function _expectedL2CalldataBytes() internal pure virtual returns (uint256);
+}
+
+contract L1ERC20GatewayBenchmark is L1GatewayBenchmark {
+    function _deployGateway() internal override returns (IL1ArbitrumGateway, address) {
+        L1ERC20Gateway gateway = new L1ERC20Gateway();
+        gateway.initialize(
+            l2Gateway,
+            address(l1Router),
+            inbox,
+            bytes32(uint256(1)),
+            makeAddr("l2BeaconProxyFactory")
+        );
+        return (gateway, address(new TestERC20()));
+    }
+
+    function _expectedL2CalldataBytes() internal pure override returns (uint256) {
+        // the first deposits of a token also carry the abi encoded name, symbol and decimals
+        return 740;
+    }
+}
+
+contract L1ERC20GatewayWarmBenchmark is L1ERC20GatewayBenchmark {
+    function setUp() public override {
+        super.setUp();
+        _warmUp();
+    }
+}
+
+contract L1OrbitERC20GatewayBenchmark is L1GatewayBenchmark {
+    ERC20PresetMinterPauser public nativeToken;
+
+    function _deployInbox() internal override returns (address) {
+        ERC20InboxMock erc20Inbox = new ERC20InboxMock();
+        nativeToken = new ERC20PresetMinterPauser("X", "Y");
+        nativeToken.mint(user, 1_000_000 ether);
+        erc20Inbox.setMockNativeToken(address(nativeToken));
+        return address(erc20Inbox);
+    }
+
+    function _deployRouter() internal override returns (L1GatewayRouter) {
+        return new L1OrbitGatewayRouter();
+    }
+
+    function _deployGateway() internal override returns (IL1ArbitrumGateway, address) {
+        L1OrbitERC20Gateway gateway = new L1OrbitERC20Gateway();
+        gateway.initialize(
+            l2Gateway,
+            address(l1Router),
+            inbox,
+            bytes32(uint256(1)),
+            makeAddr("l2BeaconProxyFactory")
+        );
+        return (gateway, address(new TestERC20()));
+    }
+
+    function _fundUser(uint256 _amount) internal override {
+        super._fundUser(_amount);
+        vm.prank(user);
+        nativeToken.approve(address(l1Gateway), type(uint256).max);
+    }
+
+    function _retryableValue() internal pure override returns (uint256) {
+        // fees are paid in the native token
+        return 0;
+    }
+
+    function _userData() internal view override returns (bytes memory) {
+        return abi.encode(maxSubmissionCost, bytes(""), maxSubmissionCost + maxGas * gasPriceBid);
+    }
+
+    function _expectedL2CalldataBytes() internal pure override returns (uint256) {
+        return 740;
+    }
+}
+
+contract L1OrbitERC20GatewayWarmBenchmark is L1OrbitERC20GatewayBenchmark {
+    function setUp() public override {
+        super.setUp();
+        _warmUp();
+    }
+}
+
+contract L1CustomGatewayBenchmark is L1GatewayBenchmark {
+    address public unregisteredToken;
+
+    function test_registerTokenToL2() public {
+        vm.prank(unregisteredToken);
+        L1CustomGateway(address(l1Gateway)).registerTokenToL2{value: _retryableValue()}(
+            makeAddr("l2UnregisteredToken"), maxGas, gasPriceBid, maxSubmissionCost
+        );
+    }
+
+    function _deployGateway() internal override returns (IL1ArbitrumGateway, address) {
+        L1CustomGateway gateway = new L1CustomGateway();
+        gateway.initialize(l2Gateway, address(l1Router), inbox, owner);
+
+        address[] memory l1Tokens = new address[](1);
+        l1Tokens[0] = address(new TestERC20());
+        address[] memory l2Tokens = new address[](1);
+        l2Tokens[0] = makeAddr("l2CustomToken");
+        vm.deal(owner, 100 ether);
+        vm.prank(owner);
+        gateway.forceRegisterTokenToL2{value: _retryableValue()}(
+            l1Tokens, l2Tokens, maxGas, gasPriceBid, maxSubmissionCost
+        );
+
+        // token used to measure registrations
+        unregisteredToken = address(new TestERC20());
+        vm.mockCall(
+            unregisteredToken, abi.encodeWithSignature("isArbitrumEnabled()"), abi.encode(uint8(0xb1))
+        );
+        vm.deal(unregisteredToken, 100 ether);
+
+        return (gateway, l1Tokens[0]);
+    }
+
+    function _expectedL2CalldataBytes() internal pure override returns (uint256) {
+        // selector, 5 static words and an empty (gatewayData, callHookData) pair
+        return 324;
+    }
+}
+
+contract L1CustomGatewayWarmBenchmark is L1CustomGatewayBenchmark {
+    function setUp() public override {
+        super.setUp();
+        _warmUp();
+    }
+}
+
+contract L1WethGatewayBenchmark is L1GatewayBenchmark {
+    function _deployGateway() internal override returns (IL1ArbitrumGateway, address) {
+        L1WethGateway gateway = new L1WethGateway();
+        address l1Weth = address(new TestWETH9("weth", "weth"));
+        gateway.initialize(l2Gateway, address(l1Router), inbox, l1Weth, makeAddr("l2Weth"));
+        return (IL1ArbitrumGateway(address(gateway)), l1Weth);
+    }
+
+    function _fundUser(uint256 _amount) internal override {
+        vm.deal(user, _amount);
+        vm.startPrank(user);
+        TestWETH9(payable(token)).deposit{value: _amount}();
+        IERC20(token).approve(address(l1Gateway), _amount);
+        vm.stopPrank();
+    }
+
+    function _fundEscrow(uint256 _amount) internal override {
+        // deposited weth is unwrapped, withdrawals come with ether from the bridge
+        vm.deal(address(l1Gateway), _amount);
+    }
+
+    function _expectedL2CalldataBytes() internal pure override returns (uint256) {
+        return 324;
+    }
+}
+
+contract L1WethGatewayWarmBenchmark is L1WethGatewayBenchmark {
+    function setUp() public override {
+        super.setUp();
+        _warmUp();
+    }
+}
+
+contract L1USDCGatewayBenchmark is L1GatewayBenchmark {
+    function _deployGateway() internal override returns (IL1ArbitrumGateway, address) {
+        L1USDCGateway gateway = new L1USDCGateway();
+        address l1USDC = address(new MockUsdc());
+        gateway.initialize(
+            l2Gateway, address(l1Router), inbox, l1USDC, makeAddr("l2USDC"), owner
+        );
+        return (IL1ArbitrumGateway(address(gateway)), l1USDC);
+    }
+
+    function _fundUser(uint256 _amount) internal override {
+        IERC20(token).transfer(user, _amount);
+        vm.prank(user);
+        IERC20(token).approve(address(l1Gateway), _amount);
+    }
+
+    function _expectedL2CalldataBytes() internal pure override returns (uint256) {
+        return 324;
+    }
+}
+
+contract L1USDCGatewayWarmBenchmark is L1USDCGatewayBenchmark {
+    function setUp() public override {
+        super.setUp();
+        _warmUp();
+    }
+}
+
+/**
+ * @notice Gas benchmarks of the L1 router gateway registration
+ */
+contract L1GatewayRouterBenchmark is Test {
+    L1GatewayRouter public l1Router;
+    address public erc20Gateway;
+
+    address public owner = makeAddr("owner");
+    address public inbox;
+
+    uint256 public maxGas = 1_000_000;
+    uint256 public gasPriceBid = 100_000_000;
+    uint256 public maxSubmissionCost = 0.0001 ether;
+
+    function setUp() public {
+        inbox = address(new InboxMock());
+        l1Router = new L1GatewayRouter();
+
+        L1ERC20Gateway gateway = new L1ERC20Gateway();
+        gateway.initialize(
+            makeAddr("l2Gateway"),
+            address(l1Router),
+            inbox,
+            bytes32(uint256(1)),
+            makeAddr("l2BeaconProxyFactory")
+        );
+        erc20Gateway = address(gateway);
+
+        l1Router.initialize(owner, erc20Gateway, address(0), makeAddr("l2Router"), inbox);
+        vm.deal(owner, 100 ether);
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_setGateways_OneToken() public {
+        _setGateways(1);
+    }
+
+    function test_setGateways_TenTokens() public {
+        _setGateways(10);
+    }
+
+    function _setGateways(uint256 count) internal {
+        address[] memory tokens = new address[](count);
+        address[] memory gateways = new address[](count);
+        for (uint256 i = 0; i < count; i++) {
+            tokens[i] = address(uint160(0x1000 + i));
+            gateways[i] = erc20Gateway;
+        }
+
+        vm.prank(owner);
+        l1Router.setGateways{value: maxSubmissionCost + maxGas * gasPriceBid}(
+            tokens, gateways, maxGas, gasPriceBid, maxSubmissionCost
+        );
+    }
+}
+
+/**
+ * @notice Gas benchmark of the router batch view over a token list of the size indexers resolve, with tokens
+ * of the default gateway interleaved with tokens of two registered gateways
+ */
+contract L1GatewayRouterViewsBenchmark is Test {
+    L1GatewayRouter public l1Router;
+    address[] public tokens;
+
+    address public owner = makeAddr("owner");
+
+    uint256 public constant TOKEN_COUNT = 5000;
+    // usual gas cap of eth_call in node RPCs
+    uint256 public constant ETH_CALL_GAS_CAP = 50_000_000;
+
+    uint256 public maxGas = 1_000_000;
+    uint256 public gasPriceBid = 100_000_000;
+    uint256 public maxSubmissionCost = 0.0001 ether;
+
+    function setUp() public {
+        address inbox = address(new InboxMock());
+        l1Router = new L1GatewayRouter();
+        l1Router.initialize(owner, _deployGateway(inbox), address(0), makeAddr("l2Router"), inbox);
+
+        address gatewayB = _deployGateway(inbox);
+        address gatewayC = _deployGateway(inbox);
+        address[] memory registeredTokens = new address[](TOKEN_COUNT / 5);
+        address[] memory registeredGateways = new address[](TOKEN_COUNT / 5);
+        for (uint256 i = 0; i < TOKEN_COUNT; i++) {
+            tokens.push(address(uint160(0x100000 + i)));
+            // every fifth token alternates between the registered gateways
+            if (i % 5 == 0) {
+                registeredTokens[i / 5] = tokens[i];
+                registeredGateways[i / 5] = i % 10 == 0 ? gatewayB : gatewayC;
+            }
+        }
+
+        vm.deal(owner, 100 ether);
+        vm.prank(owner);
+        l1Router.setGateways{value: maxSubmissionCost + maxGas * gasPriceBid}(
+            registeredTokens, registeredGateways, maxGas, gasPriceBid, maxSubmissionCost
+        );
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_calculateL2TokenAddresses_5000Tokens() public {
+        address[] memory _tokens = tokens;
+
+        uint256 gasBefore = gasleft();
+        address[] memory l2Tokens = l1Router.calculateL2TokenAddresses(_tokens);
+        uint256 gasUsed = gasBefore - gasleft();
+
+        emit log_named_uint("calculateL2TokenAddresses gas for 5000 tokens", gasUsed);
+        assertLt(gasUsed, ETH_CALL_GAS_CAP, "Above the eth_call gas cap");
+        assertEq(l2Tokens.length, TOKEN_COUNT, "Invalid length");
+        for (uint256 i = 0; i < TOKEN_COUNT; i += 499) {
+            assertEq(
+                l2Tokens[i],
+                l1Router.calculateL2TokenAddress(_tokens[i]),
+                "Invalid L2 token address"
+            );
+        }
+    }
+
+    function _deployGateway(address inbox) internal returns (address) {
+        L1ERC20Gateway gateway = new L1ERC20Gateway();
+        gateway.initialize(
+            makeAddr("l2Gateway"),
+            address(l1Router),
+            inbox,
+            bytes32(uint256(1)),
+            makeAddr("l2BeaconProxyFactory")
+        );
+        return address(gateway);
+    }
+}
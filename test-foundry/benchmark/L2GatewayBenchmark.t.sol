@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: Apache-2.0
+
+pragma solidity ^0.8.0;
+
+import "forge-std/Test.sol";
+import {L2ArbitrumGateway} from "contracts/tokenbridge/arbitrum/gateway/L2ArbitrumGateway.sol";
+import {L2ERC20Gateway} from "contracts/tokenbridge/arbitrum/gateway/L2ERC20Gateway.sol";
+import {L2CustomGateway} from "contracts/tokenbridge/arbitrum/gateway/L2CustomGateway.sol";
+import {L2WethGateway} from "contracts/tokenbridge/arbitrum/gateway/L2WethGateway.sol";
+import {StandardArbERC20} from "contracts/tokenbridge/arbitrum/StandardArbERC20.sol";
+import {StandardArbERC20V2} from "contracts/tokenbridge/arbitrum/StandardArbERC20V2.sol";
+import {
+    BeaconProxyFactory,
+    MinimalBeaconProxyFactory
+} from "contracts/tokenbridge/libraries/ClonableBeaconProxy.sol";
+import {AddressAliasHelper} from "contracts/tokenbridge/libraries/AddressAliasHelper.sol";
+import {aeWETH} from "contracts/tokenbridge/libraries/aeWETH.sol";
+import {ArbSysMock} from "contracts/tokenbridge/test/ArbSysMock.sol";
+import {L2CustomToken} from "../L2CustomGateway.t.sol";
+import {UpgradeableBeacon} from "@openzeppelin/contracts/proxy/beacon/UpgradeableBeacon.sol";
+import {ProxyAdmin} from "@openzeppelin/contracts/proxy/transparent/ProxyAdmin.sol";
+import {TransparentUpgradeableProxy} from
+    "@openzeppelin/contracts/proxy/transparent/TransparentUpgradeableProxy.sol";
+
+/**
+ * @notice Gas benchmarks of the L2 gateway hot paths, recorded in .gas-snapshot by `yarn gas:snapshot`
+ * and checked against it by `yarn test:gas`.
+ * @dev every test only makes the measured call, all the setup happens in setUp. The base contracts measure
+ * the first deposit of a token, which for the standard gateway includes deploying the token through the
+ * BeaconProxyFactory. The Warm variants measure the same paths after a deposit, and withdrawals.
+ */
+abstract contract L2GatewayBenchmark is Test {
+    L2ArbitrumGateway public l2Gateway;
+    address public l1Token;
+
+    address public l1Counterpart = makeAddr("l1Counterpart");
+    address public aliasedL1Counterpart = AddressAliasHelper.applyL1ToL2Alias(l1Counterpart);
+    address public l2Router = makeAddr("l2Router");
+    address public sender = makeAddr("sender");
+    address public recipient = makeAddr("recipient");
+
+    uint256 public amount = 300;
+
+    function setUp() public virtual {
+        (l2Gateway, l1Token) = _deployGateway();
+        vm.etch(0x0000000000000000000000000000000000000064, address(new ArbSysMock()).code);
+        vm.deal(aliasedL1Counterpart, 100 ether);
+    }
+
+    /* solhint-disable func-name-mixedcase */
+    function test_finalizeInboundTransfer() public {
+        _finalizeDeposit(recipient, amount);
+    }
+
+    ////
+    // Helper functions
+    ////
+    function _finalizeDeposit(address _to, uint256 _amount) internal {
+        vm.prank(aliasedL1Counterpart);
+        l2Gateway.finalizeInboundTransfer{value: _depositValue(_amount)}(
+            l1Token, sender, _to, _amount, _depositData()
+        );
+    }
+
+    function _deployGateway() internal virtual returns (L2ArbitrumGateway, address);
+
+    function _depositData() internal pure virtual returns (bytes memory);
+
+    function _depositValue(uint256 _amount) internal pure virtual returns (uint256);
+}
+
+/**
+ * @dev see L2GatewayBenchmark, withdrawals are measured once the recipient holds L2 tokens
+ */
+abstract contract L2GatewayWarmBenchmark is L2GatewayBenchmark {
+    address public newRecipient = makeAddr("newRecipient");
+
+    function setUp() public virtual override {
+        super.setUp();
+        _finalizeDeposit(recipient, amount * 3);
+    }
+
+    function test_finalizeInboundTransfer_NewRecipient() public {
+        _finalizeDeposit(newRecipient, amount);
+    }
+
+    function test_outboundTransfer() public {
+        vm.prank(recipient);
+        l2Gateway.outboundTransfer(l1Token, recipient, amount, "");
+    }
+}
+
+contract L2ERC20GatewayBenchmark is L2GatewayBenchmark {
+    function _deployGateway() internal virtual override returns (L2ArbitrumGateway, address) {
+        L2ERC20Gateway gateway = new L2ERC20Gateway();
+
+        UpgradeableBeacon beacon = new UpgradeableBeacon(address(new StandardArbERC20()));
+        BeaconProxyFactory beaconProxyFactory = new BeaconProxyFactory();
+        beaconProxyFactory.initialize(address(beacon));
+
+        gateway.initialize(l1Counterpart, l2Router, address(beaconProxyFactory));
+        return (gateway, makeAddr("l1Token"));
+    }
+
+    function _depositData() internal pure override returns (bytes memory) {
+        // deploy data sent by the L1ERC20Gateway
+        bytes memory gatewayData = abi.encode(
+            abi.encode(bytes("Name")), abi.encode(bytes("Symbol")), abi.encode(uint256(18))
+        );
+        return abi.encode(gatewayData, bytes(""));
+    }
+
+    function _depositValue(uint256 /* _amount */) internal pure override returns (uint256) {
+        return 0;
+    }
+}
+
+contract L2ERC20GatewayWarmBenchmark is L2ERC20GatewayBenchmark, L2GatewayWarmBenchmark {
+    function setUp() public override(L2GatewayBenchmark, L2GatewayWarmBenchmark) {
+        super.setUp();
+    }
+}
+
+/**
+ * @dev same as L2ERC20GatewayBenchmark, with tokens deployed by MinimalBeaconProxyFactory
+ */
+contract L2ERC20GatewayMinimalBeaconProxyBenchmark is L2ERC20GatewayBenchmark {
+    function _deployGateway() internal override returns (L2ArbitrumGateway, address) {
+        L2ERC20Gateway gateway = new L2ERC20Gateway();
+
+        UpgradeableBeacon beacon = new UpgradeableBeacon(address(new StandardArbERC20()));
+        MinimalBeaconProxyFactory beaconProxyFactory = new MinimalBeaconProxyFactory();
+        beaconProxyFactory.initialize(address(beacon));
+
+        gateway.initialize(l1Counterpart, l2Router, address(beaconProxyFactory));
+        return (gateway, makeAddr("l1Token"));
+    }
+}
+
+contract L2ERC20GatewayMinimalBeaconProxyWarmBenchmark is
+    L2ERC20GatewayMinimalBeaconProxyBenchmark,
+    L2GatewayWarmBenchmark
+{
+    function setUp() public override(L2GatewayBenchmark, L2GatewayWarmBenchmark) {
+        super.setUp();
+    }
+}
+
+/**
+ * @dev same as L2ERC20GatewayBenchmark, with StandardArbERC20V2 as the beacon's implementation
+ */
+contract L2ERC20GatewayTokenV2Benchmark is L2ERC20GatewayBenchmark {
+    function _deployGateway() internal override returns (L2ArbitrumGateway, address) {
+        L2ERC20Gateway gateway = new L2ERC20Gateway();
+
+        UpgradeableBeacon beacon = new UpgradeableBeacon(address(new StandardArbERC20V2()));
+        BeaconProxyFactory beaconProxyFactory = new BeaconProxyFactory();
+        beaconProxyFactory.initialize(address(beacon));
+
+        gateway.initialize(l1Counterpart, l2Router, address(beaconProxyFactory));
+        return (gateway, makeAddr("l1Token"));
+    }
+}
+
+contract L2ERC20GatewayTokenV2WarmBenchmark is
+    L2ERC20GatewayTokenV2Benchmark,
+    L2GatewayWarmBenchmark
+{
+    function setUp() public override(L2GatewayBenchmark, L2GatewayWarmBenchmark) {
+        super.setUp();
+    }
+}
+
+contract L2CustomGatewayBenchmark is L2GatewayBenchmark {
+    function _deployGateway() internal override returns (L2ArbitrumGateway, address) {
+        L2CustomGateway gateway = new L2CustomGateway();
+        gateway.initialize(l1Counterpart, l2Router);
+
+        address[] memory l1Tokens = new address[](1);
+        l1Tokens[0] = makeAddr("l1CustomToken");
+        address[] memory l2Tokens = new address[](1);
+        l2Tokens[0] = address(new L2CustomToken(address(gateway), l1Tokens[0]));
+
+        vm.prank(AddressAliasHelper.applyL1ToL2Alias(l1Counterpart));
+        gateway.registerTokenFromL1(l1Tokens, l2Tokens);
+
+        return (gateway, l1Tokens[0]);
+    }
+
+    function _depositData() internal pure override returns (bytes memory) {
+        return abi.encode(bytes(""), bytes(""));
+    }
+
+    function _depositValue(uint256 /* _amount */) internal pure override returns (uint256) {
+        return 0;
+    }
+}
+
+contract L2CustomGatewayWarmBenchmark is L2CustomGatewayBenchmark, L2GatewayWarmBenchmark {
+    function setUp() public override(L2GatewayBenchmark, L2GatewayWarmBenchmark) {
+        super.setUp();
+    }
+}
+
+contract L2WethGatewayBenchmark is L2GatewayBenchmark {
+    function _deployGateway() internal override returns (L2ArbitrumGateway, address) {
+        L2WethGateway gateway = new L2WethGateway();
+        address l1Weth = makeAddr("l1Weth");
+
+        ProxyAdmin pa = new ProxyAdmin();
+        address l2Weth =
+            address(new TransparentUpgradeableProxy(address(new aeWETH()), address(pa), ""));
+
+        gateway.initialize(l1Counterpart, l2Router, l1Weth, l2Weth);
+        aeWETH(payable(l2Weth)).initialize("WETH", "WETH", 18, address(gateway), l1Weth);
+
+        return (L2ArbitrumGateway(address(gateway)), l1Weth);
+    }
+
+    function _depositData() internal pure override returns (bytes memory) {
+        return abi.encode(bytes(""), bytes(""));
+    }
+
+    function _depositValue(uint256 _amount) internal pure override returns (uint256) {
+        // deposited ether comes as the L2 call value of the retryable
+        return _amount;
+    }
+}
+
+contract L2WethGatewayWarmBenchmark is L2WethGatewayBenchmark, L2GatewayWarmBenchmark {
+    function setUp() public override(L2GatewayBenchmark, L2GatewayWarmBenchmark) {
+        super.setUp();
+    }
+}